@@ -42,6 +42,10 @@ MetaConfig parseCommandLine(int argc, const char * argv[])
   )(
     "output_directory,o", po::value<std::string>(),
     "Directory to save the list of validation results in a JSON format"
+  )(
+    "output_format", po::value(&config.output_format)->default_value("json"),
+    "Format of the validation results. \"json\" writes lanelet2_validation_results.json and "
+    "\"ndjson\" writes lanelet2_validation_results.ndjson with one record per line"
   )(
     "exclusion_list,x", po::value<std::string>(),
     "List of primitives that should be excluded from the validation in a JSON format"
@@ -59,6 +63,74 @@ MetaConfig parseCommandLine(int argc, const char * argv[])
   )(
     "language,l", po::value<std::string>()->default_value("en"),
     "Language to display the issue messages."
+  )(
+    "jobs,j", po::value(&config.jobs)->default_value(0),
+    "Number of threads used for parallel processing such as projecting the map and building lane "
+    "topologies. 0 means the number of hardware threads"
+  )(
+    "validator_jobs", po::value(&config.validator_jobs)->default_value(1),
+    "Number of validators run at once on the threads of --jobs when their prerequisites have "
+    "finished. The loops inside each validator then run serially"
+  )(
+    "speculative", po::bool_switch(&config.speculative),
+    "Start validators on idle threads of --validator_jobs before their prerequisites finish. "
+    "Their results are discarded if a prerequisite fails, so the results do not change"
+  )(
+    "timing_profile", po::value(&config.timing_profile),
+    "JSON file with the elapsed time of each validator, read to start the longest validators "
+    "first and updated after the validation. Created if it does not exist"
+  )(
+    "progress", po::value(&config.progress),
+    "Write progress events as newline-delimited JSON to \"stdout\" or the given file "
+    "descriptor number (e.g. 3)"
+  )(
+    "roi", po::value(&config.roi),
+    "Validate only the primitives intersecting the bounding box \"min_x,min_y,max_x,max_y\" "
+    "in the projected map coordinates"
+  )(
+    "roi_ids", po::value(&config.roi_ids),
+    "Validate only the primitives intersecting the bounding boxes of the comma separated "
+    "primitive IDs. Can be combined with --roi"
+  )(
+    "shards", po::value(&config.shards)->default_value(1),
+    "Number of worker processes validating spatial tiles of the map in parallel. The results are "
+    "merged into the same results as a run in a single process"
+  )(
+    "streaming", po::bool_switch(&config.streaming),
+    "Validate the map tile by tile without loading the whole map, for maps larger than the memory"
+  )(
+    "tile_size", po::value(&config.tile_size)->default_value(1000.0),
+    "Size of the tiles of --streaming in meters. Must be larger than the reach of the validators"
+  )(
+    "tile_cache_mb", po::value(&config.tile_cache_mb)->default_value(512),
+    "Memory (MB) for caching the map elements of the tiles of --streaming"
+  )(
+    "timeout_per_validator", po::value(&config.timeout_per_validator)->default_value(0.0),
+    "Seconds after which a validator stops and is reported as \"timeout\" with the issues found "
+    "so far. 0 means no limit"
+  )(
+    "global_deadline", po::value(&config.global_deadline)->default_value(0.0),
+    "Seconds after the start after which the running validator stops and the remaining "
+    "validators are reported as \"timeout\" without running. 0 means no limit"
+  )(
+    "max_issues_per_code", po::value(&config.max_issues_per_code)->default_value(0),
+    "Number of issues listed per issue code of a validator. Further issues are only counted and "
+    "summarized. 0 means no limit"
+  )(
+    "stop_at_issue_cap", po::bool_switch(&config.stop_at_issue_cap),
+    "Stop a validator once an issue code with the severity Error or Warning passes "
+    "--max_issues_per_code, when only the pass/fail of the validators matters"
+  )(
+    "fail_fast", po::bool_switch(&config.fail_fast),
+    "Stop the validation at the first error not in the exclusion list. The remaining validators "
+    "are reported as \"cancelled\" and the exit code is 2 if an error was found"
+  )(
+    "issue_geometry", po::bool_switch(&config.issue_geometry),
+    "Add the position and the bounding box of the primitive of each issue to the results, and "
+    "write an index of the issues by tile next to them (requires -i)"
+  )(
+    "issue_tile_size", po::value(&config.issue_tile_size)->default_value(100.0),
+    "Size of the tiles of the issue index of --issue_geometry in meters"
   )(
     "location", po::value(&validation_config.location)->default_value(validation_config.location),
     "Location of the map (for instantiating the traffic rules), e.g. de for Germany"
@@ -76,12 +148,23 @@ MetaConfig parseCommandLine(int argc, const char * argv[])
   )(
     "print", "Print all available checker without running them"
   );
+  // Options given to the worker processes of --shards, not shown in the help
+  po::options_description hidden;
+  hidden.add_options()
+  (
+    "shard_index", po::value(&config.shard_index), "Shard validated by this worker process"
+  )(
+    "shard_output", po::value(&config.shard_output), "Results directory of this worker process"
+  );
   // clang-format on
 
+  po::options_description all_options;
+  all_options.add(desc).add(hidden);
+
   po::variables_map vm;
   po::positional_options_description pos;
   pos.add("map_file", 1);
-  po::store(po::command_line_parser(argc, argv).options(desc).positional(pos).run(), vm);
+  po::store(po::command_line_parser(argc, argv).options(all_options).positional(pos).run(), vm);
   po::notify(vm);
   config.command_line_config.help = vm.count("help") != 0;
   config.command_line_config.print = vm.count("print") != 0;
@@ -0,0 +1,320 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/compression.hpp"
+
+#include <zlib.h>
+#include <zstd.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+constexpr size_t chunk_size = 1 << 20;
+constexpr size_t max_pending_chunks = 8;  //<! Decompressed chunks read ahead of the reader
+}  // namespace
+
+Compression compression_of(const std::filesystem::path & file)
+{
+  const std::string extension = file.extension().string();
+  if (extension == ".gz") {
+    return Compression::GZIP;
+  }
+  if (extension == ".zst") {
+    return Compression::ZSTD;
+  }
+  return Compression::NONE;
+}
+
+DecompressingStreamBuffer::DecompressingStreamBuffer(
+  const std::filesystem::path & file, const Compression compression)
+: input_(file, std::ios::binary)
+{
+  if (!input_.is_open()) {
+    throw std::runtime_error("Failed to open " + file.string());
+  }
+  if (compression == Compression::NONE) {
+    throw std::invalid_argument(file.string() + " is not compressed");
+  }
+
+  thread_ = std::thread([this, compression, file]() {
+    try {
+      if (compression == Compression::GZIP) {
+        decompress_gzip();
+      } else {
+        decompress_zstd();
+      }
+    } catch (const std::exception & e) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      error_ = std::make_exception_ptr(
+        std::runtime_error("Failed to decompress " + file.string() + ": " + e.what()));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_ = true;
+    changed_.notify_all();
+  });
+}
+
+DecompressingStreamBuffer::~DecompressingStreamBuffer()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    changed_.notify_all();
+  }
+  thread_.join();
+}
+
+void DecompressingStreamBuffer::rethrow_error() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (error_) {
+    std::rethrow_exception(error_);
+  }
+}
+
+DecompressingStreamBuffer::int_type DecompressingStreamBuffer::underflow()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  changed_.wait(lock, [this]() { return !chunks_.empty() || finished_; });
+  if (chunks_.empty()) {
+    return traits_type::eof();
+  }
+  current_ = std::move(chunks_.front());
+  chunks_.pop_front();
+  changed_.notify_all();
+  lock.unlock();
+
+  setg(current_.data(), current_.data(), current_.data() + current_.size());
+  return traits_type::to_int_type(*gptr());
+}
+
+void DecompressingStreamBuffer::push_chunk(std::string chunk)
+{
+  if (chunk.empty()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  changed_.wait(lock, [this]() { return chunks_.size() < max_pending_chunks || stopped_; });
+  if (stopped_) {
+    throw std::runtime_error("the reader stopped");
+  }
+  chunks_.push_back(std::move(chunk));
+  changed_.notify_all();
+}
+
+void DecompressingStreamBuffer::decompress_gzip()
+{
+  z_stream stream{};
+  // 32 lets zlib detect the gzip (or zlib) header
+  if (inflateInit2(&stream, 15 + 32) != Z_OK) {
+    throw std::runtime_error("inflateInit2 failed");
+  }
+  std::vector<char> input(chunk_size);
+  std::string output(chunk_size, '\0');
+  int result = Z_OK;
+
+  try {
+    while (input_.read(input.data(), static_cast<std::streamsize>(input.size())) ||
+           input_.gcount() > 0) {
+      stream.next_in = reinterpret_cast<Bytef *>(input.data());
+      stream.avail_in = static_cast<uInt>(input_.gcount());
+      while (stream.avail_in > 0) {
+        stream.next_out = reinterpret_cast<Bytef *>(output.data());
+        stream.avail_out = static_cast<uInt>(output.size());
+        result = inflate(&stream, Z_NO_FLUSH);
+        if (result != Z_OK && result != Z_STREAM_END) {
+          throw std::runtime_error(stream.msg ? stream.msg : "inflate failed");
+        }
+        push_chunk(output.substr(0, output.size() - stream.avail_out));
+        // A gzip file can consist of several members
+        if (result == Z_STREAM_END && stream.avail_in > 0) {
+          inflateReset(&stream);
+        }
+      }
+    }
+    if (result != Z_STREAM_END) {
+      throw std::runtime_error("unexpected end of file");
+    }
+  } catch (...) {
+    inflateEnd(&stream);
+    throw;
+  }
+  inflateEnd(&stream);
+}
+
+void DecompressingStreamBuffer::decompress_zstd()
+{
+  std::unique_ptr<ZSTD_DCtx, size_t (*)(ZSTD_DCtx *)> context(ZSTD_createDCtx(), ZSTD_freeDCtx);
+  if (!context) {
+    throw std::runtime_error("ZSTD_createDCtx failed");
+  }
+  std::vector<char> input(ZSTD_DStreamInSize());
+  std::string output(ZSTD_DStreamOutSize(), '\0');
+  size_t remaining = 0;
+
+  while (input_.read(input.data(), static_cast<std::streamsize>(input.size())) ||
+         input_.gcount() > 0) {
+    ZSTD_inBuffer in{input.data(), static_cast<size_t>(input_.gcount()), 0};
+    while (in.pos < in.size) {
+      ZSTD_outBuffer out{output.data(), output.size(), 0};
+      remaining = ZSTD_decompressStream(context.get(), &out, &in);
+      if (ZSTD_isError(remaining)) {
+        throw std::runtime_error(ZSTD_getErrorName(remaining));
+      }
+      push_chunk(output.substr(0, out.pos));
+    }
+  }
+  // The last frame was not complete
+  if (remaining != 0) {
+    throw std::runtime_error("unexpected end of file");
+  }
+}
+
+DecompressingInputStream::DecompressingInputStream(const std::filesystem::path & file)
+: std::istream(nullptr),
+  buffer_(std::make_unique<DecompressingStreamBuffer>(file, compression_of(file)))
+{
+  rdbuf(buffer_.get());
+}
+
+struct CompressingStreamBuffer::Context
+{
+  z_stream gzip{};
+  std::unique_ptr<ZSTD_CCtx, size_t (*)(ZSTD_CCtx *)> zstd{nullptr, ZSTD_freeCCtx};
+};
+
+CompressingStreamBuffer::CompressingStreamBuffer(
+  const std::filesystem::path & file, const Compression compression)
+: output_(file, std::ios::binary | std::ios::trunc),
+  compression_(compression),
+  buffer_(chunk_size),
+  context_(std::make_unique<Context>())
+{
+  if (!output_.is_open()) {
+    throw std::runtime_error("Failed to open " + file.string());
+  }
+  if (compression_ == Compression::GZIP) {
+    // 16 makes zlib write a gzip header
+    if (
+      deflateInit2(
+        &context_->gzip, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) !=
+      Z_OK) {
+      throw std::runtime_error("deflateInit2 failed");
+    }
+  } else if (compression_ == Compression::ZSTD) {
+    context_->zstd.reset(ZSTD_createCCtx());
+    if (!context_->zstd) {
+      throw std::runtime_error("ZSTD_createCCtx failed");
+    }
+  } else {
+    throw std::invalid_argument(file.string() + " is not a compressed file name");
+  }
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+}
+
+CompressingStreamBuffer::~CompressingStreamBuffer()
+{
+  try {
+    finish();
+  } catch (const std::exception &) {
+    // The error is reported by an explicit finish()
+  }
+  if (compression_ == Compression::GZIP) {
+    deflateEnd(&context_->gzip);
+  }
+}
+
+CompressingStreamBuffer::int_type CompressingStreamBuffer::overflow(int_type c)
+{
+  compress(pbase(), static_cast<size_t>(pptr() - pbase()), false);
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+  if (!traits_type::eq_int_type(c, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+int CompressingStreamBuffer::sync()
+{
+  return 0;
+}
+
+void CompressingStreamBuffer::finish()
+{
+  if (finished_) {
+    return;
+  }
+  finished_ = true;
+  compress(pbase(), static_cast<size_t>(pptr() - pbase()), true);
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+  output_.close();
+  if (!output_) {
+    throw std::runtime_error("Failed to write the compressed file");
+  }
+}
+
+void CompressingStreamBuffer::compress(const char * data, const size_t size, const bool end)
+{
+  std::vector<char> output(chunk_size);
+
+  if (compression_ == Compression::GZIP) {
+    z_stream & stream = context_->gzip;
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));  // NOLINT
+    stream.avail_in = static_cast<uInt>(size);
+    int result = Z_OK;
+    do {
+      stream.next_out = reinterpret_cast<Bytef *>(output.data());
+      stream.avail_out = static_cast<uInt>(output.size());
+      result = deflate(&stream, end ? Z_FINISH : Z_NO_FLUSH);
+      if (result == Z_STREAM_ERROR) {
+        throw std::runtime_error("deflate failed");
+      }
+      output_.write(output.data(), static_cast<std::streamsize>(output.size() - stream.avail_out));
+    } while (stream.avail_in > 0 || (end && result != Z_STREAM_END));
+    return;
+  }
+
+  ZSTD_inBuffer in{data, size, 0};
+  size_t remaining = 0;
+  do {
+    ZSTD_outBuffer out{output.data(), output.size(), 0};
+    remaining =
+      ZSTD_compressStream2(context_->zstd.get(), &out, &in, end ? ZSTD_e_end : ZSTD_e_continue);
+    if (ZSTD_isError(remaining)) {
+      throw std::runtime_error(ZSTD_getErrorName(remaining));
+    }
+    output_.write(output.data(), static_cast<std::streamsize>(out.pos));
+  } while (in.pos < in.size || (end && remaining != 0));
+}
+
+CompressingOutputStream::CompressingOutputStream(
+  const std::filesystem::path & file, const Compression compression)
+: std::ostream(nullptr), buffer_(std::make_unique<CompressingStreamBuffer>(file, compression))
+{
+  rdbuf(buffer_.get());
+}
+
+void CompressingOutputStream::finish()
+{
+  flush();
+  buffer_->finish();
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,115 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/config_store.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+// The snapshot installed on this thread by ValidatorConfigStore::Scope
+thread_local ValidatorConfigPtr scoped_config = nullptr;
+
+// The process-wide default. current_ref() reads it with an atomic load of the raw pointer, and
+// default_config keeps it alive until initialize() replaces it.
+std::mutex default_config_mutex;
+ValidatorConfigPtr default_config = nullptr;
+std::atomic<const ValidatorConfig *> default_config_raw{nullptr};
+
+const ValidatorConfigPtr & empty_config()
+{
+  static const ValidatorConfigPtr empty = std::make_shared<const ValidatorConfig>();
+  return empty;
+}
+}  // namespace
+
+ValidatorConfig::ValidatorConfig(
+  const YAML::Node & parameters, nlohmann::json issues_info, std::string language)
+: parameters_(YAML::Clone(parameters)),
+  issues_info_(std::move(issues_info)),
+  language_(std::move(language))
+{
+}
+
+std::shared_ptr<const ValidatorConfig> ValidatorConfig::load(
+  const std::string & params_yaml_file, const std::string & issues_info_json_file,
+  const std::string & language)
+{
+  const YAML::Node parameters =
+    params_yaml_file.empty() ? YAML::Load(default_yaml_str_) : YAML::LoadFile(params_yaml_file);
+
+  nlohmann::json issues_info;
+  if (issues_info_json_file.empty()) {
+    issues_info = nlohmann::json::parse(default_json_str_);
+  } else {
+    std::ifstream json_ifs(issues_info_json_file);
+    if (!json_ifs.is_open()) {
+      throw std::runtime_error("Failed to open JSON file: " + issues_info_json_file);
+    }
+    json_ifs >> issues_info;
+  }
+
+  return std::make_shared<const ValidatorConfig>(parameters, std::move(issues_info), language);
+}
+
+ValidatorConfigStore::Scope::Scope(ValidatorConfigPtr config) : previous_(std::move(scoped_config))
+{
+  scoped_config = std::move(config);
+}
+
+ValidatorConfigStore::Scope::~Scope()
+{
+  scoped_config = std::move(previous_);
+}
+
+ValidatorConfigPtr ValidatorConfigStore::initialize(
+  const std::string & params_yaml_file, const std::string & issues_info_json_file,
+  const std::string & language)
+{
+  ValidatorConfigPtr config =
+    ValidatorConfig::load(params_yaml_file, issues_info_json_file, language);
+
+  std::lock_guard<std::mutex> lock(default_config_mutex);
+  default_config_raw.store(config.get(), std::memory_order_release);
+  default_config = config;
+  return config;
+}
+
+ValidatorConfigPtr ValidatorConfigStore::current()
+{
+  if (scoped_config) {
+    return scoped_config;
+  }
+
+  std::lock_guard<std::mutex> lock(default_config_mutex);
+  return default_config ? default_config : empty_config();
+}
+
+const ValidatorConfig & ValidatorConfigStore::current_ref()
+{
+  if (scoped_config) {
+    return *scoped_config;
+  }
+
+  const ValidatorConfig * config = default_config_raw.load(std::memory_order_acquire);
+  return config ? *config : *empty_config();
+}
+
+}  // namespace lanelet::autoware::validation
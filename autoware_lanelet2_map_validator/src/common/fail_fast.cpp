@@ -0,0 +1,64 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/fail_fast.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+FailFast::FailFast(
+  const std::vector<std::pair<std::string, lanelet::Id>> & excluded_primitives,
+  std::shared_ptr<std::atomic<bool>> run_failure, const bool fails_run)
+: excluded_primitives_(excluded_primitives.begin(), excluded_primitives.end()),
+  run_failure_(run_failure ? std::move(run_failure) : std::make_shared<std::atomic<bool>>(false)),
+  fails_run_(fails_run)
+{
+}
+
+void FailFast::report(const lanelet::validation::Issue & issue)
+{
+  if (issue.severity != lanelet::validation::Severity::Error || failed()) {
+    return;
+  }
+  if (excluded_primitives_.count({lanelet::validation::toString(issue.primitive), issue.id}) > 0) {
+    return;
+  }
+  found_error_.store(true, std::memory_order_relaxed);
+  if (fails_run_) {
+    run_failure_->store(true, std::memory_order_release);
+  }
+}
+
+void FailFast::notify_cancelled()
+{
+  if (!found_error_.load(std::memory_order_relaxed)) {
+    stopped_by_other_validator_.store(true, std::memory_order_relaxed);
+  }
+}
+
+bool has_error(const std::vector<lanelet::validation::DetectedIssues> & issues)
+{
+  return std::any_of(
+    issues.begin(), issues.end(), [](const lanelet::validation::DetectedIssues & detected_issues) {
+      return !detected_issues.errors().empty();
+    });
+}
+
+}  // namespace lanelet::autoware::validation
@@ -15,17 +15,241 @@
 #include "lanelet2_map_validator/io.hpp"
 
 #include "lanelet2_map_validator/cli.hpp"
+#include "lanelet2_map_validator/compression.hpp"
 #include "lanelet2_map_validator/embedded_defaults.hpp"
 
 #include <nlohmann/json.hpp>
 #include <pugixml.hpp>
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
 
 namespace lanelet::autoware::validation
 {
+namespace
+{
+// The <validation> element of an osm file found by scan_validation_tag()
+struct ValidationTag
+{
+  std::streamoff osm_tag_end = -1;  //<! Offset right after the start tag of <osm>
+  std::streamoff begin = -1;        //<! Start tag of the first <validation> in <osm> (if any)
+  std::streamoff end = -1;
+  bool self_closing = false;
+  std::vector<std::pair<std::string, std::string>> attributes;  //<! Raw values with their quotes
+};
+
+// Reads the characters of an osm file and counts the offset
+class MarkupReader
+{
+public:
+  explicit MarkupReader(std::istream & input) : buffer_(*input.rdbuf()) {}
+
+  bool eof() { return buffer_.sgetc() == std::char_traits<char>::eof(); }
+
+  char next()
+  {
+    const auto c = buffer_.sbumpc();
+    if (c == std::char_traits<char>::eof()) {
+      throw std::invalid_argument("Failed to load osm file!");
+    }
+    offset_++;
+    return std::char_traits<char>::to_char_type(c);
+  }
+
+  char peek()
+  {
+    const auto c = buffer_.sgetc();
+    if (c == std::char_traits<char>::eof()) {
+      throw std::invalid_argument("Failed to load osm file!");
+    }
+    return std::char_traits<char>::to_char_type(c);
+  }
+
+  void skip_past(const std::string & terminator)
+  {
+    std::string tail;
+    while (tail != terminator) {
+      tail.push_back(next());
+      if (tail.size() > terminator.size()) {
+        tail.erase(0, 1);
+      }
+    }
+  }
+
+  std::streamoff offset() const { return offset_; }
+
+private:
+  std::streambuf & buffer_;
+  std::streamoff offset_ = 0;
+};
+
+bool is_space(const char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Read the rest of a start tag after its name, and return whether it is self-closing
+bool read_attributes(
+  MarkupReader & reader, std::vector<std::pair<std::string, std::string>> & attributes)
+{
+  attributes.clear();
+  while (true) {
+    char c = reader.next();
+    if (is_space(c)) {
+      continue;
+    }
+    if (c == '>') {
+      return false;
+    }
+    if (c == '/') {
+      if (reader.next() != '>') {
+        throw std::invalid_argument("Failed to load osm file!");
+      }
+      return true;
+    }
+    std::string name(1, c);
+    while ((c = reader.next()) != '=' && !is_space(c)) {
+      name.push_back(c);
+    }
+    while (c != '=') {
+      c = reader.next();
+    }
+    while (is_space(c = reader.next())) {
+    }
+    if (c != '"' && c != '\'') {
+      throw std::invalid_argument("Failed to load osm file!");
+    }
+    std::string value(1, c);
+    const char quote = c;
+    while ((c = reader.next()) != quote) {
+      value.push_back(c);
+    }
+    value.push_back(quote);
+    attributes.emplace_back(std::move(name), std::move(value));
+  }
+}
+
+// Find the start tags of <osm> and of the first <validation> in it without building a DOM
+ValidationTag scan_validation_tag(std::istream & input)
+{
+  ValidationTag tag;
+  MarkupReader reader(input);
+  std::vector<std::pair<std::string, std::string>> attributes;
+  int depth = 0;
+  while (!reader.eof()) {
+    if (reader.next() != '<') {
+      continue;
+    }
+    const std::streamoff begin = reader.offset() - 1;
+    const char c = reader.next();
+    if (c == '?') {
+      reader.skip_past("?>");
+    } else if (c == '!') {
+      if (reader.peek() == '-') {
+        reader.skip_past("-->");
+      } else if (reader.peek() == '[') {
+        reader.skip_past("]]>");
+      } else {
+        // <!DOCTYPE ...> with an optional internal subset in brackets
+        int brackets = 0;
+        for (char d = reader.next(); d != '>' || brackets > 0; d = reader.next()) {
+          brackets += (d == '[') - (d == ']');
+        }
+      }
+    } else if (c == '/') {
+      reader.skip_past(">");
+      depth--;
+    } else {
+      std::string name(1, c);
+      while (!is_space(reader.peek()) && reader.peek() != '/' && reader.peek() != '>') {
+        name.push_back(reader.next());
+      }
+      const bool self_closing = read_attributes(reader, attributes);
+      if (depth == 0 && name == "osm") {
+        tag.osm_tag_end = reader.offset();
+      } else if (depth == 1 && name == "validation" && tag.osm_tag_end >= 0) {
+        tag.begin = begin;
+        tag.end = reader.offset();
+        tag.self_closing = self_closing;
+        tag.attributes = std::move(attributes);
+        return tag;
+      }
+      depth += self_closing ? 0 : 1;
+    }
+  }
+  if (tag.osm_tag_end < 0) {
+    throw std::invalid_argument("No <osm> tag found in the osm file!");
+  }
+  return tag;
+}
+
+void copy_bytes(std::istream & input, std::ostream & output, std::streamoff count)
+{
+  std::vector<char> buffer(1 << 16);
+  while (count != 0 && input) {
+    const std::streamsize size =
+      count < 0 ? static_cast<std::streamsize>(buffer.size())
+                : std::min<std::streamsize>(buffer.size(), count);
+    input.read(buffer.data(), size);
+    output.write(buffer.data(), input.gcount());
+    if (count > 0) {
+      count -= input.gcount();
+    }
+  }
+  if (count > 0) {
+    throw std::runtime_error("Failed to read the osm file");
+  }
+}
+
+std::string escape_attribute(const std::string & value)
+{
+  std::string escaped;
+  for (const char c : value) {
+    switch (c) {
+      case '&':
+        escaped += "&amp;";
+        break;
+      case '<':
+        escaped += "&lt;";
+        break;
+      case '>':
+        escaped += "&gt;";
+        break;
+      case '"':
+        escaped += "&quot;";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return '"' + escaped + '"';
+}
+
+// Call read(input) with the decompressed contents of the osm file
+template <typename Read>
+void read_osm_file(const std::string & osm_file, const Compression compression, Read && read)
+{
+  if (compression == Compression::NONE) {
+    std::ifstream input(osm_file, std::ios::binary);
+    if (!input.is_open()) {
+      throw std::invalid_argument("Failed to load osm file!");
+    }
+    read(input);
+  } else {
+    DecompressingInputStream input(osm_file);
+    read(input);
+    input.rethrow_error();
+  }
+}
+}  // namespace
+
 std::string get_validator_version()
 {
   return package_version_str_;
@@ -34,8 +258,16 @@ std::string get_validator_version()
 void insert_validator_info_to_map(
   std::string osm_file, std::string requirements, std::string requirements_version)
 {
+  const Compression compression = compression_of(osm_file);
   pugi::xml_document doc;
-  pugi::xml_parse_result result = doc.load_file(osm_file.c_str());
+  pugi::xml_parse_result result;
+  if (compression == Compression::NONE) {
+    result = doc.load_file(osm_file.c_str());
+  } else {
+    DecompressingInputStream input(osm_file);
+    result = doc.load(input);
+    input.rethrow_error();
+  }
 
   if (!result) {
     throw std::invalid_argument("Failed to load osm file!");
@@ -68,8 +300,95 @@ void insert_validator_info_to_map(
   set_or_append_attribute(validation_node, "requirements", requirements.c_str());
   set_or_append_attribute(validation_node, "requirements_version", requirements_version.c_str());
 
-  if (!doc.save_file(osm_file.c_str())) {
-    throw std::runtime_error("Failed to save the validator info to osm file");
+  if (compression == Compression::NONE) {
+    if (!doc.save_file(osm_file.c_str())) {
+      throw std::runtime_error("Failed to save the validator info to osm file");
+    }
+  } else {
+    // Write a temporary file first so that a failure does not leave a broken map behind
+    const std::string temporary_file = osm_file + ".tmp";
+    try {
+      CompressingOutputStream output(temporary_file, compression);
+      doc.save(output);
+      output.finish();
+      std::filesystem::rename(temporary_file, osm_file);
+    } catch (const std::exception & e) {
+      std::error_code error;
+      std::filesystem::remove(temporary_file, error);
+      throw std::runtime_error(
+        "Failed to save the validator info to osm file: " + std::string(e.what()));
+    }
+  }
+
+  std::cout << "Modified validator information in the osm file." << std::endl;
+}
+
+void stream_validator_info_to_map(
+  const std::string & osm_file, const std::string & requirements,
+  const std::string & requirements_version)
+{
+  const Compression compression = compression_of(osm_file);
+  ValidationTag tag;
+  read_osm_file(
+    osm_file, compression, [&tag](std::istream & input) { tag = scan_validation_tag(input); });
+
+  // Same attributes as insert_validator_info_to_map(), other attributes are kept
+  std::vector<std::pair<std::string, std::string>> info = {
+    {"name", "autoware_lanelet2_map_validator"},
+    {"validator_version", get_validator_version()},
+    {"requirements", requirements},
+    {"requirements_version", requirements_version}};
+  std::string validation_tag = "<validation";
+  for (const auto & [name, value] : tag.attributes) {
+    auto it = std::find_if(
+      info.begin(), info.end(), [&name = name](const auto & entry) { return entry.first == name; });
+    if (it == info.end()) {
+      validation_tag += " " + name + "=" + value;
+    } else {
+      validation_tag += " " + name + "=" + escape_attribute(it->second);
+      info.erase(it);
+    }
+  }
+  for (const auto & [name, value] : info) {
+    validation_tag += " " + name + "=" + escape_attribute(value);
+  }
+  validation_tag += (tag.begin < 0 || tag.self_closing) ? " />" : ">";
+
+  // Everything except the start tag of <validation> is copied as it is
+  const auto rewrite = [&tag, &validation_tag](std::istream & input, std::ostream & output) {
+    if (tag.begin < 0) {
+      copy_bytes(input, output, tag.osm_tag_end);
+      output << "\n  " << validation_tag;
+    } else {
+      copy_bytes(input, output, tag.begin);
+      input.ignore(tag.end - tag.begin);
+      output << validation_tag;
+    }
+    copy_bytes(input, output, -1);
+  };
+
+  const std::string temporary_file = osm_file + ".tmp";
+  try {
+    read_osm_file(osm_file, compression, [&](std::istream & input) {
+      if (compression == Compression::NONE) {
+        std::ofstream output(temporary_file, std::ios::binary | std::ios::trunc);
+        rewrite(input, output);
+        output.close();
+        if (!output) {
+          throw std::runtime_error("Failed to write " + temporary_file);
+        }
+      } else {
+        CompressingOutputStream output(temporary_file, compression);
+        rewrite(input, output);
+        output.finish();
+      }
+    });
+    std::filesystem::rename(temporary_file, osm_file);
+  } catch (const std::exception & e) {
+    std::error_code error;
+    std::filesystem::remove(temporary_file, error);
+    throw std::runtime_error(
+      "Failed to save the validator info to osm file: " + std::string(e.what()));
   }
 
   std::cout << "Modified validator information in the osm file." << std::endl;
@@ -0,0 +1,187 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/issue_cap.hpp"
+
+#include "lanelet2_map_validator/issue_message.hpp"
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+IssueCap::IssueCap(const size_t max_issues_per_code, const bool stop_at_cap)
+: IssueCap(max_issues_per_code, stop_at_cap, nullptr)
+{
+}
+
+IssueCap::IssueCap(const size_t max_issues_per_code, const bool stop_at_cap, IssueCap * parent)
+: max_issues_per_code_(max_issues_per_code), stop_at_cap_(stop_at_cap), parent_(parent)
+{
+  if (max_issues_per_code_ == 0) {
+    throw std::invalid_argument("The issue cap must be positive");
+  }
+}
+
+bool IssueCap::admit(const std::string & issue_code, const lanelet::Id primitive_id)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  CodeCount & count = counts_[issue_code];
+  if (count.admitted < max_issues_per_code_) {
+    count.admitted++;
+    return true;
+  }
+  suppress(count, issue_code, primitive_id);
+  return false;
+}
+
+std::shared_ptr<IssueCap> IssueCap::chunk_cap()
+{
+  return std::shared_ptr<IssueCap>(new IssueCap(max_issues_per_code_, stop_at_cap_, this));
+}
+
+void IssueCap::merge_chunk(
+  const IssueCap & chunk, lanelet::validation::Issues & issues, const size_t begin)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::lock_guard<std::mutex> chunk_lock(chunk.mutex_);
+
+  // The issues admitted by the chunk are the first ones of their codes within the chunk
+  size_t kept = begin;
+  for (size_t i = begin; i < issues.size(); i++) {
+    const std::string issue_code = split_issue_message(issues[i].message).issue_code;
+    const auto chunk_count = chunk.counts_.find(issue_code);
+    if (chunk_count != chunk.counts_.end() && chunk_count->second.admitted > 0) {
+      CodeCount & count = counts_[issue_code];
+      if (count.admitted < max_issues_per_code_) {
+        count.admitted++;
+      } else {
+        suppress(count, issue_code, issues[i].id);
+        continue;
+      }
+    }
+    if (kept != i) {
+      issues[kept] = std::move(issues[i]);
+    }
+    kept++;
+  }
+  issues.erase(issues.begin() + static_cast<std::ptrdiff_t>(kept), issues.end());
+
+  for (const auto & [issue_code, chunk_count] : chunk.counts_) {
+    if (chunk_count.suppressed == 0) {
+      continue;
+    }
+    CodeCount & count = counts_[issue_code];
+    count.severity = chunk_count.severity;
+    count.suppressed += chunk_count.suppressed;
+    for (const lanelet::Id id : chunk_count.sample_ids) {
+      if (count.sample_ids.size() < sample_size) {
+        count.sample_ids.push_back(id);
+      }
+    }
+    if (stop_at_cap_ && count.severity != lanelet::validation::Severity::Info) {
+      exhaust();
+    }
+  }
+}
+
+void IssueCap::suppress(
+  CodeCount & count, const std::string & issue_code, const lanelet::Id primitive_id)
+{
+  if (count.suppressed == 0) {
+    // The severity is looked up once per code, when the code first passes the cap
+    const std::string severity =
+      ValidatorConfigStore::issues_info()[issue_code]["severity"].get<std::string>();
+    if (severity == "Warning") {
+      count.severity = lanelet::validation::Severity::Warning;
+    } else if (severity != "Error") {
+      count.severity = lanelet::validation::Severity::Info;
+    }
+    if (stop_at_cap_ && count.severity != lanelet::validation::Severity::Info) {
+      exhaust();
+    }
+  }
+  count.suppressed++;
+  if (count.sample_ids.size() < sample_size) {
+    count.sample_ids.push_back(primitive_id);
+  }
+}
+
+void IssueCap::exhaust()
+{
+  exhausted_.store(true, std::memory_order_relaxed);
+  if (parent_) {
+    parent_->exhaust();
+  }
+}
+
+size_t IssueCap::suppressed_count() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t suppressed = 0;
+  for (const auto & [issue_code, count] : counts_) {
+    suppressed += count.suppressed;
+  }
+  return suppressed;
+}
+
+lanelet::validation::Issues IssueCap::summary_issues() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  lanelet::validation::Issues issues;
+  for (const auto & [issue_code, count] : counts_) {
+    if (count.suppressed == 0) {
+      continue;
+    }
+
+    std::string sample_ids;
+    for (const lanelet::Id id : count.sample_ids) {
+      sample_ids += (sample_ids.empty() ? "" : ", ") + std::to_string(id);
+    }
+    if (count.suppressed > count.sample_ids.size()) {
+      sample_ids += ", ...";
+    }
+
+    lanelet::validation::Issue issue;
+    issue.severity = count.severity;
+    issue.primitive = lanelet::validation::Primitive::Primitive;
+    issue.id = lanelet::InvalId;
+    issue.message = "[" + std::string(suppressed_issues_code) + "] " +
+                    std::to_string(count.suppressed) + " more issues of " + issue_code +
+                    " were not listed since the cap of " + std::to_string(max_issues_per_code_) +
+                    " issues per code was reached (primitive IDs: " + sample_ids + ").";
+    issues.push_back(issue);
+  }
+  return issues;
+}
+
+size_t max_issues_per_code(
+  const ValidatorConfig & config, const std::string & validator_name,
+  const size_t default_max_issues_per_code)
+{
+  const YAML::Node parameters = config.parameters();
+  if (parameters[validator_name] && parameters[validator_name]["max_issues_per_code"]) {
+    try {
+      return parameters[validator_name]["max_issues_per_code"].as<size_t>();
+    } catch (const std::exception & e) {
+      std::cerr << "Type mismatch for parameter \"max_issues_per_code\" of " << validator_name
+                << ": " << e.what() << std::endl;
+    }
+  }
+  return default_max_issues_per_code;
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,112 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/issue_locator.hpp"
+
+#include "lanelet2_map_validator/roi.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+// Keep the order of each validator, which is the order of the results
+void sort_by_validator(std::vector<nlohmann::json> & issues)
+{
+  std::stable_sort(
+    issues.begin(), issues.end(), [](const nlohmann::json & a, const nlohmann::json & b) {
+      return a.at("validator").get<std::string>() < b.at("validator").get<std::string>();
+    });
+}
+}  // namespace
+
+IssueLocator::IssueLocator(const lanelet::LaneletMap & map, const double tile_size)
+: map_(map), tile_size_(tile_size)
+{
+  if (!(tile_size > 0.0)) {
+    throw std::invalid_argument("The tile size of the issue index must be positive!");
+  }
+}
+
+void IssueLocator::annotate(
+  const lanelet::validation::Issue & issue, nlohmann::json & issue_json) const
+{
+  const auto box = issue_bounding_box(map_, issue);
+  if (!box) {
+    return;
+  }
+  const lanelet::BasicPoint2d center = box->center();
+  issue_json["position"] = {center.x(), center.y()};
+  issue_json["bounding_box"] = {box->min().x(), box->min().y(), box->max().x(), box->max().y()};
+}
+
+void IssueLocator::add_to_index(
+  const std::string & validator_name, const nlohmann::json & issue_json)
+{
+  nlohmann::json record = issue_json;
+  record["validator"] = validator_name;
+
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (!issue_json.contains("position")) {
+    unlocated_issues_.push_back(std::move(record));
+    return;
+  }
+  const auto & position = issue_json.at("position");
+  const std::pair<int64_t, int64_t> tile(
+    static_cast<int64_t>(std::floor(position.at(0).get<double>() / tile_size_)),
+    static_cast<int64_t>(std::floor(position.at(1).get<double>() / tile_size_)));
+  tiles_[tile].push_back(std::move(record));
+}
+
+nlohmann::json IssueLocator::index_json() const
+{
+  const std::lock_guard<std::mutex> lock(mutex_);
+  nlohmann::json index;
+  index["tile_size"] = tile_size_;
+  index["tiles"] = nlohmann::json::array();
+  for (const auto & [tile, issues] : tiles_) {
+    std::vector<nlohmann::json> sorted_issues = issues;
+    sort_by_validator(sorted_issues);
+    index["tiles"].push_back(
+      {{"tile", {tile.first, tile.second}},
+       {"bounds",
+        {tile.first * tile_size_, tile.second * tile_size_, (tile.first + 1) * tile_size_,
+         (tile.second + 1) * tile_size_}},
+       {"issues", sorted_issues}});
+  }
+  std::vector<nlohmann::json> unlocated_issues = unlocated_issues_;
+  sort_by_validator(unlocated_issues);
+  index["unlocated_issues"] = unlocated_issues;
+  return index;
+}
+
+void IssueLocator::write_index(const std::filesystem::path & file) const
+{
+  std::ofstream output(file);
+  output << std::setw(4) << index_json() << std::endl;
+  if (!output) {
+    throw std::runtime_error("Failed to write the issue index " + file.string());
+  }
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,66 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/issue_message.hpp"
+
+#include <fmt/args.h>
+#include <fmt/core.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+IssueMessage split_issue_message(const std::string & message)
+{
+  IssueMessage result;
+  const size_t code_end = message.find(']');
+  const size_t text_begin = code_end == std::string::npos
+                              ? std::string::npos
+                              : message.find_first_not_of(" \t", code_end + 1);
+  if (
+    message.empty() || message.front() != '[' || code_end < 2 ||
+    text_begin == std::string::npos) {
+    result.text = message;
+    return result;
+  }
+  result.issue_code = message.substr(1, code_end - 1);
+  result.text = message.substr(text_begin);
+  return result;
+}
+
+std::string render_issue_text(
+  const std::string & issue_code, const std::map<std::string, std::string> & substitutions,
+  const ValidatorConfig & config)
+{
+  const nlohmann::json & issues_info = config.issues_info();
+  const auto info = issues_info.find(issue_code);
+  if (info == issues_info.end()) {
+    throw std::invalid_argument(
+      "Issue code " + issue_code + " is not defined in the issues info!!");
+  }
+  const nlohmann::json & templates = (*info)["message"];
+  const auto localized = templates.find(config.language());
+  const std::string & format =
+    (localized != templates.end() ? *localized : templates["en"]).get_ref<const std::string &>();
+
+  fmt::dynamic_format_arg_store<fmt::format_context> arg_store;
+  for (const auto & [key, value] : substitutions) {
+    arg_store.push_back(fmt::arg(key.c_str(), value));
+  }
+  return fmt::vformat(format, arg_store);
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,465 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/lane_topology.hpp"
+
+#include "lanelet2_map_validator/thread_pool.hpp"
+
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+using Index = LaneTopology::Index;
+
+// (ID, inverted) of a bound, or (left point ID, right point ID) of an edge
+using IdPair = std::pair<lanelet::Id, lanelet::Id>;
+
+struct IdPairHash
+{
+  size_t operator()(const IdPair & pair) const
+  {
+    const size_t h1 = std::hash<lanelet::Id>{}(pair.first);
+    const size_t h2 = std::hash<lanelet::Id>{}(pair.second);
+    return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6) + (h1 >> 2));
+  }
+};
+
+using IdPairToIndices = std::unordered_map<IdPair, std::vector<Index>, IdPairHash>;
+
+IdPair bound_key(const lanelet::ConstLineString3d & bound)
+{
+  return {bound.id(), static_cast<lanelet::Id>(bound.inverted())};
+}
+
+constexpr size_t min_chunk_size = 256;
+
+// Target number of lanelets per tile for the conflict detection
+constexpr size_t lanelets_per_tile = 256;
+constexpr size_t max_tiles_per_axis = 64;
+
+bool contains(const std::vector<Index> & row, const Index index)
+{
+  return std::find(row.begin(), row.end(), index) != row.end();
+}
+
+/**
+ * @brief Pack rows of indices into CSR layout
+ */
+void pack_rows(
+  const std::vector<std::vector<Index>> & rows, std::vector<Index> & offsets,
+  std::vector<Index> & indices)
+{
+  offsets.assign(rows.size() + 1, 0);
+  for (size_t i = 0; i < rows.size(); i++) {
+    offsets[i + 1] = offsets[i] + static_cast<Index>(rows[i].size());
+  }
+  indices.clear();
+  indices.reserve(offsets.back());
+  for (const auto & row : rows) {
+    indices.insert(indices.end(), row.begin(), row.end());
+  }
+}
+
+/**
+ * @brief A uniform grid of tiles covering the bounding boxes of all lanelets
+ */
+class TileGrid
+{
+public:
+  TileGrid(const lanelet::BoundingBox2d & extent, const size_t num_lanelets)
+  : origin_(extent.min()),
+    tiles_per_axis_(std::clamp<size_t>(
+      static_cast<size_t>(std::ceil(std::sqrt(
+        static_cast<double>(num_lanelets) / static_cast<double>(lanelets_per_tile)))),
+      1, max_tiles_per_axis))
+  {
+    const lanelet::BasicPoint2d size = extent.isEmpty() ? lanelet::BasicPoint2d(1.0, 1.0)
+                                                        : lanelet::BasicPoint2d(extent.sizes());
+    tile_width_ = std::max(size.x() / static_cast<double>(tiles_per_axis_), 1e-6);
+    tile_height_ = std::max(size.y() / static_cast<double>(tiles_per_axis_), 1e-6);
+  }
+
+  size_t size() const { return tiles_per_axis_ * tiles_per_axis_; }
+
+  size_t column(const double x) const { return cell(x - origin_.x(), tile_width_); }
+  size_t row(const double y) const { return cell(y - origin_.y(), tile_height_); }
+
+  size_t tile(const size_t column, const size_t row) const
+  {
+    return row * tiles_per_axis_ + column;
+  }
+
+  size_t tile_of(const lanelet::BasicPoint2d & point) const
+  {
+    return tile(column(point.x()), row(point.y()));
+  }
+
+private:
+  size_t cell(const double offset, const double width) const
+  {
+    if (offset <= 0.0) {
+      return 0;
+    }
+    return std::min(static_cast<size_t>(offset / width), tiles_per_axis_ - 1);
+  }
+
+  lanelet::BasicPoint2d origin_;
+  size_t tiles_per_axis_;
+  double tile_width_;
+  double tile_height_;
+};
+}  // namespace
+
+LaneTopology LaneTopology::build(
+  const lanelet::LaneletMap & map, const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const std::optional<double> & participant_height)
+{
+  LaneTopology topology;
+
+  // Collect passable lanelets. Lanelets that are not one-way are added in both directions.
+  // The traffic rules are evaluated in parallel and the results are merged in the map order.
+  const std::vector<lanelet::ConstLanelet> map_lanelets(
+    map.laneletLayer.begin(), map.laneletLayer.end());
+
+  // The overlap checks below fill the lazily computed centerlines of lanelets shared by several
+  // tasks, so they are computed here first
+  for (const lanelet::ConstLanelet & lanelet : map_lanelets) {
+    lanelet.centerline();
+  }
+  std::vector<lanelet::ConstLanelets> directed_lanelets(map_lanelets.size());
+  parallel_for(
+    map_lanelets.size(),
+    [&](const size_t i) {
+      const lanelet::ConstLanelet & lanelet = map_lanelets[i];
+      if (traffic_rules.canPass(lanelet)) {
+        directed_lanelets[i].push_back(lanelet);
+      }
+      if (!traffic_rules.isOneWay(lanelet)) {
+        const lanelet::ConstLanelet inverted = lanelet.invert();
+        if (traffic_rules.canPass(inverted)) {
+          directed_lanelets[i].push_back(inverted);
+        }
+      }
+    },
+    min_chunk_size);
+
+  for (const auto & lanelets : directed_lanelets) {
+    for (const auto & lanelet : lanelets) {
+      auto & index_map = lanelet.inverted() ? topology.inverted_index_ : topology.forward_index_;
+      index_map[lanelet.id()] = static_cast<Index>(topology.lanelets_.size());
+      topology.lanelets_.push_back(lanelet);
+    }
+  }
+
+  const auto & lanelets = topology.lanelets_;
+  const size_t num_lanelets = lanelets.size();
+
+  // Index the lanelets by their starting edges and by their bounds
+  IdPairToIndices starting_edge_to_lanelets;
+  IdPairToIndices left_bound_to_lanelets;
+  IdPairToIndices right_bound_to_lanelets;
+  for (Index i = 0; i < num_lanelets; i++) {
+    const auto left_bound = lanelets[i].leftBound();
+    const auto right_bound = lanelets[i].rightBound();
+    if (left_bound.empty() || right_bound.empty()) {
+      continue;
+    }
+    starting_edge_to_lanelets[{left_bound.front().id(), right_bound.front().id()}].push_back(i);
+    left_bound_to_lanelets[bound_key(left_bound)].push_back(i);
+    right_bound_to_lanelets[bound_key(right_bound)].push_back(i);
+  }
+
+  // Detect the relations of each lanelet in parallel. Each task only writes to its own slot.
+  std::vector<std::vector<Index>> following(num_lanelets);
+  std::vector<lanelet::BoundingBox2d> boxes(num_lanelets);
+  topology.left_.assign(num_lanelets, invalid_index);
+  topology.right_.assign(num_lanelets, invalid_index);
+  topology.adjacent_left_.assign(num_lanelets, invalid_index);
+  topology.adjacent_right_.assign(num_lanelets, invalid_index);
+
+  parallel_for(
+    num_lanelets,
+    [&](const size_t i) {
+      const lanelet::ConstLanelet & lanelet = lanelets[i];
+      const auto left_bound = lanelet.leftBound();
+      const auto right_bound = lanelet.rightBound();
+      if (left_bound.empty() || right_bound.empty()) {
+        return;
+      }
+      boxes[i] = lanelet::geometry::boundingBox2d(lanelet);
+
+      // Following lanelets start from the ending edge of this lanelet
+      const auto ending_edge =
+        starting_edge_to_lanelets.find({left_bound.back().id(), right_bound.back().id()});
+      if (ending_edge != starting_edge_to_lanelets.end()) {
+        for (const Index j : ending_edge->second) {
+          if (lanelets[j].id() != lanelet.id() && traffic_rules.canPass(lanelet, lanelets[j])) {
+            following[i].push_back(j);
+          }
+        }
+      }
+
+      // Sideways lanelets share a bound in the same direction
+      const auto assign_sideways = [&](
+                                     const IdPairToIndices & bound_to_lanelets, const IdPair & key,
+                                     std::vector<Index> & lane_change,
+                                     std::vector<Index> & adjacent) {
+        const auto it = bound_to_lanelets.find(key);
+        if (it == bound_to_lanelets.end()) {
+          return;
+        }
+        for (const Index j : it->second) {
+          if (lanelets[j].id() == lanelet.id()) {
+            continue;
+          }
+          if (traffic_rules.canChangeLane(lanelet, lanelets[j])) {
+            if (lane_change[i] == invalid_index) {
+              lane_change[i] = j;
+            }
+          } else if (adjacent[i] == invalid_index) {
+            adjacent[i] = j;
+          }
+        }
+      };
+      assign_sideways(
+        right_bound_to_lanelets, bound_key(left_bound), topology.left_, topology.adjacent_left_);
+      assign_sideways(
+        left_bound_to_lanelets, bound_key(right_bound), topology.right_, topology.adjacent_right_);
+    },
+    min_chunk_size);
+
+  // Detect conflicting lanelets, which are overlapping lanelets without any other relation. With
+  // participant_height, they have to overlap in 3D so that a bridge does not conflict with the
+  // road under it.
+  // The map is split into tiles that are searched in parallel. A pair of lanelets may share
+  // several tiles, so it is only checked by the tile containing the lower corner of the
+  // intersection of their bounding boxes. This makes the result independent of the scheduling.
+  lanelet::BoundingBox2d extent;
+  for (const auto & box : boxes) {
+    if (!box.isEmpty()) {
+      extent.extend(box);
+    }
+  }
+  const TileGrid grid(extent, num_lanelets);
+
+  std::vector<std::vector<Index>> tile_members(grid.size());
+  for (Index i = 0; i < num_lanelets; i++) {
+    const auto & box = boxes[i];
+    if (box.isEmpty()) {
+      continue;
+    }
+    for (size_t row = grid.row(box.min().y()); row <= grid.row(box.max().y()); row++) {
+      for (size_t column = grid.column(box.min().x()); column <= grid.column(box.max().x());
+           column++) {
+        tile_members[grid.tile(column, row)].push_back(i);
+      }
+    }
+  }
+
+  const auto has_other_relation = [&](const Index i, const Index j) {
+    return contains(following[i], j) || contains(following[j], i) || topology.left_[i] == j ||
+           topology.right_[i] == j || topology.adjacent_left_[i] == j ||
+           topology.adjacent_right_[i] == j || topology.left_[j] == i ||
+           topology.right_[j] == i || topology.adjacent_left_[j] == i ||
+           topology.adjacent_right_[j] == i;
+  };
+
+  std::vector<std::vector<std::pair<Index, Index>>> tile_conflicts(grid.size());
+  parallel_for(grid.size(), [&](const size_t tile) {
+    // Sweep the members sorted by the lower x coordinate of their bounding boxes
+    std::vector<Index> members = tile_members[tile];
+    std::sort(members.begin(), members.end(), [&](const Index a, const Index b) {
+      return boxes[a].min().x() < boxes[b].min().x();
+    });
+    for (size_t a = 0; a < members.size(); a++) {
+      const Index i = members[a];
+      for (size_t b = a + 1; b < members.size(); b++) {
+        const Index j = members[b];
+        if (boxes[j].min().x() > boxes[i].max().x()) {
+          break;
+        }
+        if (!boxes[i].intersects(boxes[j]) || lanelets[i].id() == lanelets[j].id()) {
+          continue;
+        }
+        const lanelet::BasicPoint2d lower_corner = boxes[i].min().cwiseMax(boxes[j].min());
+        if (grid.tile_of(lower_corner) != tile || has_other_relation(i, j)) {
+          continue;
+        }
+        const bool overlaps =
+          participant_height
+            ? lanelet::geometry::overlaps3d(lanelets[i], lanelets[j], *participant_height)
+            : lanelet::geometry::overlaps2d(lanelets[i], lanelets[j]);
+        if (overlaps) {
+          tile_conflicts[tile].emplace_back(i, j);
+        }
+      }
+    }
+  });
+
+  std::vector<std::vector<Index>> conflicting(num_lanelets);
+  for (const auto & conflicts : tile_conflicts) {
+    for (const auto & [i, j] : conflicts) {
+      conflicting[i].push_back(j);
+      conflicting[j].push_back(i);
+    }
+  }
+  for (auto & row : conflicting) {
+    std::sort(row.begin(), row.end());
+  }
+
+  // Pack the relations into CSR layout
+  pack_rows(following, topology.following_offsets_, topology.following_indices_);
+  pack_rows(conflicting, topology.conflicting_offsets_, topology.conflicting_indices_);
+
+  // The previous relations are the transpose of the following relations
+  topology.previous_offsets_.assign(num_lanelets + 1, 0);
+  for (const Index j : topology.following_indices_) {
+    topology.previous_offsets_[j + 1]++;
+  }
+  for (size_t i = 0; i < num_lanelets; i++) {
+    topology.previous_offsets_[i + 1] += topology.previous_offsets_[i];
+  }
+  topology.previous_indices_.resize(topology.following_indices_.size());
+  std::vector<Index> cursor(
+    topology.previous_offsets_.begin(), topology.previous_offsets_.end() - 1);
+  for (Index i = 0; i < num_lanelets; i++) {
+    for (const Index j : following[i]) {
+      topology.previous_indices_[cursor[j]++] = i;
+    }
+  }
+
+  return topology;
+}
+
+lanelet::ConstLanelets LaneTopology::following(const lanelet::ConstLanelet & lanelet) const
+{
+  return lanelets_in_row(following_offsets_, following_indices_, index_of(lanelet));
+}
+
+lanelet::ConstLanelets LaneTopology::previous(const lanelet::ConstLanelet & lanelet) const
+{
+  return lanelets_in_row(previous_offsets_, previous_indices_, index_of(lanelet));
+}
+
+lanelet::Optional<lanelet::ConstLanelet> LaneTopology::left(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  return sideways_lanelet(left_, lanelet);
+}
+
+lanelet::Optional<lanelet::ConstLanelet> LaneTopology::right(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  return sideways_lanelet(right_, lanelet);
+}
+
+lanelet::Optional<lanelet::ConstLanelet> LaneTopology::adjacentLeft(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  return sideways_lanelet(adjacent_left_, lanelet);
+}
+
+lanelet::Optional<lanelet::ConstLanelet> LaneTopology::adjacentRight(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  return sideways_lanelet(adjacent_right_, lanelet);
+}
+
+lanelet::ConstLanelets LaneTopology::conflicting(const lanelet::ConstLanelet & lanelet) const
+{
+  return lanelets_in_row(conflicting_offsets_, conflicting_indices_, index_of(lanelet));
+}
+
+lanelet::Optional<lanelet::routing::RelationType> LaneTopology::routingRelation(
+  const lanelet::ConstLanelet & from, const lanelet::ConstLanelet & to,
+  const bool include_conflicting) const
+{
+  using lanelet::routing::RelationType;
+
+  const Index i = index_of(from);
+  const Index j = index_of(to);
+  if (i == invalid_index || j == invalid_index) {
+    return {};
+  }
+
+  const auto in_row = [j](const std::vector<Index> & offsets, const std::vector<Index> & indices,
+                          const Index row) {
+    return std::find(indices.begin() + offsets[row], indices.begin() + offsets[row + 1], j) !=
+           indices.begin() + offsets[row + 1];
+  };
+
+  if (in_row(following_offsets_, following_indices_, i)) {
+    return RelationType::Successor;
+  }
+  if (left_[i] == j) {
+    return RelationType::Left;
+  }
+  if (right_[i] == j) {
+    return RelationType::Right;
+  }
+  if (adjacent_left_[i] == j) {
+    return RelationType::AdjacentLeft;
+  }
+  if (adjacent_right_[i] == j) {
+    return RelationType::AdjacentRight;
+  }
+  if (include_conflicting && in_row(conflicting_offsets_, conflicting_indices_, i)) {
+    return RelationType::Conflicting;
+  }
+  return {};
+}
+
+LaneTopology::Index LaneTopology::index_of(const lanelet::ConstLanelet & lanelet) const
+{
+  const auto & index_map = lanelet.inverted() ? inverted_index_ : forward_index_;
+  const auto it = index_map.find(lanelet.id());
+  return (it != index_map.end()) ? it->second : invalid_index;
+}
+
+lanelet::ConstLanelets LaneTopology::lanelets_in_row(
+  const std::vector<Index> & offsets, const std::vector<Index> & indices, const Index row) const
+{
+  lanelet::ConstLanelets result;
+  if (row == invalid_index) {
+    return result;
+  }
+  result.reserve(offsets[row + 1] - offsets[row]);
+  for (Index k = offsets[row]; k < offsets[row + 1]; k++) {
+    result.push_back(lanelets_[indices[k]]);
+  }
+  return result;
+}
+
+lanelet::Optional<lanelet::ConstLanelet> LaneTopology::sideways_lanelet(
+  const std::vector<Index> & sideways, const lanelet::ConstLanelet & lanelet) const
+{
+  const Index index = index_of(lanelet);
+  if (index == invalid_index || sideways[index] == invalid_index) {
+    return {};
+  }
+  return lanelets_[sideways[index]];
+}
+
+}  // namespace lanelet::autoware::validation
@@ -14,11 +14,30 @@
 
 #include "lanelet2_map_validator/map_loader.hpp"
 
+#include "lanelet2_map_validator/compression.hpp"
+#include "lanelet2_map_validator/projection.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
+
 #include <autoware_lanelet2_extension/projection/mgrs_projector.hpp>
 #include <autoware_lanelet2_extension/projection/transverse_mercator_projector.hpp>
+#include <lanelet2_io/io_handlers/OsmFile.h>
+#include <lanelet2_io/io_handlers/OsmHandler.h>
+#include <pugixml.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -33,8 +52,190 @@ constexpr const char * mgrs = "mgrs";
 constexpr const char * transverse_mercator = "transverse_mercator";
 constexpr const char * utm = "utm";
 }  // namespace projector_names
+
+constexpr const char * layers_parameter = "layers";
+
+std::string tag_value(const pugi::xml_node & element, const char * key)
+{
+  for (const pugi::xml_node tag : element.children("tag")) {
+    if (std::strcmp(tag.attribute("k").value(), key) == 0) {
+      return tag.attribute("v").value();
+    }
+  }
+  return "";
+}
 }  // namespace
 
+MapLayers MapLayers::all()
+{
+  return MapLayers::from_names(
+    {"points", "linestrings", "polygons", "lanelets", "areas", "regulatory_elements"});
+}
+
+MapLayers MapLayers::from_names(const std::vector<std::string> & names)
+{
+  MapLayers layers;
+  for (const auto & name : names) {
+    if (name == "points") {
+      layers.points = true;
+    } else if (name == "linestrings") {
+      layers.linestrings = true;
+    } else if (name == "polygons") {
+      layers.polygons = true;
+    } else if (name == "lanelets") {
+      layers.lanelets = true;
+    } else if (name == "areas") {
+      layers.areas = true;
+    } else if (name == "regulatory_elements") {
+      layers.regulatory_elements = true;
+    } else {
+      throw std::invalid_argument("Unknown map layer \"" + name + "\"");
+    }
+  }
+  return layers;
+}
+
+std::vector<std::string> MapLayers::names() const
+{
+  std::vector<std::string> names;
+  const std::pair<bool, const char *> layers[] = {
+    {points, "points"}, {linestrings, "linestrings"}, {polygons, "polygons"},
+    {lanelets, "lanelets"}, {areas, "areas"}, {regulatory_elements, "regulatory_elements"}};
+  for (const auto & [needed, name] : layers) {
+    if (needed) {
+      names.emplace_back(name);
+    }
+  }
+  return names;
+}
+
+bool MapLayers::is_all() const
+{
+  return points && linestrings && polygons && lanelets && areas && regulatory_elements;
+}
+
+MapLayers & MapLayers::operator|=(const MapLayers & other)
+{
+  points |= other.points;
+  linestrings |= other.linestrings;
+  polygons |= other.polygons;
+  lanelets |= other.lanelets;
+  areas |= other.areas;
+  regulatory_elements |= other.regulatory_elements;
+  return *this;
+}
+
+std::optional<MapLayers> required_map_layers(
+  const ValidatorConfig & config, const std::vector<std::string> & validator_names)
+{
+  const YAML::Node parameters = config.parameters();
+  MapLayers layers;
+  for (const auto & name : validator_names) {
+    if (!parameters[name] || !parameters[name][layers_parameter]) {
+      return std::nullopt;
+    }
+    try {
+      layers |=
+        MapLayers::from_names(parameters[name][layers_parameter].as<std::vector<std::string>>());
+    } catch (const std::exception & e) {
+      std::cerr << "Invalid parameter \"" << layers_parameter << "\" of " << name << ": "
+                << e.what() << std::endl;
+      std::cerr << "The whole map is loaded." << std::endl;
+      return std::nullopt;
+    }
+  }
+  if (layers.is_all()) {
+    return std::nullopt;
+  }
+  return layers;
+}
+
+size_t remove_unneeded_osm_elements(pugi::xml_node osm_node, const MapLayers & layers)
+{
+  std::unordered_map<lanelet::Id, pugi::xml_node> ways;
+  std::unordered_map<lanelet::Id, pugi::xml_node> relations;
+  std::unordered_set<lanelet::Id> kept_nodes;
+  std::unordered_set<lanelet::Id> kept_ways;
+  std::unordered_set<lanelet::Id> kept_relations;
+  std::vector<pugi::xml_node> unvisited;  // Kept ways and relations whose members are not kept yet
+
+  // Keep the elements of the layers. The types are judged in the same way as lanelet2 does.
+  for (const pugi::xml_node element : osm_node.children()) {
+    const std::string element_name = element.name();
+    const lanelet::Id id = element.attribute("id").as_llong();
+    if (element_name == "node") {
+      if (layers.points) {
+        kept_nodes.insert(id);
+      }
+    } else if (element_name == "way") {
+      ways.emplace(id, element);
+      const std::string area = tag_value(element, "area");
+      const bool is_polygon = area == "true" || area == "yes" || area == "1";
+      if (is_polygon ? layers.polygons : layers.linestrings) {
+        kept_ways.insert(id);
+        unvisited.push_back(element);
+      }
+    } else if (element_name == "relation") {
+      relations.emplace(id, element);
+      const std::string type = tag_value(element, "type");
+      if (
+        (type == "lanelet" && layers.lanelets) || (type == "multipolygon" && layers.areas) ||
+        (type == "regulatory_element" && layers.regulatory_elements)) {
+        kept_relations.insert(id);
+        unvisited.push_back(element);
+      }
+    }
+  }
+
+  // Keep everything the kept elements refer to
+  const auto keep = [&unvisited](
+                      const lanelet::Id id, std::unordered_set<lanelet::Id> & kept,
+                      const std::unordered_map<lanelet::Id, pugi::xml_node> & elements) {
+    if (!kept.insert(id).second) {
+      return;
+    }
+    if (const auto it = elements.find(id); it != elements.end()) {
+      unvisited.push_back(it->second);
+    }
+  };
+  while (!unvisited.empty()) {
+    const pugi::xml_node element = unvisited.back();
+    unvisited.pop_back();
+    for (const pugi::xml_node child : element.children()) {
+      const std::string child_name = child.name();
+      const lanelet::Id ref = child.attribute("ref").as_llong();
+      if (child_name == "nd") {
+        kept_nodes.insert(ref);
+      } else if (child_name == "member") {
+        const std::string member_type = child.attribute("type").value();
+        if (member_type == "node") {
+          kept_nodes.insert(ref);
+        } else if (member_type == "way") {
+          keep(ref, kept_ways, ways);
+        } else if (member_type == "relation") {
+          keep(ref, kept_relations, relations);
+        }
+      }
+    }
+  }
+
+  size_t removed_count = 0;
+  for (pugi::xml_node element = osm_node.first_child(); element;) {
+    const pugi::xml_node next = element.next_sibling();
+    const std::string element_name = element.name();
+    const lanelet::Id id = element.attribute("id").as_llong();
+    const bool removed = (element_name == "node" && kept_nodes.count(id) == 0) ||
+                         (element_name == "way" && kept_ways.count(id) == 0) ||
+                         (element_name == "relation" && kept_relations.count(id) == 0);
+    if (removed) {
+      osm_node.remove_child(element);
+      removed_count++;
+    }
+    element = next;
+  }
+  return removed_count;
+}
+
 std::unique_ptr<lanelet::Projector> getProjector(
   const std::string & projector_type, const lanelet::GPSPoint & origin)
 
@@ -52,10 +253,219 @@ std::unique_ptr<lanelet::Projector> getProjector(
   return nullptr;
 }
 
+namespace
+{
+constexpr size_t min_projection_chunk_size = 4096;
+
+struct GpsPointHash
+{
+  size_t operator()(const lanelet::GPSPoint & gps) const
+  {
+    size_t seed = std::hash<double>{}(gps.lat);
+    for (const double value : {gps.lon, gps.ele}) {
+      seed ^= std::hash<double>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+
+struct GpsPointEqual
+{
+  bool operator()(const lanelet::GPSPoint & a, const lanelet::GPSPoint & b) const
+  {
+    return a.lat == b.lat && a.lon == b.lon && a.ele == b.ele;
+  }
+};
+
+using ProjectedPoints =
+  std::unordered_map<lanelet::GPSPoint, lanelet::BasicPoint3d, GpsPointHash, GpsPointEqual>;
+
+/**
+ * @brief A projector returning the positions of the points projected beforehand.
+ *
+ * lanelet2 projects the nodes one by one while it builds the map, so the nodes are projected in
+ * parallel batches before and only looked up here. Points that were not projected beforehand (or
+ * whose projection failed) are projected by the original projector, so the map matches the one of
+ * the original projector within the accuracy of BatchProjector and the loading issues are the
+ * same.
+ */
+class ProjectedPointsProjector : public lanelet::Projector
+{
+public:
+  ProjectedPointsProjector(const lanelet::Projector & projector, ProjectedPoints points)
+  : lanelet::Projector(projector.origin()), projector_(projector), points_(std::move(points))
+  {
+  }
+
+  lanelet::BasicPoint3d forward(const lanelet::GPSPoint & gps) const override
+  {
+    if (const auto it = points_.find(gps); it != points_.end()) {
+      return it->second;
+    }
+    return projector_.forward(gps);
+  }
+
+  lanelet::GPSPoint reverse(const lanelet::BasicPoint3d & point) const override
+  {
+    return projector_.reverse(point);
+  }
+
+private:
+  const lanelet::Projector & projector_;
+  ProjectedPoints points_;
+};
+
+// The coordinates of the <node> elements of an OSM document, read in parallel
+std::vector<lanelet::GPSPoint> read_node_coordinates(const pugi::xml_node & osm_node)
+{
+  std::vector<pugi::xml_node> nodes;
+  for (const pugi::xml_node node : osm_node.children("node")) {
+    nodes.push_back(node);
+  }
+  std::vector<lanelet::GPSPoint> points(nodes.size());
+  parallel_for(
+    nodes.size(),
+    [&](const size_t i) {
+      points[i].lat = nodes[i].attribute("lat").as_double(0.0);
+      points[i].lon = nodes[i].attribute("lon").as_double(0.0);
+      points[i].ele =
+        nodes[i].find_child_by_attribute("tag", "k", "ele").attribute("v").as_double(0.0);
+    },
+    min_projection_chunk_size);
+  return points;
+}
+
+// Project the points in parallel chunks with BatchProjector. The points it leaves out are
+// projected with a scalar projector for each chunk, since the projectors are not thread-safe.
+ProjectedPoints project_points(
+  const std::vector<lanelet::GPSPoint> & points, const std::string & projector_type,
+  const lanelet::GPSPoint & origin)
+{
+  const auto batch_projector = BatchProjector::create(projector_type, origin);
+  const size_t num_chunks = parallel_chunk_count(points.size(), min_projection_chunk_size);
+  std::vector<std::vector<std::pair<lanelet::GPSPoint, lanelet::BasicPoint3d>>> chunk_points(
+    num_chunks);
+  parallel_for_chunks(
+    points.size(), num_chunks, [&](const size_t chunk, const size_t begin, const size_t end) {
+      const size_t size = end - begin;
+      std::vector<double> lat(size);
+      std::vector<double> lon(size);
+      std::vector<double> ele(size);
+      for (size_t i = 0; i < size; i++) {
+        lat[i] = points[begin + i].lat;
+        lon[i] = points[begin + i].lon;
+        ele[i] = points[begin + i].ele;
+      }
+      std::vector<double> x(size, std::numeric_limits<double>::quiet_NaN());
+      std::vector<double> y(size, std::numeric_limits<double>::quiet_NaN());
+      std::vector<double> z(size, std::numeric_limits<double>::quiet_NaN());
+      if (batch_projector) {
+        batch_projector->forward(
+          size, lat.data(), lon.data(), ele.data(), x.data(), y.data(), z.data());
+      }
+
+      std::unique_ptr<lanelet::Projector> projector;
+      auto & projected = chunk_points[chunk];
+      projected.reserve(size);
+      for (size_t i = 0; i < size; i++) {
+        const lanelet::GPSPoint & point = points[begin + i];
+        if (!std::isnan(x[i])) {
+          projected.emplace_back(point, lanelet::BasicPoint3d(x[i], y[i], z[i]));
+          continue;
+        }
+        if (!projector) {
+          projector = getProjector(projector_type, origin);
+        }
+        try {
+          projected.emplace_back(point, projector->forward(point));
+        } catch (const std::exception &) {
+          // lanelet2 projects the point again and handles the error
+        }
+      }
+    });
+
+  ProjectedPoints projected_points;
+  projected_points.reserve(points.size());
+  for (const auto & chunk : chunk_points) {
+    projected_points.insert(chunk.begin(), chunk.end());
+  }
+  return projected_points;
+}
+
+// Make the IDs of the map known to lanelet::utils::getId() as lanelet::load() does
+void register_ids(const lanelet::LaneletMap & map)
+{
+  lanelet::Id max_id = lanelet::InvalId;
+  const auto update = [&max_id](const auto & layer) {
+    for (const auto & primitive : layer) {
+      max_id = std::max(max_id, primitive.id());
+    }
+  };
+  update(map.pointLayer);
+  update(map.lineStringLayer);
+  update(map.polygonLayer);
+  update(map.laneletLayer);
+  update(map.areaLayer);
+  for (const auto & regulatory_element : map.regulatoryElementLayer) {
+    max_id = std::max(max_id, regulatory_element->id());
+  }
+  if (max_id != lanelet::InvalId) {
+    lanelet::utils::registerId(max_id);
+  }
+}
+
+// Same as lanelet::load() for .osm files, but the document is read here so that a compressed file
+// is decompressed on a background thread while pugixml reads it, so that the elements of unneeded
+// layers are removed before lanelet2 builds and projects them, and so that the nodes are projected
+// in parallel from the same document that lanelet2 reads
+lanelet::LaneletMapPtr load_osm_map(
+  const std::string & map_file, const lanelet::Projector & projector,
+  const std::string & projector_type, const lanelet::GPSPoint & origin,
+  const std::optional<MapLayers> & layers, lanelet::ErrorMessages & errors)
+{
+  pugi::xml_document doc;
+  try {
+    pugi::xml_parse_result result;
+    if (compression_of(map_file) == Compression::NONE) {
+      result = doc.load_file(map_file.c_str());
+    } else {
+      DecompressingInputStream input(map_file);
+      result = doc.load(input);
+      input.rethrow_error();
+    }
+    if (!result) {
+      errors.push_back("Failed to parse " + map_file + ": " + result.description());
+      return nullptr;
+    }
+  } catch (const std::runtime_error & e) {
+    errors.push_back(e.what());
+    return nullptr;
+  }
+
+  if (layers) {
+    remove_unneeded_osm_elements(doc.child("osm"), *layers);
+  }
+
+  const ProjectedPointsProjector projected_points_projector(
+    projector, project_points(read_node_coordinates(doc.child("osm")), projector_type, origin));
+
+  lanelet::osm::Errors osm_errors;
+  const lanelet::osm::File file = lanelet::osm::read(doc, &osm_errors);
+  lanelet::LaneletMapPtr map =
+    lanelet::io_handlers::OsmParser(projected_points_projector).fromOsmFile(file, errors);
+  errors.insert(errors.begin(), osm_errors.begin(), osm_errors.end());
+  if (map) {
+    register_ids(*map);
+  }
+  return map;
+}
+}  // namespace
+
 std::pair<lanelet::LaneletMapPtr, std::vector<lanelet::validation::DetectedIssues>>
 loadAndValidateMap(
   const std::string & projector_type, const std::string & map_file,
-  const lanelet::validation::ValidationConfig & val_config)
+  const lanelet::validation::ValidationConfig & val_config,
+  const std::optional<MapLayers> & layers)
 {
   std::vector<lanelet::validation::DetectedIssues> issues;
   lanelet::LaneletMapPtr map{nullptr};
@@ -64,6 +474,11 @@ loadAndValidateMap(
     const auto projector = getProjector(projector_type, val_config.origin);
     if (!projector) {
       errors.push_back("No valid map projection type specified!");
+    } else if (
+      layers || compression_of(map_file) != Compression::NONE ||
+      std::filesystem::path(map_file).extension() == ".osm") {
+      map = load_osm_map(
+        map_file, *projector, projector_type, val_config.origin, layers, errors);
     } else {
       map = lanelet::load(map_file, *projector, &errors);
     }
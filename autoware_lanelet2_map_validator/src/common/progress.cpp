@@ -0,0 +1,158 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/progress.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+std::mutex progress_mutex;
+FILE * progress_stream = nullptr;
+bool owns_progress_stream = false;
+std::atomic<bool> progress_open{false};
+std::chrono::steady_clock::time_point progress_start;
+
+double milliseconds_since(const std::chrono::steady_clock::time_point & start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+    .count();
+}
+}  // namespace
+
+void open_progress_stream(const std::string & target)
+{
+  FILE * stream = nullptr;
+  bool owns_stream = false;
+  if (target == "stdout") {
+    // The events take over the standard output, and everything else written to it (e.g. the issues
+    // printed by the validator) goes to the standard error so that the events stay parsable
+    std::fflush(stdout);
+    const int fd = dup(STDOUT_FILENO);
+    stream = fd >= 0 ? fdopen(fd, "w") : nullptr;
+    if (!stream || dup2(STDERR_FILENO, STDOUT_FILENO) < 0) {
+      if (stream) {
+        std::fclose(stream);
+      }
+      throw std::runtime_error("Failed to redirect the standard output for progress");
+    }
+    owns_stream = true;
+  } else {
+    size_t parsed_length = 0;
+    int fd = -1;
+    try {
+      fd = std::stoi(target, &parsed_length);
+    } catch (const std::exception &) {
+      parsed_length = 0;
+    }
+    if (parsed_length != target.size() || fd < 0) {
+      throw std::invalid_argument(
+        "Invalid progress target " + target + " (must be stdout or a file descriptor number)");
+    }
+    stream = fdopen(fd, "w");
+    if (!stream) {
+      throw std::invalid_argument("Failed to open file descriptor " + target + " for progress");
+    }
+    owns_stream = true;
+  }
+
+  close_progress_stream();
+  std::lock_guard<std::mutex> lock(progress_mutex);
+  progress_stream = stream;
+  owns_progress_stream = owns_stream;
+  progress_start = std::chrono::steady_clock::now();
+  progress_open = true;
+}
+
+void close_progress_stream()
+{
+  std::lock_guard<std::mutex> lock(progress_mutex);
+  progress_open = false;
+  if (progress_stream && owns_progress_stream) {
+    std::fclose(progress_stream);
+  }
+  progress_stream = nullptr;
+  owns_progress_stream = false;
+}
+
+bool progress_enabled()
+{
+  return progress_open;
+}
+
+void report_progress(const std::string & event, const nlohmann::json & fields)
+{
+  if (!progress_open) {
+    return;
+  }
+
+  try {
+    nlohmann::json record = fields.is_object() ? fields : nlohmann::json::object();
+    record["event"] = event;
+
+    std::lock_guard<std::mutex> lock(progress_mutex);
+    if (!progress_stream) {
+      return;
+    }
+    record["time_ms"] = milliseconds_since(progress_start);
+    const std::string line = record.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+    std::fputs(line.c_str(), progress_stream);
+    std::fputc('\n', progress_stream);
+    std::fflush(progress_stream);
+  } catch (...) {
+    // Progress is informative only and must never break the validation
+  }
+}
+
+ProgressPhase::ProgressPhase(std::string phase)
+: phase_(std::move(phase)), start_(std::chrono::steady_clock::now())
+{
+  report_progress("phase_started", {{"phase", phase_}});
+}
+
+ProgressPhase::~ProgressPhase()
+{
+  if (!finished_) {
+    report_progress(
+      "phase_finished",
+      {{"phase", phase_}, {"elapsed_ms", milliseconds_since(start_)}, {"aborted", true}});
+  }
+}
+
+void ProgressPhase::finish(const nlohmann::json & fields)
+{
+  if (finished_) {
+    return;
+  }
+  finished_ = true;
+
+  nlohmann::json record = fields.is_object() ? fields : nlohmann::json::object();
+  record["phase"] = phase_;
+  record["elapsed_ms"] = milliseconds_since(start_);
+  report_progress("phase_finished", record);
+}
+
+}  // namespace lanelet::autoware::validation
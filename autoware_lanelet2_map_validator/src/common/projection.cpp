@@ -0,0 +1,241 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/projection.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+
+namespace
+{
+constexpr double wgs84_a = 6378137.0;
+constexpr double wgs84_f = 1.0 / 298.257223563;
+constexpr double utm_k0 = 0.9996;
+constexpr double utm_false_easting = 5e5;
+constexpr double utm_false_northing_south = 1e7;
+constexpr double min_utm_latitude = -80.0;
+constexpr double max_utm_latitude = 84.0;
+constexpr double max_longitude_difference = 3.5;
+constexpr double mgrs_square_size = 1e5;
+// Points closer than this to a 100 km line of the MGRS grid are left to the scalar projector, whose
+// result may fall on the other side of the line
+constexpr double mgrs_square_margin = 1e-6;
+constexpr double degree = 3.14159265358979323846 / 180.0;
+constexpr int series_order = 6;
+constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+struct KruegerSeries
+{
+  double e;                                     // Eccentricity
+  double scale;                                 // k0 times the rectifying radius
+  std::array<double, series_order + 1> alpha;  // alpha[0] is unused
+};
+
+// The series of GeographicLib::TransverseMercator for WGS84 (Karney, 2011, Eq. 35)
+const KruegerSeries & krueger_series()
+{
+  static const KruegerSeries series = [] {
+    const double n = wgs84_f / (2.0 - wgs84_f);
+    const double n2 = n * n;
+    KruegerSeries krueger{};
+    krueger.e = std::sqrt(wgs84_f * (2.0 - wgs84_f));
+    krueger.scale = utm_k0 * wgs84_a / (1.0 + n) *
+                    (1.0 + n2 * (1.0 / 4.0 + n2 * (1.0 / 64.0 + n2 * (1.0 / 256.0))));
+    krueger.alpha[1] =
+      n * (1.0 / 2.0 +
+           n * (-2.0 / 3.0 +
+                n * (5.0 / 16.0 +
+                     n * (41.0 / 180.0 + n * (-127.0 / 288.0 + n * 7891.0 / 37800.0)))));
+    krueger.alpha[2] =
+      n2 * (13.0 / 48.0 +
+            n * (-3.0 / 5.0 +
+                 n * (557.0 / 1440.0 + n * (281.0 / 630.0 + n * -1983433.0 / 1935360.0))));
+    krueger.alpha[3] =
+      n2 * n *
+      (61.0 / 240.0 + n * (-103.0 / 140.0 + n * (15061.0 / 26880.0 + n * 167603.0 / 181440.0)));
+    krueger.alpha[4] =
+      n2 * n2 * (49561.0 / 161280.0 + n * (-179.0 / 168.0 + n * 6601661.0 / 7257600.0));
+    krueger.alpha[5] = n2 * n2 * n * (34729.0 / 80640.0 + n * -3418889.0 / 1995840.0);
+    krueger.alpha[6] = n2 * n2 * n2 * 212378941.0 / 319334400.0;
+    return krueger;
+  }();
+  return series;
+}
+
+double central_meridian_of_zone(const int zone)
+{
+  return 6.0 * zone - 183.0;
+}
+}  // namespace
+
+int utm_standard_zone(const double lat, const double lon)
+{
+  if (!(lat >= min_utm_latitude && lat < max_utm_latitude) || !std::isfinite(lon)) {
+    return 0;
+  }
+  int ilon = static_cast<int>(std::floor(std::remainder(lon, 360.0)));
+  if (ilon == 180) {
+    ilon = -180;
+  }
+  int zone = (ilon + 186) / 6;
+  const int band = std::clamp((static_cast<int>(std::floor(lat)) + 80) / 8 - 10, -10, 9);
+  if (band == 7 && zone == 31 && ilon >= 3) {
+    zone = 32;
+  } else if (band == 9 && ilon >= 0 && ilon < 42) {
+    zone = 2 * ((ilon + 183) / 12) + 1;
+  }
+  return zone;
+}
+
+BatchProjector::BatchProjector(const Mode mode, const double central_meridian)
+: mode_(mode), central_meridian_(central_meridian)
+{
+}
+
+std::unique_ptr<BatchProjector> BatchProjector::create(
+  const std::string & projector_type, const lanelet::GPSPoint & origin)
+{
+  std::unique_ptr<BatchProjector> projector;
+  if (projector_type == "mgrs") {
+    // The MGRS projector projects every point in its own zone and has no origin
+    return std::unique_ptr<BatchProjector>(new BatchProjector(Mode::MGRS, 0.0));
+  }
+  if (projector_type == "transverse_mercator") {
+    projector.reset(new BatchProjector(Mode::TRANSVERSE_MERCATOR, origin.lon));
+  } else if (projector_type == "utm") {
+    const int zone = utm_standard_zone(origin.lat, origin.lon);
+    if (zone == 0) {
+      return nullptr;
+    }
+    projector.reset(new BatchProjector(Mode::UTM, central_meridian_of_zone(zone)));
+  } else {
+    return nullptr;
+  }
+
+  // The coordinates are relative to the projected origin
+  double x = 0.0;
+  double y = 0.0;
+  double z = 0.0;
+  if (projector->forward(1, &origin.lat, &origin.lon, &origin.ele, &x, &y, &z) == 0) {
+    return nullptr;
+  }
+  projector->x_offset_ = x;
+  projector->y_offset_ = y;
+  return projector;
+}
+
+size_t BatchProjector::forward(
+  const size_t count, const double * lat, const double * lon, const double * ele, double * x,
+  double * y, double * z) const
+{
+  const KruegerSeries & series = krueger_series();
+
+  // The longitude relative to the central meridian (NaN outside the handled range) goes to x first
+  for (size_t i = 0; i < count; i++) {
+    double central_meridian = central_meridian_;
+    if (mode_ == Mode::MGRS) {
+      const int zone = utm_standard_zone(lat[i], lon[i]);
+      central_meridian = zone == 0 ? nan : central_meridian_of_zone(zone);
+    }
+    const double longitude_difference = std::remainder(lon[i] - central_meridian, 360.0);
+    const bool handled = lat[i] >= min_utm_latitude && lat[i] < max_utm_latitude &&
+                         std::abs(longitude_difference) <= max_longitude_difference;
+    x[i] = handled ? longitude_difference : nan;
+  }
+
+  // The transverse Mercator projection of GeographicLib::TransverseMercator::Forward(), without
+  // branches so that the NaNs flow through
+  for (size_t i = 0; i < count; i++) {
+    const double phi = lat[i] * degree;
+    const double lambda = x[i] * degree;
+    const double sin_phi = std::sin(phi);
+    const double cos_phi = std::cos(phi);
+    const double sin_lambda = std::sin(lambda);
+    const double cos_lambda = std::cos(lambda);
+
+    // The conformal latitude (tau' = tan(chi)) and the Gauss-Schreiber coordinates
+    const double tau = sin_phi / cos_phi;
+    const double tau1 = std::hypot(1.0, tau);
+    const double sigma = std::sinh(series.e * std::atanh(series.e * tau / tau1));
+    const double taup = std::hypot(1.0, sigma) * tau - sigma * tau1;
+    const double xip = std::atan2(taup, cos_lambda);
+    const double etap = std::asinh(sin_lambda / std::hypot(taup, cos_lambda));
+
+    // Clenshaw summation of the series of alpha[j] * sin(2 j zeta') with zeta' = xip + i etap
+    const double c0 = std::cos(2.0 * xip);
+    const double s0 = std::sin(2.0 * xip);
+    const double ch0 = std::cosh(2.0 * etap);
+    const double sh0 = std::sinh(2.0 * etap);
+    const double a_real = 2.0 * c0 * ch0;
+    const double a_imag = -2.0 * s0 * sh0;
+    double y0_real = 0.0;
+    double y0_imag = 0.0;
+    double y1_real = 0.0;
+    double y1_imag = 0.0;
+    for (int j = series_order; j > 0; j--) {
+      const double next_real = a_real * y0_real - a_imag * y0_imag - y1_real + series.alpha[j];
+      const double next_imag = a_real * y0_imag + a_imag * y0_real - y1_imag;
+      y1_real = y0_real;
+      y1_imag = y0_imag;
+      y0_real = next_real;
+      y0_imag = next_imag;
+    }
+    const double sin_real = s0 * ch0;
+    const double sin_imag = c0 * sh0;
+    const double xi = xip + sin_real * y0_real - sin_imag * y0_imag;
+    const double eta = etap + sin_real * y0_imag + sin_imag * y0_real;
+
+    x[i] = series.scale * eta;
+    y[i] = series.scale * xi;
+  }
+
+  size_t projected_count = 0;
+  for (size_t i = 0; i < count; i++) {
+    const double false_northing = lat[i] < 0.0 ? utm_false_northing_south : 0.0;
+    switch (mode_) {
+      case Mode::MGRS: {
+        // The coordinates in the 100 km square, as the MGRS projector takes them from the UTM ones
+        const double easting = std::fmod(x[i] + utm_false_easting, mgrs_square_size);
+        const double northing = std::fmod(y[i] + false_northing, mgrs_square_size);
+        const bool near_grid_line =
+          std::min(easting, mgrs_square_size - easting) < mgrs_square_margin ||
+          std::min(northing, mgrs_square_size - northing) < mgrs_square_margin;
+        x[i] = near_grid_line ? nan : easting;
+        y[i] = near_grid_line ? nan : northing;
+        break;
+      }
+      case Mode::UTM:
+        x[i] += utm_false_easting - x_offset_;
+        y[i] += false_northing - y_offset_;
+        break;
+      case Mode::TRANSVERSE_MERCATOR:
+        x[i] -= x_offset_;
+        y[i] -= y_offset_;
+        break;
+    }
+    const bool projected = !std::isnan(x[i]) && !std::isnan(y[i]);
+    z[i] = projected ? ele[i] : nan;
+    projected_count += projected ? 1 : 0;
+  }
+  return projected_count;
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,362 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/results_writer.hpp"
+
+#include "lanelet2_map_validator/issue_locator.hpp"
+#include "lanelet2_map_validator/issue_message.hpp"
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/shards.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+constexpr size_t indent_step = 4;
+
+using MemberWriter = std::function<void(const size_t)>;
+
+// Write an object whose members are written by the given functions, in the order given
+void write_pretty_members(
+  std::ostream & os, const std::vector<std::pair<std::string, MemberWriter>> & members,
+  const size_t indent)
+{
+  if (members.empty()) {
+    os << "{}";
+    return;
+  }
+
+  const std::string member_indent(indent + indent_step, ' ');
+  os << "{\n";
+  for (size_t i = 0; i < members.size(); i++) {
+    os << member_indent << nlohmann::json(members[i].first).dump() << ": ";
+    members[i].second(indent + indent_step);
+    os << (i + 1 < members.size() ? ",\n" : "\n");
+  }
+  os << std::string(indent, ' ') << '}';
+}
+
+// Members of the object written by write_pretty_json(), with `extra` inserted in key order
+std::vector<std::pair<std::string, MemberWriter>> collect_members(
+  std::ostream & os, const nlohmann::json & object,
+  std::pair<std::string, MemberWriter> extra = {"", nullptr})
+{
+  std::vector<std::pair<std::string, MemberWriter>> members;
+  members.reserve(object.size() + 1);
+  for (auto it = object.begin(); it != object.end(); ++it) {
+    if (extra.second && extra.first < it.key()) {
+      members.push_back(std::move(extra));
+      extra.second = nullptr;
+    }
+    const nlohmann::json & value = it.value();
+    members.emplace_back(
+      it.key(), [&os, &value](const size_t indent) { write_pretty_json(os, value, indent); });
+  }
+  if (extra.second) {
+    members.push_back(std::move(extra));
+  }
+  return members;
+}
+
+// Write an array whose elements are written by write_element(i, indent)
+template <typename WriteElement>
+void write_pretty_array(
+  std::ostream & os, const size_t size, const size_t indent, WriteElement && write_element)
+{
+  if (size == 0) {
+    os << "[]";
+    return;
+  }
+
+  const std::string element_indent(indent + indent_step, ' ');
+  os << "[\n";
+  for (size_t i = 0; i < size; i++) {
+    os << element_indent;
+    write_element(i, indent + indent_step);
+    os << (i + 1 < size ? ",\n" : "\n");
+  }
+  os << std::string(indent, ' ') << ']';
+}
+}  // namespace
+
+ResultsFormat parse_results_format(const std::string & format)
+{
+  if (format == "json") {
+    return ResultsFormat::JSON;
+  }
+  if (format == "ndjson") {
+    return ResultsFormat::NDJSON;
+  }
+  throw std::invalid_argument("Invalid output format " + format + " (must be json or ndjson)");
+}
+
+nlohmann::json issue_to_json(
+  const lanelet::validation::Issue & issue, const ValidationContext & context)
+{
+  const IssueMessage message = split_issue_message(issue.message);
+  nlohmann::json issue_json;
+  issue_json["severity"] = lanelet::validation::toString(issue.severity);
+  issue_json["primitive"] = lanelet::validation::toString(issue.primitive);
+  issue_json["id"] = issue.id;
+  // Issue messages without an issue code will be output as it is
+  if (!message.issue_code.empty()) {
+    issue_json["issue_code"] = message.issue_code;
+  }
+  issue_json["message"] = message.text;
+  if (context.issue_locator) {
+    context.issue_locator->annotate(issue, issue_json);
+  }
+  // Only the shards of --shards know the positions, which merge_shard_results() removes
+  if (context.region_of_interest) {
+    if (const auto position = context.region_of_interest->layer_position(issue)) {
+      issue_json[layer_position_key] = *position;
+    }
+  }
+  return issue_json;
+}
+
+void write_pretty_json(std::ostream & os, const nlohmann::json & value, const size_t indent)
+{
+  if (value.is_object()) {
+    write_pretty_members(os, collect_members(os, value), indent);
+  } else if (value.is_array()) {
+    write_pretty_array(os, value.size(), indent, [&os, &value](const size_t i, const size_t ind) {
+      write_pretty_json(os, value[i], ind);
+    });
+  } else {
+    os << value.dump();
+  }
+}
+
+ResultsWriter::ResultsWriter(
+  const std::filesystem::path & output_directory, const ResultsFormat format)
+: format_(format)
+{
+  if (!std::filesystem::is_directory(output_directory)) {
+    throw std::invalid_argument("Output path doesn't exist or is not a directory!");
+  }
+
+  output_file_ = output_directory / (format_ == ResultsFormat::JSON
+                                       ? "lanelet2_validation_results.json"
+                                       : "lanelet2_validation_results.ndjson");
+  temporary_file_ = output_directory / ("." + output_file_.filename().string() + ".tmp");
+  output_.open(temporary_file_, std::ios::out | std::ios::trunc);
+  if (!output_.is_open()) {
+    throw std::runtime_error("Failed to open " + temporary_file_.string());
+  }
+
+  if (format_ == ResultsFormat::JSON) {
+    spool_file_ = output_directory / ".lanelet2_validation_results.json.spool";
+    spool_.open(spool_file_, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!spool_.is_open()) {
+      throw std::runtime_error("Failed to open " + spool_file_.string());
+    }
+  }
+}
+
+ResultsWriter::~ResultsWriter()
+{
+  if (spool_.is_open()) {
+    spool_.close();
+  }
+  std::error_code error;
+  if (!spool_file_.empty()) {
+    std::filesystem::remove(spool_file_, error);
+  }
+  // The results of an unfinished run are discarded
+  if (output_.is_open()) {
+    output_.close();
+    std::filesystem::remove(temporary_file_, error);
+  }
+}
+
+void ResultsWriter::add_validator_issues(
+  const nlohmann::json & validator_json, const lanelet::validation::Issues & issues)
+{
+  const std::string name = validator_json.at("name").get<std::string>();
+  const ValidationContextPtr context = ValidationContext::current();
+  for (const auto & issue : issues) {
+    if (issue.severity == lanelet::validation::Severity::Error) {
+      issue_counts_.errors++;
+    } else if (issue.severity == lanelet::validation::Severity::Warning) {
+      issue_counts_.warnings++;
+    }
+  }
+
+  if (format_ == ResultsFormat::NDJSON) {
+    for (const auto & issue : issues) {
+      nlohmann::json record = issue_to_json(issue, *context);
+      if (context->issue_locator) {
+        context->issue_locator->add_to_index(name, record);
+      }
+      record["type"] = "issue";
+      record["validator"] = name;
+      output_ << record.dump() << '\n';
+    }
+    nlohmann::json record = validator_json;
+    record.erase("issues");
+    record["type"] = "validator";
+    output_ << record.dump() << '\n';
+    output_.flush();
+    emitted_validators_.insert(name);
+    return;
+  }
+
+  if (issues.empty()) {
+    return;
+  }
+  spool_.seekp(0, std::ios::end);
+  SpoolRange & range = spooled_validators_[name];
+  range.begin = spool_.tellp();
+  range.count = issues.size();
+  for (const auto & issue : issues) {
+    const nlohmann::json issue_json = issue_to_json(issue, *context);
+    if (context->issue_locator) {
+      context->issue_locator->add_to_index(name, issue_json);
+    }
+    spool_ << issue_json.dump() << '\n';
+  }
+}
+
+void ResultsWriter::finish(const nlohmann::json & json_data)
+{
+  if (format_ == ResultsFormat::JSON) {
+    write_pretty_results(json_data);
+  } else {
+    write_ndjson_summary(json_data);
+  }
+  output_.close();
+  if (!output_) {
+    throw std::runtime_error("Failed to write " + temporary_file_.string());
+  }
+  std::filesystem::rename(temporary_file_, output_file_);
+}
+
+void ResultsWriter::write_pretty_results(const nlohmann::json & json_data)
+{
+  spool_.flush();
+
+  const auto write_validator = [this](const nlohmann::json & validator, const size_t indent) {
+    const auto spooled = validator.is_object() && validator.contains("name")
+                           ? spooled_validators_.find(validator["name"].get<std::string>())
+                           : spooled_validators_.end();
+    if (spooled == spooled_validators_.end() || validator.contains("issues")) {
+      write_pretty_json(output_, validator, indent);
+      return;
+    }
+    const SpoolRange range = spooled->second;
+    write_pretty_members(
+      output_,
+      collect_members(
+        output_, validator,
+        {"issues", [this, range](const size_t ind) { write_spooled_issues(range, ind); }}),
+      indent);
+  };
+
+  const auto write_requirement = [this, &write_validator](
+                                   const nlohmann::json & requirement, const size_t indent) {
+    if (!requirement.is_object() || !requirement.contains("validators")) {
+      write_pretty_json(output_, requirement, indent);
+      return;
+    }
+    auto members = collect_members(output_, requirement);
+    for (auto & [key, writer] : members) {
+      if (key == "validators") {
+        const nlohmann::json & validators = requirement["validators"];
+        writer = [this, &validators, &write_validator](const size_t ind) {
+          write_pretty_array(
+            output_, validators.size(), ind,
+            [&validators, &write_validator](const size_t i, const size_t element_indent) {
+              write_validator(validators[i], element_indent);
+            });
+        };
+      }
+    }
+    write_pretty_members(output_, members, indent);
+  };
+
+  auto members = collect_members(output_, json_data);
+  for (auto & [key, writer] : members) {
+    if (key == "requirements" && json_data["requirements"].is_array()) {
+      const nlohmann::json & requirements = json_data["requirements"];
+      writer = [this, &requirements, &write_requirement](const size_t ind) {
+        write_pretty_array(
+          output_, requirements.size(), ind,
+          [&requirements, &write_requirement](const size_t i, const size_t element_indent) {
+            write_requirement(requirements[i], element_indent);
+          });
+      };
+    }
+  }
+  write_pretty_members(output_, members, 0);
+}
+
+void ResultsWriter::write_spooled_issues(const SpoolRange & range, const size_t indent)
+{
+  spool_.clear();
+  spool_.seekg(range.begin);
+  std::string line;
+  write_pretty_array(output_, range.count, indent, [this, &line](const size_t, const size_t ind) {
+    if (!std::getline(spool_, line)) {
+      throw std::runtime_error("Failed to read " + spool_file_.string());
+    }
+    write_pretty_json(output_, nlohmann::json::parse(line), ind);
+  });
+}
+
+void ResultsWriter::write_ndjson_summary(const nlohmann::json & json_data)
+{
+  if (json_data.contains("requirements")) {
+    for (const auto & requirement : json_data["requirements"]) {
+      // Validators that never ran, e.g. the ones with invalid prerequisites
+      for (const auto & validator : requirement.value("validators", nlohmann::json::array())) {
+        const std::string name = validator.value("name", "");
+        if (emitted_validators_.count(name) > 0) {
+          continue;
+        }
+        for (const auto & issue : validator.value("issues", nlohmann::json::array())) {
+          nlohmann::json record = issue;
+          record["type"] = "issue";
+          record["validator"] = name;
+          output_ << record.dump() << '\n';
+        }
+        nlohmann::json record = validator;
+        record.erase("issues");
+        record["type"] = "validator";
+        output_ << record.dump() << '\n';
+      }
+
+      nlohmann::json record = {{"type", "requirement"}};
+      record["id"] = requirement.value("id", nlohmann::json());
+      record["passed"] = requirement.value("passed", nlohmann::json());
+      output_ << record.dump() << '\n';
+    }
+  }
+
+  if (json_data.contains("validation_info")) {
+    nlohmann::json record = json_data["validation_info"];
+    record["type"] = "validation_info";
+    output_ << record.dump() << '\n';
+  }
+}
+
+}  // namespace lanelet::autoware::validation
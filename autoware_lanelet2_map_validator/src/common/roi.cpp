@@ -0,0 +1,473 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/roi.hpp"
+
+#include <lanelet2_core/geometry/Area.h>
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_core/geometry/LineString.h>
+#include <lanelet2_core/geometry/Point.h>
+#include <lanelet2_core/geometry/Polygon.h>
+#include <lanelet2_core/geometry/RegulatoryElement.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+std::vector<std::string> split_by_comma(const std::string & text)
+{
+  std::vector<std::string> elements;
+  std::stringstream stream(text);
+  std::string element;
+  while (std::getline(stream, element, ',')) {
+    elements.push_back(element);
+  }
+  return elements;
+}
+
+lanelet::BoundingBox2d primitive_bounding_box(const lanelet::ConstPoint3d & point)
+{
+  return lanelet::geometry::boundingBox2d(point);
+}
+
+lanelet::BoundingBox2d primitive_bounding_box(const lanelet::ConstLineString3d & linestring)
+{
+  return lanelet::geometry::boundingBox2d(lanelet::traits::to2D(linestring));
+}
+
+lanelet::BoundingBox2d primitive_bounding_box(const lanelet::ConstPolygon3d & polygon)
+{
+  return lanelet::geometry::boundingBox2d(lanelet::traits::to2D(polygon));
+}
+
+lanelet::BoundingBox2d primitive_bounding_box(const lanelet::ConstLanelet & lanelet)
+{
+  return lanelet::geometry::boundingBox2d(lanelet);
+}
+
+lanelet::BoundingBox2d primitive_bounding_box(const lanelet::ConstArea & area)
+{
+  return lanelet::geometry::boundingBox2d(area);
+}
+
+lanelet::BoundingBox2d primitive_bounding_box(const lanelet::RegulatoryElementConstPtr & regelem)
+{
+  return lanelet::geometry::boundingBox2d(*regelem);
+}
+
+std::optional<lanelet::BoundingBox2d> find_primitive_bounding_box(
+  const lanelet::LaneletMap & map, const lanelet::Id id)
+{
+  if (map.laneletLayer.exists(id)) {
+    return primitive_bounding_box(map.laneletLayer.get(id));
+  }
+  if (map.areaLayer.exists(id)) {
+    return primitive_bounding_box(map.areaLayer.get(id));
+  }
+  if (map.regulatoryElementLayer.exists(id)) {
+    return primitive_bounding_box(map.regulatoryElementLayer.get(id));
+  }
+  if (map.polygonLayer.exists(id)) {
+    return primitive_bounding_box(map.polygonLayer.get(id));
+  }
+  if (map.lineStringLayer.exists(id)) {
+    return primitive_bounding_box(map.lineStringLayer.get(id));
+  }
+  if (map.pointLayer.exists(id)) {
+    return primitive_bounding_box(map.pointLayer.get(id));
+  }
+  return std::nullopt;
+}
+
+template <typename Layer>
+std::optional<lanelet::BoundingBox2d> find_bounding_box_in_layer(
+  const Layer & layer, const lanelet::Id id)
+{
+  if (!layer.exists(id)) {
+    return std::nullopt;
+  }
+  return primitive_bounding_box(layer.get(id));
+}
+
+template <typename Layer>
+std::unordered_set<lanelet::Id> ids_in_boxes(
+  const Layer & layer, const std::vector<lanelet::BoundingBox2d> & boxes)
+{
+  std::unordered_set<lanelet::Id> ids;
+  for (const auto & box : boxes) {
+    for (const auto & primitive : layer.search(box)) {
+      if constexpr (std::is_same_v<
+                      typename Layer::ConstPrimitiveT, lanelet::RegulatoryElementConstPtr>) {
+        ids.insert(primitive->id());
+      } else {
+        ids.insert(primitive.id());
+      }
+    }
+  }
+  return ids;
+}
+
+// IDs of the owned primitives of the layer, extending extent with their bounding boxes
+template <typename Layer>
+std::unordered_set<lanelet::Id> owned_ids_in_layer(
+  const Layer & layer, const std::unordered_set<lanelet::Id> & owned_ids,
+  lanelet::BoundingBox2d & extent)
+{
+  std::unordered_set<lanelet::Id> ids;
+  for (const auto & primitive : layer) {
+    lanelet::Id id = lanelet::InvalId;
+    if constexpr (std::is_same_v<
+                    typename Layer::ConstPrimitiveT, lanelet::RegulatoryElementConstPtr>) {
+      id = primitive->id();
+    } else {
+      id = primitive.id();
+    }
+    if (owned_ids.count(id) > 0) {
+      ids.insert(id);
+      extent.extend(primitive_bounding_box(primitive));
+    }
+  }
+  return ids;
+}
+
+// IDs of the primitives whose bounding box center is in [lower, upper) along the axis
+template <typename Layer>
+std::unordered_set<lanelet::Id> owned_ids(
+  const Layer & layer, const int axis, const double lower, const double upper)
+{
+  std::unordered_set<lanelet::Id> ids;
+  for (const auto & primitive : layer) {
+    const double center = primitive_bounding_box(primitive).center()[axis];
+    if (lower <= center && center < upper) {
+      if constexpr (std::is_same_v<
+                      typename Layer::ConstPrimitiveT, lanelet::RegulatoryElementConstPtr>) {
+        ids.insert(primitive->id());
+      } else {
+        ids.insert(primitive.id());
+      }
+    }
+  }
+  return ids;
+}
+
+// Positions of the primitives in the order of iterating the layer
+template <typename Layer>
+std::unordered_map<lanelet::Id, size_t> positions_in_layer(const Layer & layer)
+{
+  std::unordered_map<lanelet::Id, size_t> positions;
+  positions.reserve(layer.size());
+  for (const auto & primitive : layer) {
+    if constexpr (std::is_same_v<
+                    typename Layer::ConstPrimitiveT, lanelet::RegulatoryElementConstPtr>) {
+      positions.emplace(primitive->id(), positions.size());
+    } else {
+      positions.emplace(primitive.id(), positions.size());
+    }
+  }
+  return positions;
+}
+}  // namespace
+
+std::shared_ptr<const RegionOfInterest> RegionOfInterest::create(
+  const lanelet::LaneletMap & map, const std::optional<lanelet::BoundingBox2d> & bounding_box,
+  const std::vector<lanelet::Id> & ids)
+{
+  if (!bounding_box && ids.empty()) {
+    throw std::invalid_argument("The region of interest needs a bounding box or primitive IDs");
+  }
+
+  std::shared_ptr<RegionOfInterest> region_of_interest(new RegionOfInterest());
+  if (bounding_box) {
+    region_of_interest->boxes_.push_back(*bounding_box);
+  }
+  for (const lanelet::Id id : ids) {
+    const auto box = find_primitive_bounding_box(map, id);
+    if (!box) {
+      throw std::invalid_argument(
+        "Primitive " + std::to_string(id) + " of the region of interest is not in the map");
+    }
+    region_of_interest->boxes_.push_back(*box);
+  }
+  region_of_interest->ids_ = ids;
+
+  // The primitives to report issues for are determined once here, so that filtering issues does
+  // not need the map
+  using lanelet::validation::Primitive;
+  const auto & boxes = region_of_interest->boxes_;
+  auto & contained_ids = region_of_interest->contained_ids_;
+  contained_ids[Primitive::Point] = ids_in_boxes(map.pointLayer, boxes);
+  contained_ids[Primitive::LineString] = ids_in_boxes(map.lineStringLayer, boxes);
+  contained_ids[Primitive::Polygon] = ids_in_boxes(map.polygonLayer, boxes);
+  contained_ids[Primitive::Lanelet] = ids_in_boxes(map.laneletLayer, boxes);
+  contained_ids[Primitive::Area] = ids_in_boxes(map.areaLayer, boxes);
+  contained_ids[Primitive::RegulatoryElement] = ids_in_boxes(map.regulatoryElementLayer, boxes);
+
+  return region_of_interest;
+}
+
+std::shared_ptr<const RegionOfInterest> RegionOfInterest::create_shard(
+  const lanelet::LaneletMap & map, const size_t shard_index, const size_t shard_count)
+{
+  if (shard_count == 0 || shard_index >= shard_count) {
+    throw std::invalid_argument(
+      "Invalid shard " + std::to_string(shard_index) + " of " + std::to_string(shard_count));
+  }
+
+  // The map is cut into strips across its longer side, each having the same number of points
+  lanelet::BoundingBox2d extent;
+  for (const auto & point : map.pointLayer) {
+    extent.extend(point.basicPoint2d());
+  }
+  const int axis = extent.sizes().x() >= extent.sizes().y() ? 0 : 1;
+
+  std::vector<double> coordinates;
+  coordinates.reserve(map.pointLayer.size());
+  for (const auto & point : map.pointLayer) {
+    coordinates.push_back(point.basicPoint2d()[axis]);
+  }
+  const auto boundary = [&coordinates, shard_count](const size_t index) {
+    if (index == 0) {
+      return -std::numeric_limits<double>::infinity();
+    }
+    if (index == shard_count) {
+      return std::numeric_limits<double>::infinity();
+    }
+    const auto nth = coordinates.begin() + coordinates.size() * index / shard_count;
+    std::nth_element(coordinates.begin(), nth, coordinates.end());
+    return *nth;
+  };
+  const double lower = boundary(shard_index);
+  const double upper = boundary(shard_index + 1);
+
+  std::shared_ptr<RegionOfInterest> region_of_interest(new RegionOfInterest());
+  if (!extent.isEmpty()) {
+    lanelet::BoundingBox2d strip = extent;
+    strip.min()[axis] = std::max(lower, extent.min()[axis]);
+    strip.max()[axis] = std::min(upper, extent.max()[axis]);
+    region_of_interest->boxes_.push_back(strip);
+  }
+
+  // Each primitive is owned by exactly one shard, so that merging the issues of all shards gives
+  // the issues of the whole map
+  using lanelet::validation::Primitive;
+  auto & contained_ids = region_of_interest->contained_ids_;
+  contained_ids[Primitive::Point] = owned_ids(map.pointLayer, axis, lower, upper);
+  contained_ids[Primitive::LineString] = owned_ids(map.lineStringLayer, axis, lower, upper);
+  contained_ids[Primitive::Polygon] = owned_ids(map.polygonLayer, axis, lower, upper);
+  contained_ids[Primitive::Lanelet] = owned_ids(map.laneletLayer, axis, lower, upper);
+  contained_ids[Primitive::Area] = owned_ids(map.areaLayer, axis, lower, upper);
+  contained_ids[Primitive::RegulatoryElement] =
+    owned_ids(map.regulatoryElementLayer, axis, lower, upper);
+
+  // The shards validate their primitives in the order of the layers like a single process does,
+  // and the merged issues are put back in that order by the positions
+  auto & layer_positions = region_of_interest->layer_positions_;
+  layer_positions[Primitive::Point] = positions_in_layer(map.pointLayer);
+  layer_positions[Primitive::LineString] = positions_in_layer(map.lineStringLayer);
+  layer_positions[Primitive::Polygon] = positions_in_layer(map.polygonLayer);
+  layer_positions[Primitive::Lanelet] = positions_in_layer(map.laneletLayer);
+  layer_positions[Primitive::Area] = positions_in_layer(map.areaLayer);
+  layer_positions[Primitive::RegulatoryElement] =
+    positions_in_layer(map.regulatoryElementLayer);
+
+  return region_of_interest;
+}
+
+std::shared_ptr<const RegionOfInterest> RegionOfInterest::create_owned(
+  const lanelet::LaneletMap & map, const std::unordered_set<lanelet::Id> & owned_node_ids,
+  const std::unordered_set<lanelet::Id> & owned_way_ids,
+  const std::unordered_set<lanelet::Id> & owned_relation_ids)
+{
+  std::shared_ptr<RegionOfInterest> region_of_interest(new RegionOfInterest());
+
+  using lanelet::validation::Primitive;
+  lanelet::BoundingBox2d extent;
+  auto & contained_ids = region_of_interest->contained_ids_;
+  contained_ids[Primitive::Point] = owned_ids_in_layer(map.pointLayer, owned_node_ids, extent);
+  contained_ids[Primitive::LineString] =
+    owned_ids_in_layer(map.lineStringLayer, owned_way_ids, extent);
+  contained_ids[Primitive::Polygon] = owned_ids_in_layer(map.polygonLayer, owned_way_ids, extent);
+  contained_ids[Primitive::Lanelet] =
+    owned_ids_in_layer(map.laneletLayer, owned_relation_ids, extent);
+  contained_ids[Primitive::Area] = owned_ids_in_layer(map.areaLayer, owned_relation_ids, extent);
+  contained_ids[Primitive::RegulatoryElement] =
+    owned_ids_in_layer(map.regulatoryElementLayer, owned_relation_ids, extent);
+
+  if (!extent.isEmpty()) {
+    region_of_interest->boxes_.push_back(extent);
+  }
+  return region_of_interest;
+}
+
+bool RegionOfInterest::contains(const lanelet::validation::Issue & issue) const
+{
+  if (
+    issue.id == lanelet::InvalId || issue.primitive == lanelet::validation::Primitive::Primitive) {
+    return true;
+  }
+  const auto it = contained_ids_.find(issue.primitive);
+  return it != contained_ids_.end() && it->second.count(issue.id) > 0;
+}
+
+std::optional<size_t> RegionOfInterest::layer_position(
+  const lanelet::validation::Issue & issue) const
+{
+  const auto positions = layer_positions_.find(issue.primitive);
+  if (positions == layer_positions_.end()) {
+    return std::nullopt;
+  }
+  const auto it = positions->second.find(issue.id);
+  if (it == positions->second.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+nlohmann::json RegionOfInterest::to_json() const
+{
+  nlohmann::json json_data;
+  json_data["bounding_boxes"] = nlohmann::json::array();
+  for (const auto & box : boxes_) {
+    json_data["bounding_boxes"].push_back(
+      {box.min().x(), box.min().y(), box.max().x(), box.max().y()});
+  }
+  json_data["ids"] = ids_;
+  return json_data;
+}
+
+lanelet::BoundingBox2d RegionOfInterest::expand(
+  const lanelet::BoundingBox2d & box, const double halo)
+{
+  const lanelet::BasicPoint2d margin(halo, halo);
+  return lanelet::BoundingBox2d(box.min() - margin, box.max() + margin);
+}
+
+lanelet::BoundingBox2d parse_roi_bounding_box(const std::string & text)
+{
+  const std::vector<std::string> elements = split_by_comma(text);
+  std::vector<double> values;
+  for (const auto & element : elements) {
+    size_t parsed_length = 0;
+    try {
+      values.push_back(std::stod(element, &parsed_length));
+    } catch (const std::exception &) {
+      parsed_length = 0;
+    }
+    if (parsed_length == 0 || element.find_first_not_of(' ', parsed_length) != std::string::npos) {
+      break;
+    }
+  }
+
+  if (values.size() != 4 || elements.size() != 4) {
+    throw std::invalid_argument(
+      "Invalid region of interest " + text + " (must be min_x,min_y,max_x,max_y)");
+  }
+  if (values[0] > values[2] || values[1] > values[3]) {
+    throw std::invalid_argument(
+      "Invalid region of interest " + text + " (min_x/min_y must not exceed max_x/max_y)");
+  }
+  return lanelet::BoundingBox2d(
+    lanelet::BasicPoint2d(values[0], values[1]), lanelet::BasicPoint2d(values[2], values[3]));
+}
+
+std::vector<lanelet::Id> parse_roi_ids(const std::string & text)
+{
+  std::vector<lanelet::Id> ids;
+  for (const auto & element : split_by_comma(text)) {
+    size_t parsed_length = 0;
+    lanelet::Id id = lanelet::InvalId;
+    try {
+      id = std::stoll(element, &parsed_length);
+    } catch (const std::exception &) {
+      parsed_length = 0;
+    }
+    if (parsed_length == 0 || element.find_first_not_of(' ', parsed_length) != std::string::npos) {
+      throw std::invalid_argument(
+        "Invalid primitive ID " + element + " in the region of interest");
+    }
+    ids.push_back(id);
+  }
+  return ids;
+}
+
+double roi_halo(const ValidatorConfig & config, const std::string & validator_name)
+{
+  const YAML::Node parameters = config.parameters();
+  if (parameters[validator_name] && parameters[validator_name]["roi_halo"]) {
+    try {
+      return parameters[validator_name]["roi_halo"].as<double>();
+    } catch (const std::exception & e) {
+      std::cerr << "Type mismatch for parameter \"roi_halo\" of " << validator_name << ": "
+                << e.what() << std::endl;
+    }
+  }
+  return default_roi_halo;
+}
+
+std::optional<lanelet::BoundingBox2d> issue_bounding_box(
+  const lanelet::LaneletMap & map, const lanelet::validation::Issue & issue)
+{
+  switch (issue.primitive) {
+    case lanelet::validation::Primitive::Point:
+      return find_bounding_box_in_layer(map.pointLayer, issue.id);
+    case lanelet::validation::Primitive::LineString:
+      return find_bounding_box_in_layer(map.lineStringLayer, issue.id);
+    case lanelet::validation::Primitive::Polygon:
+      return find_bounding_box_in_layer(map.polygonLayer, issue.id);
+    case lanelet::validation::Primitive::Lanelet:
+      return find_bounding_box_in_layer(map.laneletLayer, issue.id);
+    case lanelet::validation::Primitive::Area:
+      return find_bounding_box_in_layer(map.areaLayer, issue.id);
+    case lanelet::validation::Primitive::RegulatoryElement:
+      return find_bounding_box_in_layer(map.regulatoryElementLayer, issue.id);
+    default:
+      return std::nullopt;
+  }
+}
+
+void filter_out_issues_outside_roi(
+  std::vector<lanelet::validation::DetectedIssues> & issues_vector,
+  const ValidationContext & context)
+{
+  const auto & region_of_interest = context.region_of_interest;
+  if (!region_of_interest) {
+    return;
+  }
+
+  for (auto & issues : issues_vector) {
+    issues.issues.erase(
+      std::remove_if(
+        issues.issues.begin(), issues.issues.end(),
+        [&](const lanelet::validation::Issue & issue) {
+          return !region_of_interest->contains(issue);
+        }),
+      issues.issues.end());
+  }
+}
+
+}  // namespace lanelet::autoware::validation
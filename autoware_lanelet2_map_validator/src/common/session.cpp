@@ -0,0 +1,107 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/session.hpp"
+
+#include "lanelet2_map_validator/map_loader.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+bool ValidationResults::passed() const
+{
+  for (const auto & requirement : json_data.value("requirements", nlohmann::json::array())) {
+    if (!requirement.value("passed", false)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ValidationSession::ValidationSession(
+  lanelet::LaneletMapPtr map, ValidatorConfigPtr config, MetaConfig meta_config)
+: map_(std::move(map)), config_(std::move(config)), meta_config_(std::move(meta_config))
+{
+  if (!map_) {
+    throw std::invalid_argument("The map of a validation session must not be null!");
+  }
+  set_exclusion_map({});
+}
+
+ValidationSession ValidationSession::load(
+  const std::string & map_file, ValidatorConfigPtr config, MetaConfig meta_config)
+{
+  if (!std::filesystem::is_regular_file(map_file)) {
+    throw std::invalid_argument("Map file doesn't exist or is not a file!");
+  }
+  auto [map, loading_issues] = loadAndValidateMap(
+    meta_config.projector_type, map_file, meta_config.command_line_config.validationConfig);
+  if (!map) {
+    throw std::invalid_argument("The map file was not possible to load!");
+  }
+
+  meta_config.command_line_config.mapFile = map_file;
+  ValidationSession session(std::move(map), std::move(config), std::move(meta_config));
+  session.loading_issues_ = std::move(loading_issues);
+  return session;
+}
+
+void ValidationSession::set_exclusion_map(const ValidatorExclusionMap & exclusion_map)
+{
+  // validate_all_requirements() looks up the exclusion list of every validator it runs
+  exclusion_map_.clear();
+  for (const std::string & validator_name :
+       lanelet::validation::availabeChecks(".*")) {  // cspell:disable-line
+    exclusion_map_[validator_name] = std::vector<SimplePrimitive>();
+  }
+  for (const auto & [validator_name, primitives] : exclusion_map) {
+    exclusion_map_[validator_name] = primitives;
+  }
+}
+
+ValidationResults ValidationSession::validate(
+  const nlohmann::json & requirements,
+  const std::shared_ptr<const RegionOfInterest> & region_of_interest)
+{
+  MetaConfig meta_config = meta_config_;
+  meta_config.start_time = std::chrono::steady_clock::now();
+  auto context = std::make_shared<ValidationContext>();
+  context->region_of_interest = region_of_interest;
+
+  ValidationResults results;
+  results.json_data = requirements;
+  results.issues = validate_all_requirements(
+    results.json_data, meta_config, *map_, exclusion_map_, config_, context, nullptr,
+    &timing_profile_);
+  evaluate_requirements(results.json_data);
+  if (region_of_interest) {
+    results.json_data["validation_info"]["region_of_interest"] = region_of_interest->to_json();
+  }
+
+  for (const auto & detected_issues : results.issues) {
+    results.errors += detected_issues.errors().size();
+    results.warnings += detected_issues.warnings().size();
+  }
+  return results;
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,239 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/shards.hpp"
+
+#include "lanelet2_map_validator/progress.hpp"
+
+#include <lanelet2_validation/Validation.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+extern char ** environ;
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+constexpr const char * prerequisites_failure_code = "General.PrerequisitesFailure-001";
+
+pid_t spawn_shard_worker(
+  const std::vector<std::string> & arguments, const std::filesystem::path & log_file)
+{
+  std::vector<char *> worker_argv;
+  worker_argv.reserve(arguments.size() + 1);
+  for (const auto & argument : arguments) {
+    worker_argv.push_back(const_cast<char *>(argument.c_str()));  // NOLINT
+  }
+  worker_argv.push_back(nullptr);
+
+  posix_spawn_file_actions_t file_actions;
+  posix_spawn_file_actions_init(&file_actions);
+  posix_spawn_file_actions_addopen(
+    &file_actions, STDOUT_FILENO, log_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  posix_spawn_file_actions_adddup2(&file_actions, STDOUT_FILENO, STDERR_FILENO);
+
+  pid_t pid = 0;
+  const int result = posix_spawn(
+    &pid, "/proc/self/exe", &file_actions, nullptr, worker_argv.data(), environ);
+  posix_spawn_file_actions_destroy(&file_actions);
+  if (result != 0) {
+    throw std::runtime_error(
+      "Failed to start a shard worker (error " + std::to_string(result) + ")");
+  }
+  return pid;
+}
+
+bool is_failure(const nlohmann::json & issue)
+{
+  const std::string severity = issue.value("severity", "");
+  return severity == lanelet::validation::toString(lanelet::validation::Severity::Error) ||
+         severity == lanelet::validation::toString(lanelet::validation::Severity::Warning);
+}
+
+bool is_bound(const nlohmann::json & issue)
+{
+  return issue.value("id", lanelet::InvalId) != lanelet::InvalId &&
+         issue.value("primitive", "") !=
+           lanelet::validation::toString(lanelet::validation::Primitive::Primitive);
+}
+
+nlohmann::json merge_validator_issues(const std::vector<const nlohmann::json *> & validators)
+{
+  for (const nlohmann::json * validator : validators) {
+    for (const auto & issue : validator->value("issues", nlohmann::json::array())) {
+      if (issue.value("issue_code", "") == prerequisites_failure_code) {
+        return nlohmann::json::array({issue});
+      }
+    }
+  }
+
+  // Issues bound to a primitive are reported only by the shard owning it. Issues not bound to a
+  // primitive are reported by every shard and taken from the first shard reporting them.
+  struct Cursor
+  {
+    std::vector<nlohmann::json> issues;
+    size_t next = 0;
+    uint64_t position = 0;
+  };
+  std::vector<Cursor> cursors(validators.size());
+  std::set<std::string> reported_unbound_issues;
+  for (size_t i = 0; i < validators.size(); i++) {
+    std::set<std::string> unbound_issues;
+    for (const auto & issue : validators[i]->value("issues", nlohmann::json::array())) {
+      if (is_bound(issue) || reported_unbound_issues.count(issue.dump()) == 0) {
+        cursors[i].issues.push_back(issue);
+      }
+      if (!is_bound(issue)) {
+        unbound_issues.insert(issue.dump());
+      }
+    }
+    reported_unbound_issues.merge(unbound_issues);
+  }
+
+  // Each shard reports its issues in the order of the layers, so the next issue is the one with the
+  // lowest position among the next issues of the shards (the first shard for equal positions).
+  // Issues without a position keep the position of the issue before them.
+  nlohmann::json issues = nlohmann::json::array();
+  while (true) {
+    Cursor * earliest = nullptr;
+    for (Cursor & cursor : cursors) {
+      if (cursor.next == cursor.issues.size()) {
+        continue;
+      }
+      cursor.position = cursor.issues[cursor.next].value(layer_position_key, cursor.position);
+      if (!earliest || cursor.position < earliest->position) {
+        earliest = &cursor;
+      }
+    }
+    if (!earliest) {
+      return issues;
+    }
+    nlohmann::json & issue = earliest->issues[earliest->next++];
+    issue.erase(layer_position_key);
+    issues.push_back(std::move(issue));
+  }
+}
+}  // namespace
+
+std::vector<nlohmann::json> run_shard_workers(
+  int argc, const char * argv[], const size_t shard_count)
+{
+  const std::filesystem::path work_directory =
+    std::filesystem::temp_directory_path() /
+    ("lanelet2_map_validator_shards_" + std::to_string(getpid()));
+  std::filesystem::create_directories(work_directory);
+
+  std::vector<pid_t> workers;
+  for (size_t i = 0; i < shard_count; i++) {
+    const std::filesystem::path shard_directory = work_directory / ("shard_" + std::to_string(i));
+    std::filesystem::create_directories(shard_directory);
+
+    std::vector<std::string> arguments(argv, argv + argc);
+    arguments.insert(
+      arguments.end(),
+      {"--shard_index", std::to_string(i), "--shard_output", shard_directory.string()});
+    workers.push_back(spawn_shard_worker(arguments, shard_directory / "log.txt"));
+  }
+
+  std::vector<std::string> failures;
+  for (size_t i = 0; i < shard_count; i++) {
+    int status = 0;
+    const bool succeeded = waitpid(workers[i], &status, 0) == workers[i] && WIFEXITED(status) &&
+                           WEXITSTATUS(status) == 0;
+    report_progress(
+      "shard_finished", {{"shard", i}, {"total", shard_count}, {"succeeded", succeeded}});
+    if (!succeeded) {
+      failures.push_back((work_directory / ("shard_" + std::to_string(i)) / "log.txt").string());
+    }
+  }
+  if (!failures.empty()) {
+    std::string message = "Shard workers failed, see";
+    for (const auto & log_file : failures) {
+      message += " " + log_file;
+    }
+    throw std::runtime_error(message);
+  }
+
+  std::vector<nlohmann::json> shard_results;
+  for (size_t i = 0; i < shard_count; i++) {
+    std::ifstream results_file(
+      work_directory / ("shard_" + std::to_string(i)) / "lanelet2_validation_results.json");
+    if (!results_file.is_open()) {
+      throw std::runtime_error("Shard " + std::to_string(i) + " did not write its results");
+    }
+    shard_results.push_back(nlohmann::json::parse(results_file));
+  }
+  std::filesystem::remove_all(work_directory);
+
+  return shard_results;
+}
+
+void merge_shard_results(
+  nlohmann::json & json_data, const std::vector<nlohmann::json> & shard_results)
+{
+  if (shard_results.empty()) {
+    throw std::invalid_argument("No shard results to merge");
+  }
+
+  for (size_t r = 0; r < json_data["requirements"].size(); r++) {
+    auto & validators = json_data["requirements"][r]["validators"];
+    for (size_t v = 0; v < validators.size(); v++) {
+      std::vector<const nlohmann::json *> shard_validators;
+      for (const auto & shard_result : shard_results) {
+        const nlohmann::json & shard_validator =
+          shard_result.at("requirements").at(r).at("validators").at(v);
+        if (shard_validator.value("name", "") != validators[v].value("name", "")) {
+          throw std::invalid_argument(
+            "Validators of the shards do not match " + validators[v].value("name", ""));
+        }
+        shard_validators.push_back(&shard_validator);
+      }
+
+      nlohmann::json merged = *shard_validators.front();
+      const nlohmann::json issues = merge_validator_issues(shard_validators);
+      merged["passed"] = std::none_of(issues.begin(), issues.end(), is_failure);
+      uint64_t suppressed_issues = 0;
+      for (const nlohmann::json * shard_validator : shard_validators) {
+        if (shard_validator->contains("outcome")) {
+          merged["outcome"] = shard_validator->at("outcome");
+        }
+        suppressed_issues += shard_validator->value("suppressed_issues", uint64_t{0});
+      }
+      if (suppressed_issues > 0) {
+        merged["suppressed_issues"] = suppressed_issues;
+      }
+      if (issues.empty()) {
+        merged.erase("issues");
+      } else {
+        merged["issues"] = issues;
+      }
+      validators[v] = merged;
+    }
+  }
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,532 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/streaming.hpp"
+
+#include "lanelet2_map_validator/compression.hpp"
+#include "lanelet2_map_validator/fail_fast.hpp"
+#include "lanelet2_map_validator/map_loader.hpp"
+#include "lanelet2_map_validator/progress.hpp"
+#include "lanelet2_map_validator/roi.hpp"
+
+#include <lanelet2_core/LaneletMap.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+constexpr double meters_per_degree = 111320.0;
+constexpr size_t max_relation_depth = 16;
+constexpr const char * global_context_code = "General.StreamingGlobalContext-001";
+
+// Read the next markup "<...>" of the stream and its offset in the file, skipping the text before
+// it. A '>' inside a quoted attribute value does not end the markup.
+bool read_markup(
+  std::istream & stream, std::uint64_t & position, std::string & markup,
+  std::uint64_t & markup_offset)
+{
+  markup.clear();
+  std::string chunk;
+  while (std::getline(stream, chunk, '>')) {
+    const std::uint64_t chunk_offset = position;
+    position += chunk.size() + 1;
+    if (markup.empty()) {
+      const size_t begin = chunk.find('<');
+      if (begin == std::string::npos) {
+        continue;
+      }
+      markup_offset = chunk_offset + begin;
+      markup = chunk.substr(begin);
+    } else {
+      markup += '>';
+      markup += chunk;
+    }
+
+    if (markup.rfind("<!--", 0) == 0) {
+      if (markup.size() >= 6 && markup.compare(markup.size() - 2, 2, "--") == 0) {
+        markup += '>';
+        return true;
+      }
+      continue;
+    }
+    char quote = 0;
+    for (const char c : markup) {
+      if (quote != 0) {
+        quote = (c == quote) ? 0 : quote;
+      } else if (c == '"' || c == '\'') {
+        quote = c;
+      }
+    }
+    if (quote == 0) {
+      markup += '>';
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string markup_name(const std::string & markup)
+{
+  const size_t end = markup.find_first_of(" \t\r\n/>", 2);
+  return markup.substr(1, end == std::string::npos ? std::string::npos : end - 1);
+}
+
+bool is_self_closing(const std::string & markup)
+{
+  return markup.size() >= 2 && markup[markup.size() - 2] == '/';
+}
+
+std::optional<std::string> attribute(const std::string & markup, const std::string & name)
+{
+  size_t pos = 0;
+  while ((pos = markup.find(name + "=", pos)) != std::string::npos) {
+    const size_t quote_pos = pos + name.size() + 1;
+    if (
+      pos > 0 && std::isspace(static_cast<unsigned char>(markup[pos - 1])) &&
+      quote_pos < markup.size() && (markup[quote_pos] == '"' || markup[quote_pos] == '\'')) {
+      const size_t value_end = markup.find(markup[quote_pos], quote_pos + 1);
+      if (value_end == std::string::npos) {
+        return std::nullopt;
+      }
+      return markup.substr(quote_pos + 1, value_end - quote_pos - 1);
+    }
+    pos = quote_pos;
+  }
+  return std::nullopt;
+}
+
+lanelet::Id id_attribute(const std::string & markup, const std::string & name)
+{
+  const auto value = attribute(markup, name);
+  if (!value) {
+    throw std::runtime_error("Missing attribute " + name + " in " + markup);
+  }
+  return std::stoll(*value);
+}
+
+std::optional<OsmTileIndex::ElementType> element_type(const std::string & name)
+{
+  if (name == "node") {
+    return OsmTileIndex::ElementType::Node;
+  }
+  if (name == "way") {
+    return OsmTileIndex::ElementType::Way;
+  }
+  if (name == "relation") {
+    return OsmTileIndex::ElementType::Relation;
+  }
+  return std::nullopt;
+}
+}  // namespace
+
+OsmTileIndex::OsmTileIndex(const std::filesystem::path & osm_file, const double tile_size)
+: osm_file_(osm_file), tile_size_(tile_size)
+{
+  if (tile_size_ <= 0.0) {
+    throw std::invalid_argument("The tile size must be positive");
+  }
+  // The tiles are read back by their byte offsets in the file
+  if (compression_of(osm_file_) != Compression::NONE) {
+    throw std::invalid_argument(
+      "Streaming validation needs an uncompressed map: " + osm_file_.string());
+  }
+  std::ifstream stream(osm_file_, std::ios::binary);
+  if (!stream.is_open()) {
+    throw std::runtime_error("Failed to open " + osm_file_.string());
+  }
+  read_elements(stream);
+  if (elements_[static_cast<size_t>(ElementType::Node)].empty()) {
+    throw std::runtime_error("No nodes found in " + osm_file_.string());
+  }
+  assign_tiles();
+}
+
+void OsmTileIndex::read_elements(std::istream & stream)
+{
+  std::uint64_t position = 0;
+  std::uint64_t header_end = 0;
+  std::string markup;
+  std::uint64_t markup_offset = 0;
+
+  std::optional<ElementKey> open_element;
+  Element element;
+  std::optional<double> longitude_scale;
+
+  const auto finish_element = [this](const ElementKey & key, Element & finished) {
+    elements_[static_cast<size_t>(key.first)][key.second] = std::move(finished);
+    finished = Element();
+  };
+
+  while (read_markup(stream, position, markup, markup_offset)) {
+    const std::string name = markup_name(markup);
+    if (!open_element) {
+      const auto type = element_type(name);
+      if (name == "osm") {
+        header_end = markup_offset + markup.size();
+        continue;
+      }
+      if (!type) {
+        continue;
+      }
+      element.offset = markup_offset;
+      const ElementKey key{*type, id_attribute(markup, "id")};
+      if (*type == ElementType::Node) {
+        const auto lat = attribute(markup, "lat");
+        const auto lon = attribute(markup, "lon");
+        if (!lat || !lon) {
+          throw std::runtime_error("Node " + std::to_string(key.second) + " has no lat/lon");
+        }
+        const double latitude = std::stod(*lat);
+        const double longitude = std::stod(*lon);
+        if (!longitude_scale) {
+          longitude_scale = std::max(0.01, std::cos(latitude * M_PI / 180.0));
+        }
+        const double tile_degrees = tile_size_ / meters_per_degree;
+        element.tile = {
+          static_cast<std::int64_t>(std::floor(latitude / tile_degrees)),
+          static_cast<std::int64_t>(std::floor(longitude * *longitude_scale / tile_degrees))};
+      }
+      if (is_self_closing(markup)) {
+        element.length = markup_offset + markup.size() - element.offset;
+        finish_element(key, element);
+      } else {
+        open_element = key;
+      }
+      continue;
+    }
+
+    if (name == "nd") {
+      element.references.emplace_back(ElementType::Node, id_attribute(markup, "ref"));
+    } else if (name == "member") {
+      const auto type = element_type(attribute(markup, "type").value_or(""));
+      if (type) {
+        element.references.emplace_back(*type, id_attribute(markup, "ref"));
+      }
+    } else if (element_type(name.substr(1)) == open_element->first && name.front() == '/') {
+      element.length = markup_offset + markup.size() - element.offset;
+      finish_element(*open_element, element);
+      open_element.reset();
+    }
+  }
+
+  stream.clear();
+  stream.seekg(0);
+  header_.resize(header_end);
+  stream.read(header_.data(), static_cast<std::streamsize>(header_end));
+}
+
+void OsmTileIndex::assign_tiles()
+{
+  // Ways and relations take the tile of their first member that has one
+  std::function<std::optional<TileKey>(const ElementKey &, const size_t)> resolve_tile =
+    [&](const ElementKey & key, const size_t depth) -> std::optional<TileKey> {
+    const Element * element = find(key);
+    if (!element) {
+      return std::nullopt;
+    }
+    if (key.first == ElementType::Node) {
+      return element->tile;
+    }
+    if (depth > max_relation_depth) {
+      return std::nullopt;
+    }
+    for (const auto & reference : element->references) {
+      if (const auto tile = resolve_tile(reference, depth + 1)) {
+        return tile;
+      }
+    }
+    return std::nullopt;
+  };
+
+  std::vector<ElementKey> unresolved;
+  for (size_t type = 0; type < elements_.size(); type++) {
+    for (auto & [id, element] : elements_[type]) {
+      const ElementKey key{static_cast<ElementType>(type), id};
+      const auto tile = resolve_tile(key, 0);
+      if (tile) {
+        element.tile = *tile;
+        tiles_[*tile].push_back(key);
+      } else {
+        unresolved.push_back(key);
+      }
+    }
+  }
+
+  // Elements without any node are owned by the first tile
+  for (const auto & key : unresolved) {
+    elements_[static_cast<size_t>(key.first)].at(key.second).tile = tiles_.begin()->first;
+    tiles_.begin()->second.push_back(key);
+  }
+  for (auto & [tile, owned] : tiles_) {
+    std::sort(owned.begin(), owned.end(), [this](const ElementKey & a, const ElementKey & b) {
+      return find(a)->offset < find(b)->offset;
+    });
+  }
+}
+
+const OsmTileIndex::Element * OsmTileIndex::find(const ElementKey & key) const
+{
+  const auto & elements = elements_[static_cast<size_t>(key.first)];
+  const auto it = elements.find(key.second);
+  return it == elements.end() ? nullptr : &it->second;
+}
+
+std::vector<OsmTileIndex::TileKey> OsmTileIndex::tiles() const
+{
+  std::vector<TileKey> tiles;
+  tiles.reserve(tiles_.size());
+  for (const auto & [tile, owned] : tiles_) {
+    tiles.push_back(tile);
+  }
+  return tiles;
+}
+
+const std::vector<OsmTileIndex::ElementKey> & OsmTileIndex::owned_elements(
+  const TileKey & tile) const
+{
+  static const std::vector<ElementKey> no_elements;
+  const auto it = tiles_.find(tile);
+  return it == tiles_.end() ? no_elements : it->second;
+}
+
+size_t OsmTileIndex::element_count() const
+{
+  size_t count = 0;
+  for (const auto & elements : elements_) {
+    count += elements.size();
+  }
+  return count;
+}
+
+const OsmTileIndex::TileKey & OsmTileIndex::tile_of(const ElementKey & element) const
+{
+  return elements_[static_cast<size_t>(element.first)].at(element.second).tile;
+}
+
+std::vector<OsmTileIndex::ElementKey> OsmTileIndex::elements_around(const TileKey & tile) const
+{
+  std::set<ElementKey> found;
+  std::vector<ElementKey> stack;
+  for (std::int64_t row = tile.first - 1; row <= tile.first + 1; row++) {
+    for (std::int64_t column = tile.second - 1; column <= tile.second + 1; column++) {
+      for (const auto & key : owned_elements({row, column})) {
+        if (found.insert(key).second) {
+          stack.push_back(key);
+        }
+      }
+    }
+  }
+  while (!stack.empty()) {
+    const ElementKey key = stack.back();
+    stack.pop_back();
+    for (const auto & reference : find(key)->references) {
+      if (find(reference) && found.insert(reference).second) {
+        stack.push_back(reference);
+      }
+    }
+  }
+
+  std::vector<ElementKey> elements(found.begin(), found.end());
+  std::sort(elements.begin(), elements.end(), [this](const ElementKey & a, const ElementKey & b) {
+    return std::make_pair(a.first, find(a)->offset) < std::make_pair(b.first, find(b)->offset);
+  });
+  return elements;
+}
+
+std::map<OsmTileIndex::ElementKey, std::string> OsmTileIndex::read_owned_elements(
+  const TileKey & tile) const
+{
+  std::ifstream stream(osm_file_, std::ios::binary);
+  if (!stream.is_open()) {
+    throw std::runtime_error("Failed to open " + osm_file_.string());
+  }
+  std::map<ElementKey, std::string> texts;
+  for (const auto & key : owned_elements(tile)) {
+    const Element * element = find(key);
+    std::string text(element->length, '\0');
+    stream.seekg(static_cast<std::streamoff>(element->offset));
+    stream.read(text.data(), static_cast<std::streamsize>(element->length));
+    if (!stream) {
+      throw std::runtime_error("Failed to read " + osm_file_.string());
+    }
+    texts.emplace(key, std::move(text));
+  }
+  return texts;
+}
+
+void OsmTileIndex::write_tile_map(
+  const TileKey & tile, OsmTileCache & cache, std::ostream & os) const
+{
+  os << header_ << '\n';
+  for (const auto & key : elements_around(tile)) {
+    os << "  " << cache.element_text(key) << '\n';
+  }
+  os << "</osm>\n";
+}
+
+OsmTileCache::OsmTileCache(const OsmTileIndex & index, const size_t capacity_bytes)
+: index_(index), capacity_bytes_(capacity_bytes)
+{
+}
+
+const std::string & OsmTileCache::element_text(const OsmTileIndex::ElementKey & element)
+{
+  const OsmTileIndex::TileKey & tile = index_.tile_of(element);
+  auto it = entries_.find(tile);
+  if (it != entries_.end()) {
+    recently_used_.splice(recently_used_.begin(), recently_used_, it->second.position);
+    return it->second.texts.at(element);
+  }
+
+  Entry entry;
+  entry.texts = index_.read_owned_elements(tile);
+  for (const auto & [key, text] : entry.texts) {
+    entry.bytes += text.size();
+  }
+  recently_used_.push_front(tile);
+  entry.position = recently_used_.begin();
+  size_bytes_ += entry.bytes;
+  it = entries_.emplace(tile, std::move(entry)).first;
+
+  while (size_bytes_ > capacity_bytes_ && recently_used_.size() > 1) {
+    const auto evicted = entries_.find(recently_used_.back());
+    size_bytes_ -= evicted->second.bytes;
+    entries_.erase(evicted);
+    recently_used_.pop_back();
+  }
+  return it->second.texts.at(element);
+}
+
+TileValidationResults validate_tiles(
+  const OsmTileIndex & index, const nlohmann::json & json_data, const MetaConfig & meta_config,
+  const ValidatorExclusionMap & exclusion_map, const ValidatorConfigPtr & config,
+  const size_t cache_bytes)
+{
+  OsmTileCache cache(index, cache_bytes);
+  const std::filesystem::path tile_file =
+    std::filesystem::temp_directory_path() /
+    ("lanelet2_map_validator_tile_" + std::to_string(getpid()) + ".osm");
+
+  const std::vector<OsmTileIndex::TileKey> tiles = index.tiles();
+  TileValidationResults results;
+  results.tile_results.reserve(tiles.size());
+  // Issues not bound to a primitive are found in every tile
+  std::set<std::string> unbound_loading_issues;
+  for (size_t i = 0; i < tiles.size(); i++) {
+    {
+      std::ofstream tile_stream(tile_file, std::ios::out | std::ios::trunc);
+      index.write_tile_map(tiles[i], cache, tile_stream);
+      if (!tile_stream) {
+        throw std::runtime_error("Failed to write " + tile_file.string());
+      }
+    }
+
+    const auto [tile_map, loading_issues] = loadAndValidateMap(
+      meta_config.projector_type, tile_file.string(),
+      meta_config.command_line_config.validationConfig);
+    if (!tile_map) {
+      throw std::runtime_error(
+        "Failed to load the tile (" + std::to_string(tiles[i].first) + ", " +
+        std::to_string(tiles[i].second) + ") of the map");
+    }
+
+    std::array<std::unordered_set<lanelet::Id>, 3> owned_ids;  // By OsmTileIndex::ElementType
+    const auto & owned_elements = index.owned_elements(tiles[i]);
+    for (const auto & [type, id] : owned_elements) {
+      owned_ids[static_cast<size_t>(type)].insert(id);
+    }
+    auto tile_context = std::make_shared<ValidationContext>(*ValidationContext::current());
+    tile_context->region_of_interest = RegionOfInterest::create_owned(
+      *tile_map, owned_ids[static_cast<size_t>(OsmTileIndex::ElementType::Node)],
+      owned_ids[static_cast<size_t>(OsmTileIndex::ElementType::Way)],
+      owned_ids[static_cast<size_t>(OsmTileIndex::ElementType::Relation)]);
+
+    for (const auto & detected_issues : loading_issues) {
+      for (const auto & issue : detected_issues.issues) {
+        if (!tile_context->region_of_interest->contains(issue)) {
+          continue;
+        }
+        const bool unbound =
+          issue.id == lanelet::InvalId ||
+          issue.primitive == lanelet::validation::Primitive::Primitive;
+        if (unbound && !unbound_loading_issues.insert(issue.buildReport()).second) {
+          continue;
+        }
+        results.loading_issues.push_back(issue);
+      }
+    }
+
+    nlohmann::json tile_json = json_data;
+    const auto tile_issues = validate_all_requirements(
+      tile_json, meta_config, *tile_map, exclusion_map, config, tile_context);
+    results.tile_results.push_back(std::move(tile_json));
+
+    report_progress(
+      "tile_finished", {{"tile", i},
+                        {"total", tiles.size()},
+                        {"elements", owned_elements.size()},
+                        {"cache_bytes", cache.size_bytes()}});
+
+    // The remaining tiles are not validated once --fail_fast found an error
+    if (meta_config.fail_fast && has_error(tile_issues)) {
+      break;
+    }
+  }
+  std::filesystem::remove(tile_file);
+
+  return results;
+}
+
+void mark_global_context_validators(nlohmann::json & json_data, const ValidatorConfig & config)
+{
+  const YAML::Node parameters = config.parameters();
+  for (auto & requirement : json_data["requirements"]) {
+    for (auto & validator : requirement["validators"]) {
+      const std::string name = validator.value("name", "");
+      if (!parameters[name] || !parameters[name]["global_context"]) {
+        continue;
+      }
+      if (!parameters[name]["global_context"].as<bool>()) {
+        continue;
+      }
+      nlohmann::json issue_json;
+      issue_json["severity"] = lanelet::validation::toString(lanelet::validation::Severity::Info);
+      issue_json["primitive"] =
+        lanelet::validation::toString(lanelet::validation::Primitive::Primitive);
+      issue_json["id"] = 0;
+      issue_json["issue_code"] = global_context_code;
+      issue_json["message"] =
+        "This validator needs the whole map but was run tile by tile, so its results may be "
+        "incomplete.";
+      validator["issues"].push_back(issue_json);
+    }
+  }
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,139 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/thread_pool.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+thread_local bool is_parallel_task = false;
+
+std::atomic<size_t> requested_jobs{0};
+
+std::mutex shared_pool_mutex;
+std::shared_ptr<ThreadPool> shared_pool;
+}  // namespace
+
+ThreadPool::ThreadPool(const size_t num_threads)
+{
+  workers_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; i++) {
+    workers_.emplace_back([this]() { worker_loop(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+}
+
+std::future<void> ThreadPool::submit(std::function<void()> task)
+{
+  std::packaged_task<void()> packaged(std::move(task));
+  std::future<void> future = packaged.get_future();
+
+  // Run the task in place if there is no worker to take it
+  if (workers_.empty()) {
+    packaged();
+    return future;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push(std::move(packaged));
+  }
+  condition_.notify_one();
+  return future;
+}
+
+void ThreadPool::worker_loop()
+{
+  is_parallel_task = true;
+  while (true) {
+    std::packaged_task<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+bool in_parallel_task()
+{
+  return is_parallel_task;
+}
+
+ParallelTaskScope::ParallelTaskScope() : previous_(is_parallel_task)
+{
+  is_parallel_task = true;
+}
+
+ParallelTaskScope::~ParallelTaskScope()
+{
+  is_parallel_task = previous_;
+}
+
+void set_parallel_jobs(const size_t jobs)
+{
+  requested_jobs = jobs;
+
+  // Drop the pool so that the next parallel_for creates one with the new size. Callers still
+  // holding the old pool keep it alive until they release it.
+  std::shared_ptr<ThreadPool> old_pool;
+  {
+    std::lock_guard<std::mutex> lock(shared_pool_mutex);
+    if (shared_pool && shared_pool->size() + 1 != parallel_jobs()) {
+      old_pool = std::move(shared_pool);
+    }
+  }
+}
+
+size_t parallel_jobs()
+{
+  const size_t jobs = requested_jobs;
+  if (jobs > 0) {
+    return jobs;
+  }
+  return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+std::shared_ptr<ThreadPool> shared_thread_pool()
+{
+  std::lock_guard<std::mutex> lock(shared_pool_mutex);
+  if (!shared_pool) {
+    shared_pool = std::make_shared<ThreadPool>(parallel_jobs() - 1);
+  }
+  return shared_pool;
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,105 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/timing_profile.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+TimingProfile TimingProfile::load(const std::filesystem::path & file)
+{
+  TimingProfile profile;
+  if (!std::filesystem::exists(file)) {
+    return profile;
+  }
+
+  std::ifstream input(file);
+  if (!input) {
+    throw std::runtime_error("Failed to open the timing profile " + file.string());
+  }
+  try {
+    const nlohmann::json profile_json = nlohmann::json::parse(input);
+    for (const auto & [name, timing] : profile_json.at("validators").items()) {
+      profile.record(name, timing.at("elapsed_ms").get<double>());
+    }
+  } catch (const nlohmann::json::exception & e) {
+    throw std::runtime_error("Invalid timing profile " + file.string() + ": " + e.what());
+  }
+  return profile;
+}
+
+void TimingProfile::save(const std::filesystem::path & file) const
+{
+  nlohmann::json validators_json = nlohmann::json::object();
+  for (const auto & [name, elapsed_ms] : elapsed_ms_) {
+    validators_json[name] = {{"elapsed_ms", elapsed_ms}};
+  }
+
+  std::ofstream output(file);
+  if (!output) {
+    throw std::runtime_error("Failed to write the timing profile " + file.string());
+  }
+  output << std::setw(4) << nlohmann::json{{"validators", validators_json}} << std::endl;
+}
+
+std::optional<double> TimingProfile::elapsed_ms(const std::string & validator_name) const
+{
+  const auto it = elapsed_ms_.find(validator_name);
+  if (it == elapsed_ms_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+void TimingProfile::record(const std::string & validator_name, const double elapsed_ms)
+{
+  elapsed_ms_[validator_name] = elapsed_ms;
+}
+
+double estimated_cost_ms(const ValidatorConfig & config, const std::string & validator_name)
+{
+  const YAML::Node parameters = config.parameters();
+  if (parameters[validator_name] && parameters[validator_name]["estimated_cost_ms"]) {
+    try {
+      return parameters[validator_name]["estimated_cost_ms"].as<double>();
+    } catch (const std::exception & e) {
+      std::cerr << "Type mismatch for parameter \"estimated_cost_ms\" of " << validator_name
+                << ": " << e.what() << std::endl;
+    }
+  }
+  return default_validator_cost_ms;
+}
+
+ValidatorCosts estimate_validator_costs(
+  const Validators & validators, const ValidatorConfig & config,
+  const TimingProfile * timing_profile)
+{
+  ValidatorCosts costs;
+  for (const auto & [name, info] : validators) {
+    const std::optional<double> elapsed_ms =
+      timing_profile ? timing_profile->elapsed_ms(name) : std::nullopt;
+    costs[name] = elapsed_ms ? *elapsed_ms : estimated_cost_ms(config, name);
+  }
+  return costs;
+}
+
+}  // namespace lanelet::autoware::validation
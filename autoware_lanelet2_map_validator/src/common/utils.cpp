@@ -15,13 +15,15 @@
 #include "lanelet2_map_validator/utils.hpp"
 
 #include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/fail_fast.hpp"
+#include "lanelet2_map_validator/issue_cap.hpp"
+#include "lanelet2_map_validator/issue_message.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
 
 #include <boost/geometry/algorithms/area.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/intersection.hpp>
 
-#include <fmt/args.h>
-#include <fmt/core.h>
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <map>
@@ -96,7 +98,7 @@ lanelet::validation::Issue construct_issue_from_code(
   const std::map<std::string, std::string> & substitutions)
 {
   lanelet::validation::Issue result;
-  const nlohmann::json issues_info =
+  const nlohmann::json & issues_info =
     lanelet::autoware::validation::ValidatorConfigStore::issues_info()[issue_code];
   std::string severity_str = issues_info["severity"].get<std::string>();
   std::string primitive_str = issues_info["primitive"].get<std::string>();
@@ -131,14 +133,30 @@ lanelet::validation::Issue construct_issue_from_code(
 
   result.id = primitive_id;
 
-  fmt::dynamic_format_arg_store<fmt::format_context> arg_store;
-  for (const auto & [key, value] : substitutions) {
-    arg_store.push_back(fmt::arg(key.c_str(), value));
-  }
-  const std::string language = lanelet::autoware::validation::ValidatorConfigStore::language();
-  const std::string main_message =
-    fmt::vformat(issues_info["message"][language].get<std::string>(), arg_store);
-  result.message = "[" + issue_code + "] " + main_message;
+  result.message = "[" + issue_code + "] " +
+                   lanelet::autoware::validation::render_issue_text(
+                     issue_code, substitutions,
+                     *lanelet::autoware::validation::ValidatorConfigStore::current());
 
   return result;
 }
+
+void add_issue_from_code(
+  lanelet::validation::Issues & issues, const std::string & issue_code,
+  const lanelet::Id primitive_id, const std::map<std::string, std::string> & substitutions)
+{
+  const auto & context = *lanelet::autoware::validation::ValidationContext::current();
+  const auto & issue_cap = context.issue_cap;
+  const auto & fail_fast = context.fail_fast;
+  if (issue_cap && !issue_cap->admit(issue_code, primitive_id)) {
+    // An issue past the cap can still be the first one that is not excluded
+    if (fail_fast && !fail_fast->failed()) {
+      fail_fast->report(construct_issue_from_code(issue_code, primitive_id, substitutions));
+    }
+    return;
+  }
+  issues.push_back(construct_issue_from_code(issue_code, primitive_id, substitutions));
+  if (fail_fast) {
+    fail_fast->report(issues.back());
+  }
+}
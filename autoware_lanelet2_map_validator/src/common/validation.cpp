@@ -14,19 +14,36 @@
 
 #include "lanelet2_map_validator/validation.hpp"
 
+#include "lanelet2_map_validator/fail_fast.hpp"
+#include "lanelet2_map_validator/issue_cap.hpp"
+#include "lanelet2_map_validator/issue_locator.hpp"
+#include "lanelet2_map_validator/progress.hpp"
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
+#include "lanelet2_map_validator/timing_profile.hpp"
+
+#include <lanelet2_core/LaneletMap.h>
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <list>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <queue>
-#include <regex>
 #include <set>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -45,10 +62,17 @@ namespace lanelet::autoware::validation
 {
 
 std::vector<lanelet::validation::DetectedIssues> apply_validation(
-  const lanelet::LaneletMap & lanelet_map, const lanelet::validation::ValidationConfig & val_config)
+  const lanelet::LaneletMap & lanelet_map, const lanelet::validation::ValidationConfig & val_config,
+  const ValidatorConfigPtr & config, const ValidationContextPtr & context)
 {
-  return lanelet::validation::validateMap(
-    const_cast<lanelet::LaneletMap &>(lanelet_map), val_config);
+  const ValidatorConfigStore::Scope config_scope(config);
+  const ValidationContext::Scope context_scope(context);
+  auto issues =
+    lanelet::validation::validateMap(const_cast<lanelet::LaneletMap &>(lanelet_map), val_config);
+
+  // Validators also check primitives around the region of interest, whose issues are not reported
+  filter_out_issues_outside_roi(issues, *context);
+  return issues;
 }
 
 Validators parse_validators(const json & json_data)
@@ -74,12 +98,12 @@ Validators parse_validators(const json & json_data)
 }
 
 std::tuple<std::queue<ValidatorName>, Validators> create_validation_queue(
-  const Validators & validators)
+  const Validators & validators, const ValidatorCosts & costs)
 {
   std::unordered_map<ValidatorName, std::vector<ValidatorName>>
     graph;  // Adjacency list graph of dependencies, i.e. V is dependent on K
   std::unordered_map<ValidatorName, int> indegree;  // Indegree (number of prerequisites)
-  std::queue<ValidatorName> validation_queue;
+  std::vector<ValidatorName> topological_order;
   Validators remaining_validators;  // Validators left unprocessed
 
   // Build the graph and initialize indegree
@@ -97,6 +121,7 @@ std::tuple<std::queue<ValidatorName>, Validators> create_validation_queue(
       indegree[name]++;               // Increment the indegree of the validator
     }
   }
+  const std::unordered_map<ValidatorName, int> initial_indegree = indegree;
 
   // Use a queue to store validators with no prerequisites (indegree == 0)
   std::queue<ValidatorName> q;
@@ -107,13 +132,11 @@ std::tuple<std::queue<ValidatorName>, Validators> create_validation_queue(
     }
   }
 
-  // Perform topological sort to derive execution order
+  // Perform topological sort to find the validators that can be run
   while (!q.empty()) {
     std::string current_validator_name = q.front();
     q.pop();
-
-    // Add the current validator to the execution queue
-    validation_queue.push(current_validator_name);
+    topological_order.push_back(current_validator_name);
 
     // For each dependent validator, reduce indegree and add to the queue if indegree becomes 0
     for (const auto & to_do_next : graph[current_validator_name]) {
@@ -129,6 +152,51 @@ std::tuple<std::queue<ValidatorName>, Validators> create_validation_queue(
     info.max_severity = ValidatorInfo::Severity::ERROR;
   }
 
+  // The rank of a validator is its cost plus the largest rank of the validators depending on it,
+  // i.e. the time until the end of the longest chain starting from it
+  std::unordered_map<ValidatorName, double> rank;
+  for (auto it = topological_order.rbegin(); it != topological_order.rend(); ++it) {
+    double dependent_rank = 0.0;
+    for (const auto & dependent : graph[*it]) {
+      if (const auto dependent_it = rank.find(dependent); dependent_it != rank.end()) {
+        dependent_rank = std::max(dependent_rank, dependent_it->second);
+      }
+    }
+    const auto cost_it = costs.find(*it);
+    rank[*it] = (cost_it != costs.end() ? cost_it->second : default_validator_cost_ms) +
+                dependent_rank;
+  }
+
+  // Derive the execution order, taking the ready validator with the highest rank first
+  const auto runs_earlier = [&rank](const ValidatorName & a, const ValidatorName & b) {
+    const double rank_a = rank.at(a);
+    const double rank_b = rank.at(b);
+    return rank_a != rank_b ? rank_a > rank_b : a < b;
+  };
+  std::set<ValidatorName, decltype(runs_earlier)> ready(runs_earlier);
+  indegree = initial_indegree;
+  for (const auto & name : topological_order) {
+    if (indegree[name] == 0) {
+      ready.insert(name);
+    }
+  }
+
+  std::queue<ValidatorName> validation_queue;
+  while (!ready.empty()) {
+    const ValidatorName current_validator_name = *ready.begin();
+    ready.erase(ready.begin());
+
+    // Add the current validator to the execution queue
+    validation_queue.push(current_validator_name);
+
+    for (const auto & to_do_next : graph[current_validator_name]) {
+      indegree[to_do_next]--;
+      if (indegree[to_do_next] == 0) {
+        ready.insert(to_do_next);
+      }
+    }
+  }
+
   return {validation_queue, remaining_validators};
 }
 
@@ -225,44 +293,222 @@ std::vector<lanelet::validation::DetectedIssues> check_prerequisite_completion(
   return detected_issues;
 }
 
-void summarize_validator_results(json & json_data)
+std::optional<std::chrono::steady_clock::time_point> global_deadline(
+  const MetaConfig & validator_config)
 {
-  uint64_t warning_count = 0;
-  uint64_t error_count = 0;
+  if (validator_config.global_deadline <= 0.0) {
+    return std::nullopt;
+  }
+  return validator_config.start_time +
+         std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+           std::chrono::duration<double>(validator_config.global_deadline));
+}
 
-  for (auto & requirement : json_data["requirements"]) {
+std::optional<std::chrono::steady_clock::time_point> validator_deadline(
+  const MetaConfig & validator_config, const std::chrono::steady_clock::time_point & start)
+{
+  std::optional<std::chrono::steady_clock::time_point> deadline = global_deadline(validator_config);
+  if (validator_config.timeout_per_validator > 0.0) {
+    const auto timeout_deadline =
+      start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(validator_config.timeout_per_validator));
+    deadline = deadline ? std::min(*deadline, timeout_deadline) : timeout_deadline;
+  }
+  return deadline;
+}
+
+std::shared_ptr<IssueCap> create_issue_cap(
+  const MetaConfig & validator_config, const ValidatorConfig & config,
+  const ValidatorName & validator_name)
+{
+  const size_t max_issues =
+    max_issues_per_code(config, validator_name, validator_config.max_issues_per_code);
+  if (max_issues == 0) {
+    return nullptr;
+  }
+  return std::make_shared<IssueCap>(max_issues, validator_config.stop_at_issue_cap);
+}
+
+namespace
+{
+constexpr const char * timeout_outcome = "timeout";
+constexpr const char * cancelled_outcome = "cancelled";
+
+// A validator started by validate_all_requirements()
+struct ValidatorRun
+{
+  ValidatorName validator_name;
+  size_t index = 0;  // Order in which the validators were started
+  std::chrono::steady_clock::time_point start;
+  std::optional<std::chrono::steady_clock::time_point> deadline;
+  bool skipped = false;
+  bool cancelled = false;
+  bool started = false;      // Whether the validator itself runs
+  bool speculative = false;  // Started before its prerequisites finished and not confirmed yet
+  bool discarded = false;    // Speculatively started but skipped or cancelled in the end
+  bool completed = false;    // The task running the validator has finished
+  ValidationContextPtr context;
+  std::shared_ptr<IssueCap> issue_cap;
+  std::shared_ptr<std::atomic<bool>> stop_flag;
+  std::vector<lanelet::validation::DetectedIssues> issues;
+
+  // Written by the task running the validator
+  std::vector<lanelet::validation::DetectedIssues> validator_issues;
+  double elapsed_ms = 0.0;
+  bool stopped_at_deadline = false;  // The deadline stopped the validator before it finished
+  std::exception_ptr exception = nullptr;
+};
+
+// Indices of the validators finished on the shared thread pool, in the order they finished
+class CompletionQueue
+{
+public:
+  void push(const size_t run_index)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      finished_.push(run_index);
+    }
+    condition_.notify_one();
+  }
+
+  size_t pop()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this]() { return !finished_.empty(); });
+    const size_t run_index = finished_.front();
+    finished_.pop();
+    return run_index;
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::queue<size_t> finished_;
+};
+
+void add_timeout_issue(
+  std::vector<lanelet::validation::DetectedIssues> & issues, const ValidatorName & validator_name,
+  const bool started)
+{
+  lanelet::validation::Issue issue;
+  issue.severity = lanelet::validation::Severity::Error;
+  issue.primitive = lanelet::validation::Primitive::Primitive;
+  issue.id = lanelet::InvalId;
+  issue.message =
+    started ? "[General.ValidationTimeout-001] Validator " + validator_name +
+                " was stopped at its deadline, so its issues are incomplete."
+            : "[General.ValidationTimeout-001] Validator " + validator_name +
+                " was not run since the global deadline had passed.";
+
+  if (issues.empty()) {
+    issues.push_back({validator_name, {issue}});
+  } else {
+    issues[0].issues.push_back(issue);
+  }
+}
+
+void add_cancelled_issue(
+  std::vector<lanelet::validation::DetectedIssues> & issues, const ValidatorName & validator_name,
+  const ValidatorName & failed_validator_name, const bool started = false)
+{
+  lanelet::validation::Issue issue;
+  issue.severity = lanelet::validation::Severity::Error;
+  issue.primitive = lanelet::validation::Primitive::Primitive;
+  issue.id = lanelet::InvalId;
+  issue.message = "[General.ValidationCancelled-001] Validator " + validator_name +
+                  (started ? " was stopped" : " was not run") +
+                  " since --fail_fast stopped the validation at an error of " +
+                  failed_validator_name + ".";
+  issues.push_back({validator_name, {issue}});
+}
+
+void add_suppressed_issues(
+  std::vector<lanelet::validation::DetectedIssues> & issues, const ValidatorName & validator_name,
+  const IssueCap & issue_cap)
+{
+  lanelet::validation::Issues summary_issues = issue_cap.summary_issues();
+  if (summary_issues.empty()) {
+    return;
+  }
+
+  if (issues.empty()) {
+    issues.push_back({validator_name, std::move(summary_issues)});
+  } else {
+    issues[0].issues.insert(
+      issues[0].issues.end(), summary_issues.begin(), summary_issues.end());
+  }
+}
+
+// Compute the centerlines of all lanelets of the map. lanelet2 computes them lazily and caches them
+// in the lanelets without synchronization, e.g. in ConstLanelet::centerline() or in the lengths
+// used by RoutingGraph::build(), so validators running at the same time must only read them.
+void compute_centerlines(const lanelet::LaneletMap & map)
+{
+  for (const lanelet::ConstLanelet & lanelet : map.laneletLayer) {
+    lanelet.centerline();
+  }
+}
+
+void report_validator_finished(
+  const ValidatorName & validator_name, const size_t index, const size_t total,
+  const std::chrono::steady_clock::time_point & start, const bool skipped, const bool timed_out,
+  const bool cancelled, const bool passed,
+  const std::vector<lanelet::validation::DetectedIssues> & issues)
+{
+  if (!progress_enabled()) {
+    return;
+  }
+
+  size_t errors = 0;
+  size_t warnings = 0;
+  size_t infos = 0;
+  for (const auto & detected_issues : issues) {
+    for (const auto & issue : detected_issues.issues) {
+      if (issue.severity == lanelet::validation::Severity::Error) {
+        errors++;
+      } else if (issue.severity == lanelet::validation::Severity::Warning) {
+        warnings++;
+      } else {
+        infos++;
+      }
+    }
+  }
+
+  report_progress(
+    "validator_finished",
+    {{"validator", validator_name},
+     {"index", index},
+     {"total", total},
+     {"elapsed_ms",
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()},
+     {"skipped", skipped},
+     {"timeout", timed_out},
+     {"cancelled", cancelled},
+     {"passed", passed},
+     {"errors", errors},
+     {"warnings", warnings},
+     {"infos", infos}});
+}
+
+void summarize_requirements(
+  json & json_data, const uint64_t warning_count, const uint64_t error_count)
+{
+  evaluate_requirements(json_data);
+
+  for (const auto & requirement : json_data["requirements"]) {
     std::string id = requirement["id"];
-    bool is_requirement_passed = true;
     std::map<std::string, bool> validator_results;
 
     for (const auto & validator : requirement["validators"]) {
-      bool validator_passed = validator["passed"];
-      validator_results[validator["name"]] = validator_passed;
-      is_requirement_passed &= validator_passed;
-
-      if (!validator.contains("issues")) {
-        continue;
-      }
-      for (const auto & issue : validator["issues"]) {
-        if (
-          issue["severity"] ==
-          lanelet::validation::toString(lanelet::validation::Severity::Warning)) {
-          warning_count++;
-        } else if (
-          issue["severity"] ==
-          lanelet::validation::toString(lanelet::validation::Severity::Error)) {
-          error_count++;
-        }
-      }
+      validator_results[validator["name"]] = validator["passed"];
     }
 
     std::cout << BOLD_ONLY << "[" << id << "] ";
 
-    if (is_requirement_passed) {
-      requirement["passed"] = true;
+    if (requirement["passed"]) {
       std::cout << BOLD_GREEN << "Passed" << FONT_RESET << std::endl;
     } else {
-      requirement["passed"] = false;
       std::cout << BOLD_RED << "Failed" << FONT_RESET << std::endl;
     }
 
@@ -288,6 +534,60 @@ void summarize_validator_results(json & json_data)
     }
   }
 }
+}  // namespace
+
+void evaluate_requirements(json & json_data)
+{
+  for (auto & requirement : json_data["requirements"]) {
+    bool is_requirement_passed = true;
+    for (const auto & validator : requirement["validators"]) {
+      is_requirement_passed &= validator["passed"].get<bool>();
+    }
+    requirement["passed"] = is_requirement_passed;
+  }
+}
+
+void summarize_validator_results(json & json_data)
+{
+  uint64_t warning_count = 0;
+  uint64_t error_count = 0;
+
+  for (const auto & requirement : json_data["requirements"]) {
+    for (const auto & validator : requirement["validators"]) {
+      if (!validator.contains("issues")) {
+        continue;
+      }
+      for (const auto & issue : validator["issues"]) {
+        if (
+          issue["severity"] ==
+          lanelet::validation::toString(lanelet::validation::Severity::Warning)) {
+          warning_count++;
+        } else if (
+          issue["severity"] ==
+          lanelet::validation::toString(lanelet::validation::Severity::Error)) {
+          error_count++;
+        }
+      }
+    }
+  }
+
+  summarize_requirements(json_data, warning_count, error_count);
+}
+
+void summarize_validator_results(json & json_data, const IssueCounts & issue_counts)
+{
+  summarize_requirements(json_data, issue_counts.warnings, issue_counts.errors);
+}
+
+IssueCounts count_issues(const std::vector<lanelet::validation::DetectedIssues> & issues)
+{
+  IssueCounts issue_counts;
+  for (const auto & detected_issues : issues) {
+    issue_counts.warnings += detected_issues.warnings().size();
+    issue_counts.errors += detected_issues.errors().size();
+  }
+  return issue_counts;
+}
 
 lanelet::validation::ValidationConfig replace_validator(
   const lanelet::validation::ValidationConfig & input, const ValidatorName & validator_name)
@@ -299,14 +599,18 @@ lanelet::validation::ValidationConfig replace_validator(
 
 std::vector<lanelet::validation::DetectedIssues> validate_all_requirements(
   json & json_data, const MetaConfig & validator_config, const lanelet::LaneletMap & lanelet_map,
-  const ValidatorExclusionMap & exclusion_map)
+  const ValidatorExclusionMap & exclusion_map, const ValidatorConfigPtr & config,
+  const ValidationContextPtr & context, ResultsWriter * results_writer,
+  TimingProfile * timing_profile)
 {
+  const ValidatorConfigStore::Scope config_scope(config);
+  const ValidationContext::Scope context_scope(context);
   std::vector<lanelet::validation::DetectedIssues> total_issues;
-  std::regex issue_code_pattern(R"(\[(.+?)\]\s*(.+))");
 
-  // List up validators in order
+  // List up validators in order, the most expensive ones first
   Validators validators = parse_validators(json_data);
-  auto [validation_queue, remaining_validators] = create_validation_queue(validators);
+  auto [validation_queue, remaining_validators] = create_validation_queue(
+    validators, estimate_validator_costs(validators, *config, timing_profile));
 
   // Note validators that cannot be run from the start
   if (auto unused_validator_issues =
@@ -315,30 +619,149 @@ std::vector<lanelet::validation::DetectedIssues> validate_all_requirements(
     appendIssues(total_issues, std::move(unused_validator_issues));
   }
 
-  // Main validation process
-  while (!validation_queue.empty()) {
-    const std::string validator_name = validation_queue.front();
-    validation_queue.pop();
+  std::list<ValidatorName> pending_validators;
+  for (; !validation_queue.empty(); validation_queue.pop()) {
+    pending_validators.push_back(validation_queue.front());
+  }
+
+  // Validators run on the calling thread one after another unless --validator_jobs is given
+  const std::shared_ptr<ThreadPool> pool = shared_thread_pool();
+  const size_t num_validators = pending_validators.size();
+  const size_t max_running_validators =
+    validator_config.validator_jobs > 1
+      ? std::max<size_t>(1, std::min(validator_config.validator_jobs, pool->size()))
+      : 1;
+  if (max_running_validators > 1) {
+    compute_centerlines(lanelet_map);
+  }
+
+  std::vector<ValidatorRun> runs;
+  runs.reserve(num_validators);  // Running tasks refer to the elements
+  std::unordered_set<ValidatorName> finished_validators;
+  std::optional<ValidatorName> failed_validator_name;  // The validator that stopped --fail_fast
+
+  // With --fail_fast, the first error of a running validator stops the others running with it
+  const auto run_failure =
+    validator_config.fail_fast ? std::make_shared<std::atomic<bool>>(false) : nullptr;
+
+  const auto create_run = [&](const ValidatorName & validator_name, const bool speculative)
+    -> ValidatorRun & {
+    ValidatorRun & run = runs.emplace_back();
+    run.validator_name = validator_name;
+    run.index = runs.size() - 1;
+    run.speculative = speculative;
+    report_progress(
+      "validator_started", {{"validator", validator_name},
+                            {"index", run.index},
+                            {"total", num_validators},
+                            {"speculative", speculative}});
+    run.start = std::chrono::steady_clock::now();
+    run.deadline = validator_deadline(validator_config, run.start);
+    return run;
+  };
+
+  // Decide whether a validator whose prerequisites have finished runs, as of its start
+  const auto check_prerequisites = [&](ValidatorRun & run) {
+    const ValidatorName & validator_name = run.validator_name;
 
     // Check prerequisites are OK
-    const auto prerequisite_issues = check_prerequisite_completion(validators, validator_name);
+    auto prerequisite_issues = check_prerequisite_completion(validators, validator_name);
+    run.skipped = !prerequisite_issues.empty();
+    const auto run_deadline = global_deadline(validator_config);
+    run.cancelled = !run.skipped && failed_validator_name.has_value();
+    run.started =
+      !run.skipped && !run.cancelled && !(run_deadline && run.start >= *run_deadline);
 
     // NOTE: if prerequisite_issues is not empty, skip the content validation process
-    auto issues =
-      prerequisite_issues.empty()
-        ? apply_validation(
-            lanelet_map, replace_validator(
-                           validator_config.command_line_config.validationConfig, validator_name))
-        : std::move(prerequisite_issues);
+    if (run.skipped) {
+      run.issues = std::move(prerequisite_issues);
+    } else if (run.cancelled) {
+      add_cancelled_issue(run.issues, validator_name, *failed_validator_name);
+    }
+  };
+
+  // The context of a validator is the one of the whole run with the limits of the validator
+  const auto configure_run = [&](ValidatorRun & run) {
+    auto run_context = std::make_shared<ValidationContext>(*context);
+    run_context->deadline = run.deadline;
+    if (run.deadline) {
+      run_context->deadline_hit = std::make_shared<std::atomic<bool>>(false);
+    }
+    run.issue_cap = create_issue_cap(validator_config, *config, run.validator_name);
+    run_context->issue_cap = run.issue_cap;
+    if (validator_config.fail_fast) {
+      run_context->fail_fast = std::make_shared<FailFast>(
+        exclusion_map.at(run.validator_name), run_failure, !run.speculative);
+    }
+    if (run.speculative) {
+      run.stop_flag = std::make_shared<std::atomic<bool>>(false);
+      run_context->stop_flag = run.stop_flag;
+    }
+    run.context = std::move(run_context);
+  };
+
+  // Only the validator name and the context of the run are read here, since the calling thread
+  // keeps updating the other fields of a speculative run
+  const auto run_validator = [&](ValidatorRun & run) {
+    const auto begin = std::chrono::steady_clock::now();
+    run.validator_issues = apply_validation(
+      lanelet_map,
+      replace_validator(validator_config.command_line_config.validationConfig, run.validator_name),
+      config, run.context);
+    run.stopped_at_deadline = run.context->deadline_hit && run.context->deadline_hit->load();
+    run.elapsed_ms =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+  };
+
+  // Add the results of a validator that ran or was not run to the json data
+  const auto finish_validator = [&](ValidatorRun & run) {
+    const ValidatorName & validator_name = run.validator_name;
+    auto & issues = run.issues;
+    finished_validators.insert(validator_name);
+    if (timing_profile && run.started) {
+      timing_profile->record(validator_name, run.elapsed_ms);
+    }
 
     // Remove issues of primitives to ignore
     filter_out_primitives(issues, exclusion_map.at(validator_name));
 
+    // Issues past the cap are listed as one summary issue per issue code
+    if (run.issue_cap) {
+      add_suppressed_issues(issues, validator_name, *run.issue_cap);
+    }
+
+    // The issues of a validator stopped at its deadline are partial, so it fails. A validator that
+    // finished its checks after its deadline without being stopped keeps its results.
+    const bool timed_out =
+      !run.skipped && !run.cancelled && (!run.started || run.stopped_at_deadline);
+    if (timed_out) {
+      add_timeout_issue(issues, validator_name, run.started);
+    }
+
+    // With --fail_fast, the first error not excluded cancels the validators not started yet
+    if (validator_config.fail_fast && !failed_validator_name && has_error(issues)) {
+      failed_validator_name = validator_name;
+    }
+
     // Add validation results to the json data
     json & validator_json = find_validator_block(json_data, validator_name);
+    if (timed_out) {
+      validator_json["outcome"] = timeout_outcome;
+    } else if (run.cancelled) {
+      validator_json["outcome"] = cancelled_outcome;
+    }
+    if (run.issue_cap && run.issue_cap->suppressed_count() > 0) {
+      validator_json["suppressed_issues"] = run.issue_cap->suppressed_count();
+    }
     if (issues.empty()) {
       validator_json["passed"] = true;
-      continue;
+      if (results_writer) {
+        results_writer->add_validator_issues(validator_json, {});
+      }
+      report_validator_finished(
+        validator_name, run.index, num_validators, run.start, run.skipped, timed_out,
+        run.cancelled, true, issues);
+      return;
     }
 
     if (issues[0].warnings().size() + issues[0].errors().size() == 0) {
@@ -346,35 +769,195 @@ std::vector<lanelet::validation::DetectedIssues> validate_all_requirements(
     } else {
       validator_json["passed"] = false;
     }
-    if (!issues[0].issues.empty()) {
+    for (const auto & issue : issues[0].issues) {
+      if (
+        static_cast<int>(issue.severity) <
+        static_cast<int>(validators[validator_name].max_severity)) {
+        validators[validator_name].max_severity =
+          static_cast<ValidatorInfo::Severity>(static_cast<int>(issue.severity));
+      }
+    }
+
+    // Issues are either streamed to the results file, which only keeps their numbers, or kept in
+    // the json data
+    if (results_writer) {
+      results_writer->add_validator_issues(validator_json, issues[0].issues);
+    } else if (!issues[0].issues.empty()) {
       json issues_json;
       for (const auto & issue : issues[0].issues) {
-        std::smatch matches;
-        json issue_json;
-        issue_json["severity"] = lanelet::validation::toString(issue.severity);
-        issue_json["primitive"] = lanelet::validation::toString(issue.primitive);
-        issue_json["id"] = issue.id;
-        if (std::regex_match(issue.message, matches, issue_code_pattern)) {
-          issue_json["issue_code"] = matches[1];
-          issue_json["message"] = matches[2];
-        } else {
-          // Issue messages not matching the issue code format will be output as it is
-          issue_json["message"] = issue.message;
+        issues_json.push_back(issue_to_json(issue, *context));
+        if (context->issue_locator) {
+          context->issue_locator->add_to_index(validator_name, issues_json.back());
         }
-        issues_json.push_back(issue_json);
+      }
+      validator_json["issues"] = issues_json;
+    }
+    report_validator_finished(
+      validator_name, run.index, num_validators, run.start, run.skipped, timed_out, run.cancelled,
+      validator_json["passed"].get<bool>(), issues);
+    if (!results_writer) {
+      appendIssues(total_issues, issues);
+    }
+  };
 
-        if (
-          static_cast<int>(issue.severity) <
-          static_cast<int>(validators[validator_name].max_severity)) {
-          validators[validator_name].max_severity =
-            static_cast<ValidatorInfo::Severity>(static_cast<int>(issue.severity));
+  // Whether all prerequisites of the validator are in the set
+  const auto prerequisites_in =
+    [&](const ValidatorName & validator_name, const std::unordered_set<ValidatorName> & names) {
+      for (const auto & [prereq, forgive_warnings] :
+           validators.at(validator_name).prereq_with_forgive_warnings) {
+        if (names.count(prereq) == 0) {
+          return false;
         }
       }
-      validator_json["issues"] = issues_json;
+      return true;
+    };
+
+  // Main validation process
+  CompletionQueue completion_queue;
+  size_t running_validators = 0;
+  std::unordered_set<ValidatorName> started_validators;
+  std::list<size_t> speculative_runs;  // Speculative runs waiting for their prerequisites
+  std::exception_ptr first_exception = nullptr;
+
+  const auto submit_run = [&](ValidatorRun & run) {
+    started_validators.insert(run.validator_name);
+    running_validators++;
+    pool->submit([&run_validator, &completion_queue, &run]() {
+      try {
+        run_validator(run);
+      } catch (...) {
+        run.exception = std::current_exception();
+      }
+      completion_queue.push(run.index);
+    });
+  };
+
+  // Take the results of a validator that ran to the end
+  const auto complete_run = [&](ValidatorRun & run) {
+    if (run.exception) {
+      if (!first_exception) {
+        first_exception = run.exception;
+      }
+      return;
+    }
+    run.issues = std::move(run.validator_issues);
+
+    // A validator stopped by the error of another one has partial results, so it is cancelled
+    if (run.context->fail_fast && run.context->fail_fast->stopped_by_other_validator()) {
+      if (!failed_validator_name) {
+        for (const auto & other : runs) {
+          if (other.context && other.context->fail_fast && other.context->fail_fast->failed_run()) {
+            failed_validator_name = other.validator_name;
+            break;
+          }
+        }
+      }
+      run.issues.clear();
+      run.issue_cap = nullptr;
+      run.cancelled = true;
+      add_cancelled_issue(
+        run.issues, run.validator_name, failed_validator_name.value_or(run.validator_name), true);
+    }
+    finish_validator(run);
+  };
+
+  // Decide the speculative runs whose prerequisites have all finished. A run that would not have
+  // been started at this point is stopped, and its results are replaced by those of a validator
+  // that was not run, so that the results are the same as without speculation.
+  const auto confirm_speculative_runs = [&]() {
+    for (auto it = speculative_runs.begin(); it != speculative_runs.end() && !first_exception;) {
+      ValidatorRun & run = runs[*it];
+      if (!prerequisites_in(run.validator_name, finished_validators)) {
+        ++it;
+        continue;
+      }
+      speculative_runs.erase(it);
+      run.speculative = false;
+      check_prerequisites(run);
+      if (!run.started) {
+        run.stop_flag->store(true);
+        run.discarded = true;
+        run.issue_cap = nullptr;
+        finish_validator(run);
+      } else if (run.completed) {
+        complete_run(run);
+      }
+      // Validators depending on this one may be decided now
+      it = speculative_runs.begin();
+    }
+  };
+
+  while (!pending_validators.empty() || running_validators > 0 || !speculative_runs.empty()) {
+    confirm_speculative_runs();
+
+    // Start the ready validators in the order of the queue, i.e. the most expensive ones first
+    for (auto it = pending_validators.begin();
+         it != pending_validators.end() && running_validators < max_running_validators &&
+         !first_exception;) {
+      if (!prerequisites_in(*it, finished_validators)) {
+        ++it;
+        continue;
+      }
+      ValidatorRun & run = create_run(*it, false);
+      it = pending_validators.erase(it);
+      check_prerequisites(run);
+      if (run.started) {
+        configure_run(run);
+      }
+
+      if (run.started && max_running_validators > 1) {
+        submit_run(run);
+        continue;
+      }
+
+      started_validators.insert(run.validator_name);
+      if (run.started) {
+        run_validator(run);
+        run.completed = true;
+        complete_run(run);
+      } else {
+        finish_validator(run);
+      }
+      // Validators depending on this one may be ready now
+      it = pending_validators.begin();
+    }
+
+    // With --speculative, threads left idle start the validators whose prerequisites have all
+    // been started, as if the prerequisites will pass
+    const auto run_deadline = global_deadline(validator_config);
+    const bool speculate = validator_config.speculative && !first_exception &&
+                           !failed_validator_name &&
+                           !(run_deadline && std::chrono::steady_clock::now() >= *run_deadline);
+    for (auto it = pending_validators.begin(); speculate && it != pending_validators.end() &&
+                                               running_validators < max_running_validators;) {
+      if (!prerequisites_in(*it, started_validators)) {
+        ++it;
+        continue;
+      }
+      ValidatorRun & run = create_run(*it, true);
+      it = pending_validators.erase(it);
+      configure_run(run);
+      speculative_runs.push_back(run.index);
+      submit_run(run);
+    }
+
+    if (running_validators == 0) {
+      break;
+    }
+
+    // Wait for a running validator to finish. After an exception, the running validators are only
+    // waited for, since they refer to this stack frame.
+    ValidatorRun & run = runs[completion_queue.pop()];
+    running_validators--;
+    run.completed = true;
+    if (!first_exception && !run.discarded && !run.speculative) {
+      complete_run(run);
     }
-    appendIssues(total_issues, issues);
   }
 
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
   return total_issues;
 }
 
@@ -0,0 +1,78 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/validation_context.hpp"
+
+#include "lanelet2_map_validator/fail_fast.hpp"
+#include "lanelet2_map_validator/issue_cap.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+// The context installed on this thread by ValidationContext::Scope
+thread_local ValidationContextPtr scoped_context = nullptr;
+
+const ValidationContextPtr & empty_context()
+{
+  static const ValidationContextPtr empty = std::make_shared<const ValidationContext>();
+  return empty;
+}
+}  // namespace
+
+ValidationContext::Scope::Scope(ValidationContextPtr context)
+: previous_(std::move(scoped_context))
+{
+  scoped_context = std::move(context);
+}
+
+ValidationContext::Scope::~Scope()
+{
+  scoped_context = std::move(previous_);
+}
+
+const ValidationContextPtr & ValidationContext::current()
+{
+  return scoped_context ? scoped_context : empty_context();
+}
+
+bool validation_cancelled()
+{
+  const ValidationContext & context = *ValidationContext::current();
+  if (context.issue_cap && context.issue_cap->exhausted()) {
+    return true;
+  }
+  if (context.fail_fast && context.fail_fast->failed()) {
+    context.fail_fast->notify_cancelled();
+    return true;
+  }
+  if (context.stop_flag && context.stop_flag->load(std::memory_order_relaxed)) {
+    return true;
+  }
+  if (!context.deadline || std::chrono::steady_clock::now() < *context.deadline) {
+    return false;
+  }
+  if (context.deadline_hit) {
+    context.deadline_hit->store(true, std::memory_order_relaxed);
+  }
+  return true;
+}
+
+}  // namespace lanelet::autoware::validation
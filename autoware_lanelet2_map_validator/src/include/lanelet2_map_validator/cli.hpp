@@ -19,6 +19,7 @@
 
 #include <lanelet2_validation/Cli.h>
 
+#include <chrono>
 #include <iostream>
 #include <string>
 
@@ -30,9 +31,35 @@ struct MetaConfig
   std::string projector_type;
   std::string requirements_file;
   std::string output_file_path;
+  std::string output_format = "json";  //<! "json" or "ndjson"
   std::string exclusion_list;
   std::string parameters_file;
   std::string language;
+  size_t jobs = 0;             //<! 0 means the number of hardware threads
+  size_t validator_jobs = 1;   //<! Validators run at once, 1 runs them one after another
+  bool speculative = false;    //<! Start validators before their prerequisites pass
+  std::string timing_profile;  //<! Elapsed times of the validators of previous runs, or empty
+  std::string progress;        //<! "stdout", a file descriptor number, or empty to disable
+  std::string roi;             //<! "min_x,min_y,max_x,max_y", or empty to validate the whole map
+  std::string roi_ids;         //<! Comma separated primitive IDs, or empty
+  size_t shards = 1;           //<! Number of worker processes, 1 validates in this process
+  size_t shard_index = 0;      //<! Shard validated by this worker process of --shards
+  std::string shard_output;    //<! Results directory of this worker process, empty otherwise
+  bool streaming = false;      //<! Validate tile by tile without loading the whole map
+  double tile_size = 1000.0;   //<! Size of the tiles of --streaming in meters
+  size_t tile_cache_mb = 512;  //<! Memory for the element texts of the tiles of --streaming
+
+  double timeout_per_validator = 0.0;  //<! Seconds each validator may run, 0 for no limit
+  double global_deadline = 0.0;        //<! Seconds the validation may run, 0 for no limit
+  // Start of the run, from which global_deadline counts
+  std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+  size_t max_issues_per_code = 0;  //<! Issues kept per issue code of a validator, 0 for all
+  bool stop_at_issue_cap = false;  //<! Stop a failing validator once an issue code hits the cap
+  bool fail_fast = false;          //<! Stop the whole validation at the first error
+
+  bool issue_geometry = false;     //<! Add the positions of the issues and write the issue index
+  double issue_tile_size = 100.0;  //<! Size of the tiles of the issue index in meters
 };
 
 MetaConfig parseCommandLine(int argc, const char * argv[]);
@@ -0,0 +1,144 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__COMPRESSION_HPP_
+#define LANELET2_MAP_VALIDATOR__COMPRESSION_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+enum class Compression { NONE, GZIP, ZSTD };
+
+/**
+ * @brief Compression of a file given by its extension (".gz" or ".zst")
+ */
+Compression compression_of(const std::filesystem::path & file);
+
+/**
+ * @brief Stream buffer reading the decompressed contents of a file. The file is decompressed on a
+ * background thread a few chunks ahead of the reader, so that decompression overlaps with parsing.
+ */
+class DecompressingStreamBuffer : public std::streambuf
+{
+public:
+  DecompressingStreamBuffer(const std::filesystem::path & file, const Compression compression);
+  ~DecompressingStreamBuffer() override;
+
+  DecompressingStreamBuffer(const DecompressingStreamBuffer &) = delete;
+  DecompressingStreamBuffer & operator=(const DecompressingStreamBuffer &) = delete;
+
+  /**
+   * @brief Throw the error of the background thread (e.g. corrupted data), if any. A reader sees
+   * such an error only as the end of the stream.
+   */
+  void rethrow_error() const;
+
+protected:
+  int_type underflow() override;
+
+private:
+  void decompress_gzip();
+  void decompress_zstd();
+  void push_chunk(std::string chunk);
+
+  std::ifstream input_;
+  std::string current_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable changed_;
+  std::deque<std::string> chunks_;
+  bool finished_ = false;
+  bool stopped_ = false;
+  std::exception_ptr error_;
+  std::thread thread_;
+};
+
+/**
+ * @brief std::istream of the decompressed contents of a file compressed with gzip or zstd
+ */
+class DecompressingInputStream : public std::istream
+{
+public:
+  explicit DecompressingInputStream(const std::filesystem::path & file);
+
+  void rethrow_error() const { buffer_->rethrow_error(); }
+
+private:
+  std::unique_ptr<DecompressingStreamBuffer> buffer_;
+};
+
+/**
+ * @brief Stream buffer compressing everything written to it into a file
+ */
+class CompressingStreamBuffer : public std::streambuf
+{
+public:
+  CompressingStreamBuffer(const std::filesystem::path & file, const Compression compression);
+  ~CompressingStreamBuffer() override;
+
+  CompressingStreamBuffer(const CompressingStreamBuffer &) = delete;
+  CompressingStreamBuffer & operator=(const CompressingStreamBuffer &) = delete;
+
+  /**
+   * @brief Compress the rest of the data, end the compressed stream and close the file
+   * @throws std::runtime_error if compressing or writing fails
+   */
+  void finish();
+
+protected:
+  int_type overflow(int_type c) override;
+  int sync() override;
+
+private:
+  struct Context;
+
+  void compress(const char * data, const size_t size, const bool end);
+
+  std::ofstream output_;
+  Compression compression_;
+  std::vector<char> buffer_;
+  std::unique_ptr<Context> context_;
+  bool finished_ = false;
+};
+
+/**
+ * @brief std::ostream writing a file compressed with gzip or zstd. Call finish() to complete it.
+ */
+class CompressingOutputStream : public std::ostream
+{
+public:
+  CompressingOutputStream(const std::filesystem::path & file, const Compression compression);
+
+  void finish();
+
+private:
+  std::unique_ptr<CompressingStreamBuffer> buffer_;
+};
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__COMPRESSION_HPP_
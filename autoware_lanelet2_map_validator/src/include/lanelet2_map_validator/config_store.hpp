@@ -26,47 +26,110 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
 
 namespace lanelet::autoware::validation
 {
+/**
+ * @brief An immutable snapshot of the parameters, the issue definitions and the language used in
+ * a validation run. Snapshots are shared with std::shared_ptr and never modified after creation,
+ * so any number of threads and runs can read them without locks. The state of a run (e.g. its
+ * deadline) is kept apart in a ValidationContext.
+ */
+class ValidatorConfig
+{
+public:
+  /**
+   * @brief Load a snapshot from files. An empty path means the default file embedded at build
+   * time (config/params.yaml or config/issues_info.json).
+   */
+  static std::shared_ptr<const ValidatorConfig> load(
+    const std::string & params_yaml_file, const std::string & issues_info_json_file,
+    const std::string & language);
+
+  /**
+   * @brief Create a snapshot from already loaded contents
+   */
+  ValidatorConfig(
+    const YAML::Node & parameters, nlohmann::json issues_info, std::string language);
+
+  /**
+   * @brief An empty snapshot without any parameters and issue definitions
+   */
+  ValidatorConfig() = default;
 
+  /**
+   * @brief Returns a copy of all parameters.
+   * yaml-cpp nodes are not safe to share between threads, so the snapshot parses the parameters
+   * once and every caller gets its own deep copy of them.
+   */
+  YAML::Node parameters() const { return YAML::Clone(parameters_); }
+
+  const nlohmann::json & issues_info() const { return issues_info_; }
+  const std::string & language() const { return language_; }
+
+private:
+  YAML::Node parameters_;
+  nlohmann::json issues_info_;
+  std::string language_;
+};
+
+using ValidatorConfigPtr = std::shared_ptr<const ValidatorConfig>;
+
+/**
+ * @brief Access to the configuration snapshot of the current validation run.
+ *
+ * The snapshot is looked up in this order: the one installed on the calling thread by a Scope,
+ * then the process-wide default set by initialize(). Validation runs install their snapshot with
+ * a Scope, so validators constructed and executed in a run read that run's configuration even if
+ * other runs with different configurations are in progress in the same process.
+ */
 class ValidatorConfigStore
 {
 public:
-  static void initialize(
-    const std::string & params_yaml_file, const std::string & issues_info_json_file,
-    const std::string & language)
+  /**
+   * @brief Installs a snapshot on the calling thread while this object is alive
+   */
+  class Scope
   {
-    if (params_yaml_file.empty()) {
-      yaml_ = YAML::Load(default_yaml_str_);
-    } else {
-      yaml_ = YAML::LoadFile(params_yaml_file);
-    }
-
-    if (issues_info_json_file.empty()) {
-      json_ = nlohmann::json::parse(default_json_str_);
-    } else {
-      std::ifstream json_ifs(issues_info_json_file);
-      if (!json_ifs.is_open()) {
-        throw std::runtime_error("Failed to open JSON file: " + issues_info_json_file);
-      }
-      json_ifs >> json_;
-    }
+  public:
+    explicit Scope(ValidatorConfigPtr config);
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope & operator=(const Scope &) = delete;
+
+  private:
+    ValidatorConfigPtr previous_;
+  };
+
+  /**
+   * @brief Load a snapshot and set it as the process-wide default
+   * @return ValidatorConfigPtr (The loaded snapshot)
+   */
+  static ValidatorConfigPtr initialize(
+    const std::string & params_yaml_file, const std::string & issues_info_json_file,
+    const std::string & language);
 
-    language_ = language;
-  }
+  /**
+   * @brief The snapshot of the calling thread (see the class description)
+   */
+  static ValidatorConfigPtr current();
 
-  static const YAML::Node & parameters() { return yaml_; }
-  static const nlohmann::json & issues_info() { return json_; }
-  static const std::string & language() { return language_; }
+  static YAML::Node parameters() { return current_ref().parameters(); }
+  static const nlohmann::json & issues_info() { return current_ref().issues_info(); }
+  static const std::string & language() { return current_ref().language(); }
 
 private:
-  static inline YAML::Node yaml_;
-  static inline nlohmann::json json_;
-  static inline std::string language_;
+  /**
+   * @brief Same as current() but without copying the shared pointer, for the frequent calls made
+   * while issues are constructed. The reference stays valid while the snapshot is installed, or
+   * until initialize() replaces the process-wide default.
+   */
+  static const ValidatorConfig & current_ref();
 };
 
 template <typename T>
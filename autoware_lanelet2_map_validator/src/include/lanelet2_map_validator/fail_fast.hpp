@@ -0,0 +1,107 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef LANELET2_MAP_VALIDATOR__FAIL_FAST_HPP_
+#define LANELET2_MAP_VALIDATOR__FAIL_FAST_HPP_
+
+#include <lanelet2_validation/Validation.h>
+
+#include <atomic>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief The exit code of the validator when --fail_fast found an error
+ */
+constexpr int fail_fast_exit_code = 2;
+
+/**
+ * @brief Watches the issues of a validator run for --fail_fast.
+ *
+ * Installed in the validation context of the run (see ValidationContext::fail_fast), it is told
+ * every issue added with add_issue_from_code() and fails at the first error of a primitive not in
+ * the exclusion list, after which validation_cancelled() returns true so that the validator stops
+ * checking further primitives. Shared by all threads of the validator.
+ *
+ * The validators running at the same time have a FailFast each for their own exclusion lists,
+ * which share the failure of the run so that the first error stops all of them.
+ */
+class FailFast
+{
+public:
+  /**
+   * @param excluded_primitives (Pairs of the primitive type and ID, as in the exclusion list)
+   * @param run_failure (The failure of the run shared with the other validators, or nullptr for a
+   * failure of this validator only)
+   * @param fails_run (Whether an error of this validator sets run_failure. A validator whose
+   * results may still be discarded only stops itself.)
+   */
+  explicit FailFast(
+    const std::vector<std::pair<std::string, lanelet::Id>> & excluded_primitives,
+    std::shared_ptr<std::atomic<bool>> run_failure = nullptr, const bool fails_run = true);
+
+  /**
+   * @brief Fail if the issue is an error of a primitive that is not excluded
+   */
+  void report(const lanelet::validation::Issue & issue);
+
+  /**
+   * @brief Whether this validator or another one of the run found an error
+   */
+  bool failed() const
+  {
+    return found_error_.load(std::memory_order_relaxed) ||
+           run_failure_->load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Whether this validator found an error that failed the run
+   */
+  bool failed_run() const { return fails_run_ && found_error_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Whether validation_cancelled() stopped this validator for an error of another one
+   */
+  bool stopped_by_other_validator() const
+  {
+    return stopped_by_other_validator_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Called by validation_cancelled() when it returns true since failed() is true
+   */
+  void notify_cancelled();
+
+private:
+  const std::set<std::pair<std::string, lanelet::Id>> excluded_primitives_;
+  const std::shared_ptr<std::atomic<bool>> run_failure_;
+  const bool fails_run_;
+  std::atomic<bool> found_error_{false};
+  std::atomic<bool> stopped_by_other_validator_{false};
+};
+
+/**
+ * @brief Whether the issues contain an error, i.e. whether --fail_fast stops the validation
+ */
+bool has_error(const std::vector<lanelet::validation::DetectedIssues> & issues);
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__FAIL_FAST_HPP_
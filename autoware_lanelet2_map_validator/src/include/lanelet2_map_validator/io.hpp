@@ -26,6 +26,14 @@ namespace lanelet::autoware::validation
 std::string get_validator_version();
 void insert_validator_info_to_map(
   std::string osm_file, std::string requirements, std::string requirements_version);
+
+/**
+ * @brief Same as insert_validator_info_to_map(), but rewrites the osm file as a stream instead of
+ * loading it as a DOM. Everything other than the <validation> element is kept byte for byte.
+ */
+void stream_validator_info_to_map(
+  const std::string & osm_file, const std::string & requirements,
+  const std::string & requirements_version);
 void insert_validation_info_to_json(nlohmann::json & json_data, MetaConfig config);
 }  // namespace lanelet::autoware::validation
 
@@ -0,0 +1,144 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__ISSUE_CAP_HPP_
+#define LANELET2_MAP_VALIDATOR__ISSUE_CAP_HPP_
+
+#include "lanelet2_map_validator/config_store.hpp"
+
+#include <lanelet2_validation/Validation.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief The issue code of the summary issues made by IssueCap::summary_issues()
+ */
+constexpr const char * suppressed_issues_code = "General.IssuesSuppressed-001";
+
+/**
+ * @brief Keeps at most max_issues_per_code issues of each issue code in a validator run.
+ *
+ * Issues added with add_issue_from_code() are counted here while the cap is installed in the
+ * validation context (see ValidationContext::issue_cap). The issues past the cap are not
+ * constructed at all, and summary_issues() reports their number and a sample of their primitive
+ * IDs instead. One object is shared by all threads of a validator, so every member is thread-safe.
+ *
+ * Issues found in parallel are admitted by a cap of their own chunk (see chunk_cap()) and merged
+ * with merge_chunk() in the order of the chunks, so that the same issues are admitted as in a
+ * serial run regardless of which thread reaches the cap first.
+ */
+class IssueCap
+{
+public:
+  /**
+   * @brief Number of primitive IDs kept per issue code for the summary issues
+   */
+  static constexpr size_t sample_size = 10;
+
+  /**
+   * @param max_issues_per_code (Must be positive)
+   * @param stop_at_cap (Make exhausted() true once an error or a warning passes the cap)
+   * @throws std::invalid_argument if max_issues_per_code is zero
+   */
+  explicit IssueCap(const size_t max_issues_per_code, const bool stop_at_cap = false);
+
+  /**
+   * @brief Count an issue of the code found for the primitive
+   * @return true if the issue is to be added, false if it passed the cap and is only counted
+   */
+  bool admit(const std::string & issue_code, const lanelet::Id primitive_id);
+
+  /**
+   * @brief Whether the validator has already failed so its remaining primitives need not be
+   * checked, i.e. stop_at_cap is set and an issue code with the severity Error or Warning passed
+   * the cap. validation_cancelled() returns true in that case.
+   */
+  bool exhausted() const
+  {
+    return exhausted_.load(std::memory_order_relaxed) || (parent_ && parent_->exhausted());
+  }
+
+  /**
+   * @brief A new cap with the same limits for the issues of a chunk of a parallel loop, which
+   * admits the first issues of each code within the chunk. Its exhaustion also exhausts this cap.
+   */
+  std::shared_ptr<IssueCap> chunk_cap();
+
+  /**
+   * @brief Count the issues of a chunk as if they were added to this cap one by one.
+   *
+   * The issues admitted by the chunk cap past the cap of this object are removed from issues and
+   * suppressed here, followed by the issues the chunk cap suppressed itself.
+   *
+   * @param chunk (The chunk_cap() of the chunk)
+   * @param issues (Ends with the issues of the chunk, from index begin)
+   * @param begin
+   */
+  void merge_chunk(
+    const IssueCap & chunk, lanelet::validation::Issues & issues, const size_t begin);
+
+  /**
+   * @brief The number of issues that were only counted
+   */
+  size_t suppressed_count() const;
+
+  /**
+   * @brief One issue per issue code that passed the cap, with the severity of that code, telling
+   * how many of its issues were suppressed and some of their primitive IDs
+   */
+  lanelet::validation::Issues summary_issues() const;
+
+  size_t max_issues_per_code() const { return max_issues_per_code_; }
+
+private:
+  struct CodeCount
+  {
+    size_t admitted = 0;
+    size_t suppressed = 0;
+    lanelet::validation::Severity severity = lanelet::validation::Severity::Error;
+    std::vector<lanelet::Id> sample_ids;
+  };
+
+  IssueCap(const size_t max_issues_per_code, const bool stop_at_cap, IssueCap * parent);
+
+  // Count an issue of the code past the cap (mutex_ must be locked)
+  void suppress(CodeCount & count, const std::string & issue_code, const lanelet::Id primitive_id);
+  void exhaust();
+
+  const size_t max_issues_per_code_;
+  const bool stop_at_cap_;
+  IssueCap * const parent_;  //<! The cap that made this one by chunk_cap()
+  mutable std::mutex mutex_;
+  std::map<std::string, CodeCount> counts_;
+  std::atomic<bool> exhausted_{false};
+};
+
+/**
+ * @brief The cap of issues per issue code of the validator, which is its "max_issues_per_code"
+ * parameter or default_max_issues_per_code (0 for unlimited)
+ */
+size_t max_issues_per_code(
+  const ValidatorConfig & config, const std::string & validator_name,
+  const size_t default_max_issues_per_code);
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__ISSUE_CAP_HPP_
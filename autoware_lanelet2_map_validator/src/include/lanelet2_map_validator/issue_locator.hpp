@@ -0,0 +1,99 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef LANELET2_MAP_VALIDATOR__ISSUE_LOCATOR_HPP_
+#define LANELET2_MAP_VALIDATOR__ISSUE_LOCATOR_HPP_
+
+#include <nlohmann/json.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_validation/Validation.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief The file name of the issue index written next to the validation results
+ */
+constexpr const char * issue_index_file_name = "lanelet2_validation_issue_index.json";
+
+/**
+ * @brief Locates the issues of a validation run in the map for --issue_geometry.
+ *
+ * Installed in the validation context of the run (see ValidationContext::issue_locator), it adds
+ * the position and the bounding box of the primitive of each issue to the issue JSON made by
+ * issue_to_json(), and collects the issues into a spatial index of square tiles, so that a viewer
+ * loads only the issues in its viewport instead of looking up every primitive of the map.
+ * The map must outlive the locator.
+ */
+class IssueLocator
+{
+public:
+  /**
+   * @param map
+   * @param tile_size (The side of the tiles of the index in meters)
+   * @throws std::invalid_argument if tile_size is not positive
+   */
+  IssueLocator(const lanelet::LaneletMap & map, const double tile_size);
+
+  /**
+   * @brief Add "position" ([x, y], the center of the bounding box) and "bounding_box" ([min_x,
+   * min_y, max_x, max_y]) of the primitive of the issue to issue_json, in the projected map
+   * coordinates. Issues not bound to a primitive of the map are left as they are.
+   */
+  void annotate(const lanelet::validation::Issue & issue, nlohmann::json & issue_json) const;
+
+  /**
+   * @brief Add an issue JSON annotated by annotate() to the tile of its position. Thread-safe.
+   */
+  void add_to_index(const std::string & validator_name, const nlohmann::json & issue_json);
+
+  /**
+   * @brief The index as {"tile_size": <size>, "tiles": [{"tile": [i, j], "bounds": [min_x, min_y,
+   * max_x, max_y], "issues": [...]}, ...], "unlocated_issues": [...]}.
+   *
+   * The tile [i, j] covers [i * tile_size, (i + 1) * tile_size) x [j * tile_size, (j + 1) *
+   * tile_size) and lists the issues positioned in it. Each issue is the issue JSON with its
+   * "validator", like the issue records of the NDJSON results. The issues of a tile are ordered by
+   * validator name, in the order of the results for each validator.
+   */
+  nlohmann::json index_json() const;
+
+  /**
+   * @brief Write index_json() to the file
+   * @throws std::runtime_error if the file cannot be written
+   */
+  void write_index(const std::filesystem::path & file) const;
+
+  double tile_size() const { return tile_size_; }
+
+private:
+  const lanelet::LaneletMap & map_;
+  const double tile_size_;
+  mutable std::mutex mutex_;
+  std::map<std::pair<int64_t, int64_t>, std::vector<nlohmann::json>> tiles_;
+  std::vector<nlohmann::json> unlocated_issues_;
+};
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__ISSUE_LOCATOR_HPP_
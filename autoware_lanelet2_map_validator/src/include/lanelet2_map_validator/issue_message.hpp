@@ -0,0 +1,61 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__ISSUE_MESSAGE_HPP_
+#define LANELET2_MAP_VALIDATOR__ISSUE_MESSAGE_HPP_
+
+#include "lanelet2_map_validator/config_store.hpp"
+
+#include <map>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief The issue code and the text of lanelet::validation::Issue::message.
+ *
+ * Issue messages are rendered when the issue is constructed and kept readable as
+ * "[<issue_code>] <text>" so that every user of the issues (e.g.
+ * lanelet::validation::printAllIssues()) sees the same message. Rendering is not deferred to the
+ * output; the issue cap keeps issues past the cap from being constructed at all. The code is split
+ * off by its position, which is cheap enough for every issue exported by the validation.
+ */
+struct IssueMessage
+{
+  std::string issue_code;  //<! Empty if the message has no issue code
+  std::string text;        //<! The message without the issue code
+};
+
+/**
+ * @brief Split Issue::message into its issue code and text.
+ *
+ * Messages written as "[<issue_code>] <text>" are split into the code and the text, and other
+ * messages are kept as the text.
+ */
+IssueMessage split_issue_message(const std::string & message);
+
+/**
+ * @brief Render the message of the issue code without the issue code prefix, using the issue
+ * definitions and the language of config. Messages not translated to the language are rendered in
+ * English.
+ *
+ * @throws std::invalid_argument if the issue code is not defined in the issue definitions
+ */
+std::string render_issue_text(
+  const std::string & issue_code, const std::map<std::string, std::string> & substitutions,
+  const ValidatorConfig & config);
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__ISSUE_MESSAGE_HPP_
@@ -0,0 +1,140 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__LANE_TOPOLOGY_HPP_
+#define LANELET2_MAP_VALIDATOR__LANE_TOPOLOGY_HPP_
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/Types.h>
+#include <lanelet2_traffic_rules/TrafficRules.h>
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief A compact and read-only lane topology that only holds the following, previous, sideways
+ * and conflicting relations of a lanelet2 routing graph.
+ *
+ * The relations are derived from shared bounds and shared end points (point IDs) of passable
+ * lanelets, and follow the same rules as lanelet::routing::RoutingGraph does for them.
+ * Conflicting relations are detected between overlapping lanelets only (areas are not included)
+ * and routing costs are not computed. Lanelets are stored with dense indices, and the
+ * following/previous/conflicting relations are stored in CSR (compressed sparse row) layout.
+ */
+class LaneTopology
+{
+public:
+  using Index = uint32_t;
+  static constexpr Index invalid_index = static_cast<Index>(-1);
+
+  /**
+   * @brief Build the lane topology of the map. The relation detection is done in parallel on
+   * the shared thread pool (see parallel_jobs()). Conflicting lanelets are searched within
+   * spatial tiles of the map, and the result does not depend on the number of threads.
+   *
+   * @param map
+   * @param traffic_rules (Used to determine passable lanelets, one-way lanelets and lane changes)
+   * @param participant_height (Optional. If given, lanelets only conflict if they overlap in 3D
+   * within this height (in meters), like the participant_height configuration of
+   * lanelet::routing::RoutingGraph. Otherwise they conflict if they overlap in 2D.)
+   * @return LaneTopology
+   */
+  static LaneTopology build(
+    const lanelet::LaneletMap & map, const lanelet::traffic_rules::TrafficRules & traffic_rules,
+    const std::optional<double> & participant_height = std::nullopt);
+
+  /**
+   * @brief Equivalent to lanelet::routing::RoutingGraph::following(lanelet, false)
+   */
+  lanelet::ConstLanelets following(const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * @brief Equivalent to lanelet::routing::RoutingGraph::previous(lanelet, false)
+   */
+  lanelet::ConstLanelets previous(const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * @brief Equivalent to lanelet::routing::RoutingGraph::left(lanelet)
+   */
+  lanelet::Optional<lanelet::ConstLanelet> left(const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * @brief Equivalent to lanelet::routing::RoutingGraph::right(lanelet)
+   */
+  lanelet::Optional<lanelet::ConstLanelet> right(const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * @brief Equivalent to lanelet::routing::RoutingGraph::adjacentLeft(lanelet)
+   */
+  lanelet::Optional<lanelet::ConstLanelet> adjacentLeft(
+    const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * @brief Equivalent to lanelet::routing::RoutingGraph::adjacentRight(lanelet)
+   */
+  lanelet::Optional<lanelet::ConstLanelet> adjacentRight(
+    const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * @brief Equivalent to lanelet::routing::RoutingGraph::conflicting(lanelet) without areas
+   */
+  lanelet::ConstLanelets conflicting(const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * @brief Equivalent to lanelet::routing::RoutingGraph::routingRelation(from, to,
+   * include_conflicting)
+   */
+  lanelet::Optional<lanelet::routing::RelationType> routingRelation(
+    const lanelet::ConstLanelet & from, const lanelet::ConstLanelet & to,
+    const bool include_conflicting = false) const;
+
+  /**
+   * @brief Number of (directed) lanelets in the topology.
+   * Lanelets that are not one-way are stored in both directions.
+   */
+  size_t size() const { return lanelets_.size(); }
+
+private:
+  Index index_of(const lanelet::ConstLanelet & lanelet) const;
+  lanelet::ConstLanelets lanelets_in_row(
+    const std::vector<Index> & offsets, const std::vector<Index> & indices, const Index row) const;
+  lanelet::Optional<lanelet::ConstLanelet> sideways_lanelet(
+    const std::vector<Index> & sideways, const lanelet::ConstLanelet & lanelet) const;
+
+  std::vector<lanelet::ConstLanelet> lanelets_;  //<! dense index -> lanelet
+  std::unordered_map<lanelet::Id, Index> forward_index_;
+  std::unordered_map<lanelet::Id, Index> inverted_index_;
+
+  // CSR layout: successors of lanelet i are following_indices_[following_offsets_[i]] to
+  // following_indices_[following_offsets_[i + 1] - 1]
+  std::vector<Index> following_offsets_;
+  std::vector<Index> following_indices_;
+  std::vector<Index> previous_offsets_;
+  std::vector<Index> previous_indices_;
+  std::vector<Index> conflicting_offsets_;
+  std::vector<Index> conflicting_indices_;
+
+  // At most one sideways lanelet per side. invalid_index means there is none.
+  std::vector<Index> left_;
+  std::vector<Index> right_;
+  std::vector<Index> adjacent_left_;
+  std::vector<Index> adjacent_right_;
+};
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__LANE_TOPOLOGY_HPP_
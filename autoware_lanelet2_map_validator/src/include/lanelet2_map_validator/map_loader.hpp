@@ -15,22 +15,85 @@
 #ifndef LANELET2_MAP_VALIDATOR__MAP_LOADER_HPP_  // NOLINT
 #define LANELET2_MAP_VALIDATOR__MAP_LOADER_HPP_  // NOLINT
 
+#include "lanelet2_map_validator/config_store.hpp"
+
 #include <lanelet2_io/Io.h>
 #include <lanelet2_projection/UTM.h>
 #include <lanelet2_validation/Validation.h>
+#include <pugixml.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace lanelet::autoware::validation
 {
+/**
+ * @brief The layers of a lanelet::LaneletMap that validators need
+ */
+struct MapLayers
+{
+  bool points = false;
+  bool linestrings = false;
+  bool polygons = false;
+  bool lanelets = false;
+  bool areas = false;
+  bool regulatory_elements = false;
+
+  static MapLayers all();
+
+  /**
+   * @brief Layers given by their names ("points", "linestrings", "polygons", "lanelets", "areas"
+   * and "regulatory_elements")
+   * @throws std::invalid_argument if a name is unknown
+   */
+  static MapLayers from_names(const std::vector<std::string> & names);
+
+  std::vector<std::string> names() const;
+  bool is_all() const;
+
+  MapLayers & operator|=(const MapLayers & other);
+};
+
+/**
+ * @brief The layers needed by the validators, declared by their "layers" parameter.
+ *
+ * A layer not declared by any validator may still be partially loaded, since the primitives of
+ * the declared layers are loaded with everything they refer to (e.g. the points of a linestring).
+ *
+ * @param config
+ * @param validator_names
+ * @return std::optional<MapLayers> (std::nullopt if every layer is needed, including the case that
+ * a validator does not declare its layers)
+ */
+std::optional<MapLayers> required_map_layers(
+  const ValidatorConfig & config, const std::vector<std::string> & validator_names);
+
+/**
+ * @brief Remove the elements of an OSM document that do not belong to the layers and are not
+ * referred to by an element that does, so that lanelet2 does not build and project them.
+ *
+ * @param osm_node (The <osm> node of the document)
+ * @param layers
+ * @return size_t (The number of removed elements)
+ */
+size_t remove_unneeded_osm_elements(pugi::xml_node osm_node, const MapLayers & layers);
 
+/**
+ * @brief Load the map and report the issues found while loading it.
+ *
+ * @param projector_type
+ * @param map_file (.osm, .osm.gz or .osm.zst)
+ * @param val_config
+ * @param layers (Load only these layers and what they refer to, or the whole map if std::nullopt)
+ */
 std::pair<lanelet::LaneletMapPtr, std::vector<lanelet::validation::DetectedIssues>>
 loadAndValidateMap(
   const std::string & projector_type, const std::string & map_file,
-  const lanelet::validation::ValidationConfig & val_config);
+  const lanelet::validation::ValidationConfig & val_config,
+  const std::optional<MapLayers> & layers = std::nullopt);
 
 }  // namespace lanelet::autoware::validation
 
@@ -0,0 +1,81 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__PROGRESS_HPP_
+#define LANELET2_MAP_VALIDATOR__PROGRESS_HPP_
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief Start writing progress events as newline-delimited JSON.
+ *
+ * Each event is a single line {"event": <name>, "time_ms": <milliseconds since this call>, ...}.
+ * Events are flushed immediately so that other processes (e.g. the GUI) can follow the run.
+ *
+ * With "stdout", the events are the only output to the standard output, and the other output of
+ * the process is redirected to the standard error.
+ *
+ * @param target ("stdout" or the number of an open file descriptor)
+ */
+void open_progress_stream(const std::string & target);
+
+/**
+ * @brief Stop writing progress events. File descriptors given to open_progress_stream() are
+ * closed.
+ */
+void close_progress_stream();
+
+/**
+ * @brief Whether a progress stream is open. Use this to skip preparing the fields of events that
+ * nobody reads.
+ */
+bool progress_enabled();
+
+/**
+ * @brief Write a progress event with additional fields if a progress stream is open. Thread safe,
+ * and never throws.
+ */
+void report_progress(
+  const std::string & event, const nlohmann::json & fields = nlohmann::json::object());
+
+/**
+ * @brief Reports "phase_started" when constructed and "phase_finished" with the elapsed time when
+ * finish() is called. If the phase is left without finish() (e.g. by an exception),
+ * "phase_finished" is reported with "aborted": true.
+ */
+class ProgressPhase
+{
+public:
+  explicit ProgressPhase(std::string phase);
+  ~ProgressPhase();
+
+  ProgressPhase(const ProgressPhase &) = delete;
+  ProgressPhase & operator=(const ProgressPhase &) = delete;
+
+  void finish(const nlohmann::json & fields = nlohmann::json::object());
+
+private:
+  std::string phase_;
+  std::chrono::steady_clock::time_point start_;
+  bool finished_ = false;
+};
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__PROGRESS_HPP_
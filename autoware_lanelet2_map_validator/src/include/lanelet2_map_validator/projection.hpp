@@ -0,0 +1,86 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__PROJECTION_HPP_
+#define LANELET2_MAP_VALIDATOR__PROJECTION_HPP_
+
+#include <lanelet2_core/primitives/GPSPoint.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief Projects arrays of points to the same coordinates as the projector of the same type
+ * ("mgrs", "utm" or "transverse_mercator") used to load maps.
+ *
+ * The transverse Mercator projection underlying all three projectors is evaluated with the
+ * 6th-order Krüger series (as GeographicLib::TransverseMercator does, accurate to 5 nm within
+ * 3900 km of the central meridian) in plain loops over the arrays, without a virtual call or an
+ * exception handler per point.
+ *
+ * Points outside the range handled here (more than 3.5 degrees of longitude away from the central
+ * meridian, outside the UTM latitudes, near the 100 km lines of the MGRS grid or not finite) get
+ * NaN coordinates and have to be projected by the scalar projector.
+ */
+class BatchProjector
+{
+public:
+  /**
+   * @brief Create the batch projector equivalent to the projector of the type and origin
+   * @return std::unique_ptr<BatchProjector> (nullptr if the type is unknown or the origin cannot
+   * be projected in a UTM zone)
+   */
+  static std::unique_ptr<BatchProjector> create(
+    const std::string & projector_type, const lanelet::GPSPoint & origin);
+
+  /**
+   * @brief Project count points given as arrays of latitudes, longitudes and elevations
+   *
+   * @param count
+   * @param lat
+   * @param lon
+   * @param ele
+   * @param x (NaN for the points to project with the scalar projector)
+   * @param y
+   * @param z
+   * @return size_t (the number of points projected)
+   */
+  size_t forward(
+    const size_t count, const double * lat, const double * lon, const double * ele, double * x,
+    double * y, double * z) const;
+
+private:
+  enum class Mode { MGRS, UTM, TRANSVERSE_MERCATOR };
+
+  BatchProjector(const Mode mode, const double central_meridian);
+
+  Mode mode_;
+  double central_meridian_;
+  double x_offset_ = 0.0;
+  double y_offset_ = 0.0;
+};
+
+/**
+ * @brief The UTM zone of the point following GeographicLib::UTMUPS::StandardZone(), including the
+ * exceptions of Norway and Svalbard
+ * @return int (1 to 60, or 0 outside the UTM latitudes)
+ */
+int utm_standard_zone(const double lat, const double lon);
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__PROJECTION_HPP_
@@ -0,0 +1,155 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__RESULTS_WRITER_HPP_
+#define LANELET2_MAP_VALIDATOR__RESULTS_WRITER_HPP_
+
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <lanelet2_validation/Validation.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief Format of the validation results file
+ */
+enum class ResultsFormat {
+  JSON,   //<! lanelet2_validation_results.json, the requirements JSON with results added
+  NDJSON  //<! lanelet2_validation_results.ndjson, one JSON record per line
+};
+
+/**
+ * @brief Number of issues by severity
+ */
+struct IssueCounts
+{
+  uint64_t warnings = 0;
+  uint64_t errors = 0;
+
+  IssueCounts & operator+=(const IssueCounts & other)
+  {
+    warnings += other.warnings;
+    errors += other.errors;
+    return *this;
+  }
+};
+
+/**
+ * @brief Parse "json" or "ndjson" (throws std::invalid_argument otherwise)
+ */
+ResultsFormat parse_results_format(const std::string & format);
+
+/**
+ * @brief Convert an issue to the JSON object written in the validation results, locating it with
+ * the issue locator of context (if it has one). In the shard workers of --shards, the position of
+ * the primitive in its layer is added as layer_position_key for merge_shard_results().
+ */
+nlohmann::json issue_to_json(
+  const lanelet::validation::Issue & issue,
+  const ValidationContext & context = *ValidationContext::current());
+
+/**
+ * @brief Write the JSON value in the same format as `std::setw(4) << value`.
+ */
+void write_pretty_json(std::ostream & os, const nlohmann::json & value, const size_t indent = 0);
+
+/**
+ * @brief Writes validation results without holding all issues in memory.
+ *
+ * Issues of each validator are handed to add_validator_issues() as soon as the validator
+ * finishes, and are converted to JSON one at a time. Only their numbers are kept (see
+ * issue_counts()).
+ *
+ * The results are written to a temporary file next to the output, which finish() renames to the
+ * output file. The results file of a previous run is kept until then.
+ *
+ * - JSON: the issues are serialized to a temporary spool file next to the output, and finish()
+ *   writes the requirements JSON with the issues spliced into their validator blocks. The output
+ *   is identical to writing the whole JSON object with `std::setw(4)`.
+ * - NDJSON: records are appended to the output file as the validators finish. Each issue is a
+ *   line {"type": "issue", "validator": <name>, <fields of the issue>}, followed by
+ *   {"type": "validator", <validator block without issues>} when the validator finishes.
+ *   finish() appends {"type": "requirement", "id": <id>, "passed": <bool>} for each requirement
+ *   and {"type": "validation_info", <validation_info block>} at the end.
+ */
+class ResultsWriter
+{
+public:
+  ResultsWriter(const std::filesystem::path & output_directory, const ResultsFormat format);
+  ~ResultsWriter();
+
+  ResultsWriter(const ResultsWriter &) = delete;
+  ResultsWriter & operator=(const ResultsWriter &) = delete;
+
+  /**
+   * @brief Write the issues of a validator that just finished
+   *
+   * @param validator_json (The validator block, its "issues" field is ignored)
+   * @param issues
+   */
+  void add_validator_issues(
+    const nlohmann::json & validator_json, const lanelet::validation::Issues & issues);
+
+  /**
+   * @brief Complete the output file
+   *
+   * @param json_data (Requirements JSON with results. Validator blocks whose issues were passed to
+   * add_validator_issues() must not have the "issues" field.)
+   */
+  void finish(const nlohmann::json & json_data);
+
+  const std::filesystem::path & output_file() const { return output_file_; }
+
+  /**
+   * @brief Number of the issues passed to add_validator_issues() so far
+   */
+  const IssueCounts & issue_counts() const { return issue_counts_; }
+
+private:
+  struct SpoolRange
+  {
+    std::streampos begin;
+    size_t count;
+  };
+
+  void write_pretty_results(const nlohmann::json & json_data);
+  void write_ndjson_summary(const nlohmann::json & json_data);
+  void write_spooled_issues(const SpoolRange & range, const size_t indent);
+
+  ResultsFormat format_;
+  std::filesystem::path output_file_;
+  std::filesystem::path temporary_file_;  //<! Renamed to output_file_ by finish()
+  std::ofstream output_;
+  std::filesystem::path spool_file_;
+  std::fstream spool_;
+  std::unordered_map<std::string, SpoolRange> spooled_validators_;
+  std::unordered_set<std::string> emitted_validators_;  //<! Validators already written to NDJSON
+  IssueCounts issue_counts_;
+};
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__RESULTS_WRITER_HPP_
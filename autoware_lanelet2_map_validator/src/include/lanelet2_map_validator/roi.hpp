@@ -0,0 +1,257 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__ROI_HPP_
+#define LANELET2_MAP_VALIDATOR__ROI_HPP_
+
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_validation/Validation.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief The halo (in meters) used for validators without the "roi_halo" parameter
+ */
+constexpr double default_roi_halo = 10.0;
+
+/**
+ * @brief The part of the map to validate, given by a bounding box and/or the bounding boxes of
+ * some primitives (in the projected map coordinates).
+ *
+ * Validators only check the primitives found by primitives_in_roi(), i.e. the primitives
+ * intersecting the region expanded by a halo of the validator's reach, while the whole map stays
+ * available for looking up neighbors. Issues are reported only for primitives intersecting the
+ * region itself (see contains()).
+ */
+class RegionOfInterest
+{
+public:
+  /**
+   * @brief Create a region from a bounding box and the bounding boxes of primitives of the map
+   *
+   * @param map
+   * @param bounding_box (Optional)
+   * @param ids (IDs of points, linestrings, polygons, lanelets, areas or regulatory elements)
+   * @throws std::invalid_argument if both are empty or an ID is not found in the map
+   */
+  static std::shared_ptr<const RegionOfInterest> create(
+    const lanelet::LaneletMap & map, const std::optional<lanelet::BoundingBox2d> & bounding_box,
+    const std::vector<lanelet::Id> & ids);
+
+  /**
+   * @brief Create the region of a shard of --shards.
+   *
+   * The map is cut into shard_count strips across its longer side with the same number of points
+   * each. Every primitive is owned by the strip containing the center of its bounding box, and the
+   * region contains only the primitives it owns. search() returns the primitives in the order of
+   * the layer as without a region, and layer_position() tells the position of the primitive of an
+   * issue in its layer, so that the issues of the shards can be merged in the order of validating
+   * the whole map.
+   *
+   * @param map
+   * @param shard_index
+   * @param shard_count
+   * @throws std::invalid_argument if shard_index is not less than shard_count
+   */
+  static std::shared_ptr<const RegionOfInterest> create_shard(
+    const lanelet::LaneletMap & map, const size_t shard_index, const size_t shard_count);
+
+  /**
+   * @brief Create the region of the primitives owned by a tile of the streaming validation, made
+   * of the bounding box of the owned primitives found in the map.
+   *
+   * OSM nodes, ways and relations have IDs of their own, so the owned IDs are given by element
+   * type. Nodes become points, ways line strings or polygons, and relations lanelets, areas or
+   * regulatory elements.
+   *
+   * @param map (The map of the tile and its surroundings)
+   * @param owned_node_ids
+   * @param owned_way_ids
+   * @param owned_relation_ids
+   */
+  static std::shared_ptr<const RegionOfInterest> create_owned(
+    const lanelet::LaneletMap & map, const std::unordered_set<lanelet::Id> & owned_node_ids,
+    const std::unordered_set<lanelet::Id> & owned_way_ids,
+    const std::unordered_set<lanelet::Id> & owned_relation_ids);
+
+  const std::vector<lanelet::BoundingBox2d> & boxes() const { return boxes_; }
+
+  /**
+   * @brief Whether the primitive of the issue intersects the region (or is owned by the shard or
+   * the tile for create_shard() and create_owned()). Issues not bound to a specific primitive
+   * (lanelet::InvalId or Primitive::Primitive) are always contained.
+   */
+  bool contains(const lanelet::validation::Issue & issue) const;
+
+  /**
+   * @brief Position of the primitive of the issue in its layer of the map for the regions of
+   * create_shard(), or nullopt for other regions and for issues not bound to a primitive
+   */
+  std::optional<size_t> layer_position(const lanelet::validation::Issue & issue) const;
+
+  /**
+   * @brief The primitives of the layer intersecting the region expanded by halo, sorted by ID (in
+   * the order of the layer for create_shard()). The layer is searched with its R-tree, so the cost
+   * is proportional to the size of the region.
+   */
+  template <typename Layer>
+  std::vector<typename Layer::ConstPrimitiveT> search(const Layer & layer, const double halo) const
+  {
+    using Primitive = typename Layer::ConstPrimitiveT;
+    std::vector<Primitive> primitives;
+    std::unordered_set<lanelet::Id> found_ids;
+    for (const auto & box : boxes_) {
+      for (const auto & primitive : layer.search(expand(box, halo))) {
+        if (found_ids.insert(primitive_id(primitive)).second) {
+          primitives.push_back(primitive);
+        }
+      }
+    }
+    const auto positions = layer_positions_.find(primitive_type<Primitive>());
+    if (positions != layer_positions_.end()) {
+      const auto & position = positions->second;
+      std::sort(primitives.begin(), primitives.end(), [&position](const auto & a, const auto & b) {
+        return position.at(primitive_id(a)) < position.at(primitive_id(b));
+      });
+      return primitives;
+    }
+    std::sort(primitives.begin(), primitives.end(), [](const auto & a, const auto & b) {
+      return primitive_id(a) < primitive_id(b);
+    });
+    return primitives;
+  }
+
+  /**
+   * @brief {"bounding_boxes": [[min_x, min_y, max_x, max_y], ...], "ids": [...]} for the results
+   */
+  nlohmann::json to_json() const;
+
+private:
+  RegionOfInterest() = default;
+
+  static lanelet::BoundingBox2d expand(const lanelet::BoundingBox2d & box, const double halo);
+
+  template <typename Primitive>
+  static lanelet::Id primitive_id(const Primitive & primitive)
+  {
+    if constexpr (std::is_same_v<Primitive, lanelet::RegulatoryElementConstPtr>) {
+      return primitive->id();
+    } else {
+      return primitive.id();
+    }
+  }
+
+  template <typename PrimitiveT>
+  static constexpr lanelet::validation::Primitive primitive_type()
+  {
+    using lanelet::validation::Primitive;
+    if constexpr (std::is_same_v<PrimitiveT, lanelet::ConstPoint3d>) {
+      return Primitive::Point;
+    } else if constexpr (std::is_same_v<PrimitiveT, lanelet::ConstLineString3d>) {
+      return Primitive::LineString;
+    } else if constexpr (std::is_same_v<PrimitiveT, lanelet::ConstPolygon3d>) {
+      return Primitive::Polygon;
+    } else if constexpr (std::is_same_v<PrimitiveT, lanelet::ConstLanelet>) {
+      return Primitive::Lanelet;
+    } else if constexpr (std::is_same_v<PrimitiveT, lanelet::ConstArea>) {
+      return Primitive::Area;
+    } else {
+      return Primitive::RegulatoryElement;
+    }
+  }
+
+  std::vector<lanelet::BoundingBox2d> boxes_;
+  std::vector<lanelet::Id> ids_;
+  std::map<lanelet::validation::Primitive, std::unordered_set<lanelet::Id>> contained_ids_;
+  // Positions of the primitives in their layers, only for create_shard()
+  std::map<lanelet::validation::Primitive, std::unordered_map<lanelet::Id, size_t>>
+    layer_positions_;
+};
+
+/**
+ * @brief Parse "min_x,min_y,max_x,max_y" given to --roi
+ * @throws std::invalid_argument if the text is not four numbers or the box is empty
+ */
+lanelet::BoundingBox2d parse_roi_bounding_box(const std::string & text);
+
+/**
+ * @brief Parse the comma separated IDs given to --roi_ids
+ * @throws std::invalid_argument if an element is not an integer
+ */
+std::vector<lanelet::Id> parse_roi_ids(const std::string & text);
+
+/**
+ * @brief The halo of the validator, which is its "roi_halo" parameter or default_roi_halo.
+ *
+ * The halo is the distance from the region within which a primitive checked by the validator can
+ * lead to an issue of a primitive in the region (e.g. the search radius for neighbors). Validators
+ * reaching further than default_roi_halo declare it in the parameters file.
+ */
+double roi_halo(const ValidatorConfig & config, const std::string & validator_name);
+
+/**
+ * @brief The primitives of the layer that the validator has to check in the current run.
+ *
+ * Without a region of interest in the validation context of the calling thread, this is every
+ * primitive of the layer in the order of the layer. Otherwise it is RegionOfInterest::search()
+ * with the halo of the validator. Use this instead of iterating a layer of the map directly.
+ *
+ * @param layer
+ * @param validator_name
+ * @return std::vector<typename Layer::ConstPrimitiveT>
+ */
+template <typename Layer>
+std::vector<typename Layer::ConstPrimitiveT> primitives_in_roi(
+  const Layer & layer, const std::string & validator_name)
+{
+  const auto & region_of_interest = ValidationContext::current()->region_of_interest;
+  if (!region_of_interest) {
+    return std::vector<typename Layer::ConstPrimitiveT>(layer.begin(), layer.end());
+  }
+  return region_of_interest->search(
+    layer, roi_halo(*ValidatorConfigStore::current(), validator_name));
+}
+
+/**
+ * @brief The bounding box of the primitive of the issue in the map (in the projected map
+ * coordinates), or nullopt if the issue is not bound to a primitive of the map
+ */
+std::optional<lanelet::BoundingBox2d> issue_bounding_box(
+  const lanelet::LaneletMap & map, const lanelet::validation::Issue & issue);
+
+/**
+ * @brief Remove issues of primitives outside the region of interest of context, if it has one
+ */
+void filter_out_issues_outside_roi(
+  std::vector<lanelet::validation::DetectedIssues> & issues_vector,
+  const ValidationContext & context);
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__ROI_HPP_
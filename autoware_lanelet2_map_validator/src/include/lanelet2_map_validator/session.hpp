@@ -0,0 +1,137 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef LANELET2_MAP_VALIDATOR__SESSION_HPP_
+#define LANELET2_MAP_VALIDATOR__SESSION_HPP_
+
+#include "lanelet2_map_validator/cli.hpp"
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/timing_profile.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_validation/Validation.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief The results of ValidationSession::validate()
+ */
+struct ValidationResults
+{
+  nlohmann::json json_data;  //<! The requirements with the results, as in the results file
+  std::vector<lanelet::validation::DetectedIssues> issues;
+  size_t errors = 0;
+  size_t warnings = 0;
+
+  /**
+   * @brief Whether every requirement passed
+   */
+  bool passed() const;
+};
+
+/**
+ * @brief Validation of a map held in memory, for embedding the validator in another process.
+ *
+ * A session does what the command line tool does for -i, without printing to stdout and without
+ * writing the results, the timing profile or the validator information of the map to files.
+ * The map, the configuration snapshot and the exclusion map are kept between calls of validate(),
+ * so the caches of the map (e.g. its R-trees and the lazily computed centerlines) stay warm, and
+ * the elapsed times of the validators are kept in a timing profile to start the longest ones first
+ * in the next calls.
+ *
+ * The options of MetaConfig about running the validators are applied to each call (e.g.
+ * validator_jobs, timeout_per_validator, global_deadline, max_issues_per_code and fail_fast), and
+ * global_deadline counts from the start of the call. The validators use the shared thread pool of
+ * the process (see set_parallel_jobs()). Calls of validate() on the same session must not overlap.
+ */
+class ValidationSession
+{
+public:
+  /**
+   * @brief Create a session for a map loaded by the caller
+   *
+   * @param map
+   * @param config (The parameters, issue definitions and language of the validators)
+   * @param meta_config (The options of the validation)
+   * @throws std::invalid_argument if map is nullptr
+   */
+  explicit ValidationSession(
+    lanelet::LaneletMapPtr map, ValidatorConfigPtr config = ValidatorConfigStore::current(),
+    MetaConfig meta_config = MetaConfig());
+
+  /**
+   * @brief Load the map with meta_config.projector_type and the origin of
+   * meta_config.command_line_config.validationConfig, and create a session for it
+   *
+   * @param map_file (.osm, .osm.gz or .osm.zst)
+   * @param config
+   * @param meta_config
+   * @throws std::invalid_argument if the file does not exist or the map cannot be loaded
+   */
+  static ValidationSession load(
+    const std::string & map_file, ValidatorConfigPtr config = ValidatorConfigStore::current(),
+    MetaConfig meta_config = MetaConfig());
+
+  const lanelet::LaneletMap & map() const { return *map_; }
+  const lanelet::LaneletMapPtr & map_ptr() const { return map_; }
+  const ValidatorConfigPtr & config() const { return config_; }
+  const MetaConfig & meta_config() const { return meta_config_; }
+  const TimingProfile & timing_profile() const { return timing_profile_; }
+
+  /**
+   * @brief The issues found while loading the map by load(), empty for other sessions
+   */
+  const std::vector<lanelet::validation::DetectedIssues> & loading_issues() const
+  {
+    return loading_issues_;
+  }
+
+  /**
+   * @brief Use the primitives of exclusion_map as the exclusion list of the following calls.
+   * Validators not in exclusion_map have no excluded primitives.
+   */
+  void set_exclusion_map(const ValidatorExclusionMap & exclusion_map);
+
+  /**
+   * @brief Run the validators of the requirements like -i does
+   *
+   * @param requirements (The contents of a requirements file)
+   * @param region_of_interest (Validate only this region of map(), or the whole map if nullptr)
+   * @return ValidationResults
+   */
+  ValidationResults validate(
+    const nlohmann::json & requirements,
+    const std::shared_ptr<const RegionOfInterest> & region_of_interest = nullptr);
+
+private:
+  lanelet::LaneletMapPtr map_;
+  ValidatorConfigPtr config_;
+  MetaConfig meta_config_;
+  ValidatorExclusionMap exclusion_map_;
+  TimingProfile timing_profile_;
+  std::vector<lanelet::validation::DetectedIssues> loading_issues_;
+};
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__SESSION_HPP_
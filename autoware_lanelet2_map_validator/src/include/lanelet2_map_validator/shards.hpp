@@ -0,0 +1,70 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__SHARDS_HPP_
+#define LANELET2_MAP_VALIDATOR__SHARDS_HPP_
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief Field of the issues written by the shard workers with RegionOfInterest::layer_position()
+ */
+constexpr const char * layer_position_key = "layer_position";
+
+/**
+ * @brief Run the validation in shard_count worker processes and return the results JSON of each
+ * worker in the order of the shards.
+ *
+ * Each worker is this executable run with the same arguments (argc, argv) plus --shard_index and
+ * --shard_output. A worker validates the primitives of RegionOfInterest::create_shard() and writes
+ * its results to a temporary directory, where its standard output is logged as well. The
+ * directory is removed when all workers succeed and kept for inspection otherwise.
+ *
+ * @throws std::runtime_error if a worker cannot be started or fails
+ */
+std::vector<nlohmann::json> run_shard_workers(
+  int argc, const char * argv[], const size_t shard_count);
+
+/**
+ * @brief Merge the results of the shards into json_data (the requirements JSON).
+ *
+ * The issues of each validator are merged in the order a single process reports them, without
+ * sorting. Each issue bound to a primitive is reported only by the shard owning the primitive, and
+ * the shard workers report their issues in the order of the layers with the positions of the
+ * primitives (layer_position_key). The lists of the shards are merged by these positions, taking
+ * the first shard for equal positions, so the order equals that of a single process when the
+ * validator reports its issues in the order of a layer. Without positions (the tiles of
+ * --streaming), the issues of each shard stay together in the order of the shards. The issues not
+ * bound to a primitive are reported by every shard and taken from the first shard reporting them.
+ * A validator skipped for failed prerequisites in any shard is skipped in the merged results too,
+ * since the prerequisite fails for the whole map. "passed" of each validator is set from the
+ * merged issues, while "passed" of the requirements is left to summarize_validator_results().
+ * "suppressed_issues" (see --max_issues_per_code) is the sum over the shards, each of which caps
+ * its issues on its own.
+ *
+ * @param json_data
+ * @param shard_results (Results JSON of the shards, made from the same requirements JSON)
+ * @throws std::invalid_argument if the validators of a shard do not match json_data
+ */
+void merge_shard_results(
+  nlohmann::json & json_data, const std::vector<nlohmann::json> & shard_results);
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__SHARDS_HPP_
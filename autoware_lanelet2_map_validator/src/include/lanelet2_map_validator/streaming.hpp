@@ -0,0 +1,185 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__STREAMING_HPP_
+#define LANELET2_MAP_VALIDATOR__STREAMING_HPP_
+
+#include "lanelet2_map_validator/cli.hpp"
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <lanelet2_core/Forward.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+class OsmTileCache;
+
+/**
+ * @brief Index of the elements of an OSM file by tile and file offset, built by reading the file
+ * once without loading it as a map.
+ *
+ * Nodes are put on a grid of tiles of about tile_size meters in latitude and longitude. A way
+ * belongs to the tile of its first node and a relation to the tile of its first member, so that
+ * each element (and the lanelet2 primitive made from it) is owned by exactly one tile.
+ */
+class OsmTileIndex
+{
+public:
+  enum class ElementType { Node = 0, Way = 1, Relation = 2 };
+  using ElementKey = std::pair<ElementType, lanelet::Id>;
+  using TileKey = std::pair<std::int64_t, std::int64_t>;  //<! Row (latitude) and column
+
+  /**
+   * @brief Index the OSM file
+   * @throws std::runtime_error if the file cannot be read or has no nodes
+   * @throws std::invalid_argument if the file is compressed (see compression_of())
+   */
+  OsmTileIndex(const std::filesystem::path & osm_file, const double tile_size);
+
+  const std::filesystem::path & osm_file() const { return osm_file_; }
+
+  /**
+   * @brief Tiles owning at least one element, in the order of rows and columns
+   */
+  std::vector<TileKey> tiles() const;
+
+  const std::vector<ElementKey> & owned_elements(const TileKey & tile) const;
+
+  size_t element_count() const;
+
+  /**
+   * @brief The tile owning the element (the element must be in the index)
+   */
+  const TileKey & tile_of(const ElementKey & element) const;
+
+  /**
+   * @brief The elements owned by the tile and its 8 neighbors, and all elements they refer to
+   * (recursively), nodes first, then ways and relations, each in the order of the file.
+   */
+  std::vector<ElementKey> elements_around(const TileKey & tile) const;
+
+  /**
+   * @brief Read the text of the elements owned by the tile from the OSM file
+   */
+  std::map<ElementKey, std::string> read_owned_elements(const TileKey & tile) const;
+
+  /**
+   * @brief Write an OSM document with elements_around(tile), taking their text from cache
+   */
+  void write_tile_map(const TileKey & tile, OsmTileCache & cache, std::ostream & os) const;
+
+private:
+  struct Element
+  {
+    std::uint64_t offset = 0;
+    std::uint64_t length = 0;
+    TileKey tile{0, 0};
+    std::vector<ElementKey> references;  //<! Nodes of a way or members of a relation
+  };
+
+  void read_elements(std::istream & stream);
+  void assign_tiles();
+
+  const Element * find(const ElementKey & key) const;
+
+  std::filesystem::path osm_file_;
+  double tile_size_;
+  std::string header_;  //<! Everything up to the end of the <osm> tag
+  std::array<std::unordered_map<lanelet::Id, Element>, 3> elements_;
+  std::map<TileKey, std::vector<ElementKey>> tiles_;
+};
+
+/**
+ * @brief LRU cache of the element texts of tiles, keeping at most capacity_bytes of text.
+ *
+ * A tile is read from the OSM file as a whole when one of its elements is requested. The tile
+ * used least recently is dropped when the cache exceeds its capacity, except for the tile just
+ * read.
+ */
+class OsmTileCache
+{
+public:
+  OsmTileCache(const OsmTileIndex & index, const size_t capacity_bytes);
+
+  /**
+   * @brief The text of the element, valid until the next call
+   */
+  const std::string & element_text(const OsmTileIndex::ElementKey & element);
+
+  size_t size_bytes() const { return size_bytes_; }
+
+private:
+  struct Entry
+  {
+    std::map<OsmTileIndex::ElementKey, std::string> texts;
+    size_t bytes = 0;
+    std::list<OsmTileIndex::TileKey>::iterator position;
+  };
+
+  const OsmTileIndex & index_;
+  size_t capacity_bytes_;
+  size_t size_bytes_ = 0;
+  std::list<OsmTileIndex::TileKey> recently_used_;  //<! Most recently used first
+  std::map<OsmTileIndex::TileKey, Entry> entries_;
+};
+
+/**
+ * @brief Results of validate_tiles()
+ */
+struct TileValidationResults
+{
+  std::vector<nlohmann::json> tile_results;  //<! Results JSON of each tile
+  lanelet::validation::Issues loading_issues;  //<! Issues found while loading the tiles
+};
+
+/**
+ * @brief Run the validators of json_data tile by tile and return the results JSON of each tile.
+ *
+ * For each tile, the elements around the tile are written to a temporary OSM file and loaded as a
+ * map, which is validated with a RegionOfInterest of the primitives owned by the tile. Only one
+ * tile map is in memory at a time. The results are merged with merge_shard_results().
+ * With --fail_fast, the tiles after the first one with an error are not validated.
+ *
+ * The issues found while loading a tile are kept for the primitives it owns, and the ones not bound
+ * to a primitive are kept once.
+ *
+ * @throws std::runtime_error if a tile cannot be loaded
+ */
+TileValidationResults validate_tiles(
+  const OsmTileIndex & index, const nlohmann::json & json_data, const MetaConfig & meta_config,
+  const ValidatorExclusionMap & exclusion_map, const ValidatorConfigPtr & config,
+  const size_t cache_bytes);
+
+/**
+ * @brief Add an informational issue to the validators with the "global_context" parameter, whose
+ * results may be incomplete when the map is validated tile by tile.
+ */
+void mark_global_context_validators(nlohmann::json & json_data, const ValidatorConfig & config);
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__STREAMING_HPP_
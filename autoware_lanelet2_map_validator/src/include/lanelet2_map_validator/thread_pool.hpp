@@ -0,0 +1,294 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VALIDATOR__THREAD_POOL_HPP_
+#define LANELET2_MAP_VALIDATOR__THREAD_POOL_HPP_
+
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/issue_cap.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
+
+#include <lanelet2_validation/Validation.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief A fixed-size pool of worker threads consuming a FIFO task queue.
+ */
+class ThreadPool
+{
+public:
+  explicit ThreadPool(const size_t num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool & operator=(const ThreadPool &) = delete;
+
+  /**
+   * @brief Push a task to the queue. The returned future rethrows exceptions thrown by the task.
+   */
+  std::future<void> submit(std::function<void()> task);
+
+  size_t size() const { return workers_.size(); }
+
+private:
+  void worker_loop();
+
+  std::vector<std::thread> workers_;
+  std::queue<std::packaged_task<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopping_ = false;
+};
+
+/**
+ * @brief Whether the calling thread is a worker thread of a ThreadPool or is running a chunk of
+ * parallel_for_chunks. Parallel loops called in such threads run serially.
+ */
+bool in_parallel_task();
+
+/**
+ * @brief Marks the calling thread as running a parallel task while this object is alive
+ */
+class ParallelTaskScope
+{
+public:
+  ParallelTaskScope();
+  ~ParallelTaskScope();
+
+  ParallelTaskScope(const ParallelTaskScope &) = delete;
+  ParallelTaskScope & operator=(const ParallelTaskScope &) = delete;
+
+private:
+  bool previous_;
+};
+
+/**
+ * @brief Set the number of threads used by parallel_for. 0 means the number of hardware threads.
+ */
+void set_parallel_jobs(const size_t jobs);
+
+/**
+ * @brief The number of threads used by parallel_for (always 1 or more)
+ */
+size_t parallel_jobs();
+
+/**
+ * @brief The process-wide thread pool used by parallel_for, which has parallel_jobs() - 1 workers
+ * since the calling thread also takes a share of the work.
+ *
+ * set_parallel_jobs() replaces the pool for later calls, and the pool returned here stays alive
+ * while it is held. Do not hold it in a task running on the pool itself, since the last owner
+ * joins the workers of the pool.
+ */
+std::shared_ptr<ThreadPool> shared_thread_pool();
+
+/**
+ * @brief The number of chunks parallel_for splits a range of the size into
+ *
+ * @param size
+ * @param min_chunk_size (Ranges smaller than this are not split)
+ * @return size_t (1 when called from a parallel task, since nested loops run serially)
+ */
+inline size_t parallel_chunk_count(const size_t size, const size_t min_chunk_size = 1)
+{
+  if (in_parallel_task()) {
+    return 1;
+  }
+  const size_t grain = std::max<size_t>(min_chunk_size, 1);
+  return std::max<size_t>(1, std::min(parallel_jobs(), (size + grain - 1) / grain));
+}
+
+/**
+ * @brief Split [0, size) into num_chunks contiguous chunks, run func(chunk, begin, end) for each
+ * of them on the shared thread pool and wait for all of them.
+ *
+ * The first chunk runs on the calling thread. The other chunks run with the configuration
+ * snapshot (see ValidatorConfigStore) and the validation context of the calling thread installed.
+ * The exception thrown by the earliest chunk is rethrown after all chunks finish.
+ */
+template <typename Func>
+void parallel_for_chunks(const size_t size, const size_t num_chunks, Func && func)
+{
+  if (num_chunks <= 1) {
+    func(size_t{0}, size_t{0}, size);
+    return;
+  }
+
+  const size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+  const auto run_chunk = [&func, chunk_size, size](const size_t chunk) {
+    const size_t begin = std::min(size, chunk * chunk_size);
+    const size_t end = std::min(size, begin + chunk_size);
+    func(chunk, begin, end);
+  };
+
+  const ValidatorConfigPtr config = ValidatorConfigStore::current();
+  const ValidationContextPtr context = ValidationContext::current();
+  const std::shared_ptr<ThreadPool> pool = shared_thread_pool();
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_chunks - 1);
+  for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+    futures.push_back(pool->submit([&run_chunk, &config, &context, chunk]() {
+      const ValidatorConfigStore::Scope config_scope(config);
+      const ValidationContext::Scope context_scope(context);
+      run_chunk(chunk);
+    }));
+  }
+
+  std::exception_ptr first_exception = nullptr;
+  try {
+    const ParallelTaskScope scope;
+    run_chunk(0);
+  } catch (...) {
+    first_exception = std::current_exception();
+  }
+  for (auto & future : futures) {
+    try {
+      future.get();
+    } catch (...) {
+      if (!first_exception) {
+        first_exception = std::current_exception();
+      }
+    }
+  }
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
+}
+
+/**
+ * @brief Run func(i) for every i in [0, size) and wait for all of them.
+ *
+ * The range is split into contiguous chunks that run on the shared thread pool. func must not
+ * write to state shared with other indices unless it is synchronized. Nested calls from func run
+ * serially.
+ *
+ * @param size
+ * @param func
+ * @param min_chunk_size (Ranges smaller than this are not split)
+ */
+template <typename Func>
+void parallel_for(const size_t size, Func && func, const size_t min_chunk_size = 1)
+{
+  parallel_for_chunks(
+    size, parallel_chunk_count(size, min_chunk_size),
+    [&func](const size_t, const size_t begin, const size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        func(i);
+      }
+    });
+}
+
+/**
+ * @brief Run func(element, output) for every element in parallel and concatenate the outputs.
+ *
+ * Each chunk of elements appends to its own buffer and the buffers are merged in the order of
+ * the chunks, so the result is the same as running func over the elements in a serial loop.
+ * Elements without random access (e.g. lanelet map layers) are copied into a vector first.
+ * Once validation_cancelled() returns true, the remaining elements are skipped.
+ *
+ * If T is lanelet::validation::Issue and the validation context has an issue cap, each chunk adds
+ * its issues under a chunk_cap() of it, which are merged in the order of the chunks, so the same
+ * issues pass the cap as in a serial loop.
+ *
+ * func must not trigger lazily computed caches of primitives that other elements may also touch,
+ * such as ConstLanelet::centerline(). Compute them before calling this function if needed.
+ *
+ * @tparam T (Type of the output items, e.g. lanelet::validation::Issue)
+ * @param elements
+ * @param func (Called as func(const Element &, std::vector<T> &))
+ * @param min_chunk_size (Ranges smaller than this are not split)
+ * @return std::vector<T>
+ */
+template <typename T, typename Elements, typename Func>
+std::vector<T> parallel_collect(
+  const Elements & elements, Func && func, const size_t min_chunk_size = 1)
+{
+  using Iterator = decltype(std::begin(elements));
+  using Element = typename std::iterator_traits<Iterator>::value_type;
+  if constexpr (!std::is_base_of_v<
+                  std::random_access_iterator_tag,
+                  typename std::iterator_traits<Iterator>::iterator_category>) {
+    const std::vector<Element> element_vector(std::begin(elements), std::end(elements));
+    return parallel_collect<T>(element_vector, std::forward<Func>(func), min_chunk_size);
+  } else {
+    const size_t size =
+      static_cast<size_t>(std::distance(std::begin(elements), std::end(elements)));
+    const size_t num_chunks = parallel_chunk_count(size, min_chunk_size);
+    std::vector<std::vector<T>> buffers(num_chunks);
+    const ValidationContextPtr context = ValidationContext::current();
+    std::vector<ValidationContextPtr> chunk_contexts;
+    if constexpr (std::is_same_v<T, lanelet::validation::Issue>) {
+      if (num_chunks > 1 && context->issue_cap) {
+        chunk_contexts.reserve(num_chunks);
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+          auto chunk_context = std::make_shared<ValidationContext>(*context);
+          chunk_context->issue_cap = context->issue_cap->chunk_cap();
+          chunk_contexts.push_back(std::move(chunk_context));
+        }
+      }
+    }
+    parallel_for_chunks(
+      size, num_chunks, [&](const size_t chunk, const size_t begin, const size_t end) {
+        std::optional<ValidationContext::Scope> chunk_scope;
+        if (!chunk_contexts.empty()) {
+          chunk_scope.emplace(chunk_contexts[chunk]);
+        }
+        auto it = std::next(std::begin(elements), static_cast<std::ptrdiff_t>(begin));
+        for (size_t i = begin; i < end && !validation_cancelled(); i++, ++it) {
+          func(*it, buffers[chunk]);
+        }
+      });
+
+    if (num_chunks == 1) {
+      return std::move(buffers.front());
+    }
+    size_t total_size = 0;
+    for (const auto & buffer : buffers) {
+      total_size += buffer.size();
+    }
+    std::vector<T> result;
+    result.reserve(total_size);
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+      const size_t chunk_begin = result.size();
+      result.insert(
+        result.end(), std::make_move_iterator(buffers[chunk].begin()),
+        std::make_move_iterator(buffers[chunk].end()));
+      if constexpr (std::is_same_v<T, lanelet::validation::Issue>) {
+        if (!chunk_contexts.empty()) {
+          context->issue_cap->merge_chunk(*chunk_contexts[chunk]->issue_cap, result, chunk_begin);
+        }
+      }
+    }
+    return result;
+  }
+}
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__THREAD_POOL_HPP_
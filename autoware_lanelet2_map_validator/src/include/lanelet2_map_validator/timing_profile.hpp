@@ -0,0 +1,93 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef LANELET2_MAP_VALIDATOR__TIMING_PROFILE_HPP_
+#define LANELET2_MAP_VALIDATOR__TIMING_PROFILE_HPP_
+
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+/**
+ * @brief The cost (in milliseconds) of validators that are neither in the timing profile nor have
+ * the "estimated_cost_ms" parameter
+ */
+constexpr double default_validator_cost_ms = 100.0;
+
+/**
+ * @brief The elapsed time of each validator measured in previous runs, from which the validators
+ * expected to take longest are started first.
+ *
+ * The profile is stored as {"validators": {<validator name>: {"elapsed_ms": <number>}, ...}}.
+ * A run records the validators it ran and keeps the entries of the others.
+ */
+class TimingProfile
+{
+public:
+  /**
+   * @brief Read a profile written by save(). A file that does not exist yet is an empty profile.
+   * @throws std::runtime_error if the file cannot be parsed
+   */
+  static TimingProfile load(const std::filesystem::path & file);
+
+  /**
+   * @brief Write the profile to the file, replacing it
+   * @throws std::runtime_error if the file cannot be written
+   */
+  void save(const std::filesystem::path & file) const;
+
+  /**
+   * @brief The last elapsed time of the validator, or nullopt if it was never recorded
+   */
+  std::optional<double> elapsed_ms(const std::string & validator_name) const;
+
+  void record(const std::string & validator_name, const double elapsed_ms);
+
+  bool empty() const { return elapsed_ms_.empty(); }
+
+private:
+  std::map<std::string, double> elapsed_ms_;
+};
+
+/**
+ * @brief The "estimated_cost_ms" parameter of the validator, or default_validator_cost_ms.
+ *
+ * The parameter is a rough static estimate for validators known to be expensive, used until a
+ * timing profile measured them.
+ */
+double estimated_cost_ms(const ValidatorConfig & config, const std::string & validator_name);
+
+/**
+ * @brief The expected cost of each validator, which is its elapsed time in timing_profile if it
+ * is recorded there, and estimated_cost_ms() otherwise
+ *
+ * @param validators
+ * @param config
+ * @param timing_profile (Optional)
+ * @return ValidatorCosts
+ */
+ValidatorCosts estimate_validator_costs(
+  const Validators & validators, const ValidatorConfig & config,
+  const TimingProfile * timing_profile = nullptr);
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__TIMING_PROFILE_HPP_
@@ -156,4 +156,14 @@ lanelet::validation::Issue construct_issue_from_code(
   const std::string & issue_code, const lanelet::Id primitive_id,
   const std::map<std::string, std::string> & substitutions = {});
 
+/**
+ * @brief Append construct_issue_from_code() to issues unless the issue cap of the current run
+ * (see lanelet::autoware::validation::IssueCap) has been reached for the issue code, in which case
+ * the issue is only counted and never constructed. The issue is also reported to the watcher of
+ * --fail_fast (see lanelet::autoware::validation::FailFast). Validators add their issues with this.
+ */
+void add_issue_from_code(
+  lanelet::validation::Issues & issues, const std::string & issue_code,
+  const lanelet::Id primitive_id, const std::map<std::string, std::string> & substitutions = {});
+
 #endif  // LANELET2_MAP_VALIDATOR__UTILS_HPP_
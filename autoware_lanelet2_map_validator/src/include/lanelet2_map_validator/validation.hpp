@@ -16,16 +16,22 @@
 #define LANELET2_MAP_VALIDATOR__VALIDATION_HPP_
 
 #include "lanelet2_map_validator/cli.hpp"
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/issue_cap.hpp"
+#include "lanelet2_map_validator/results_writer.hpp"
 #include "lanelet2_map_validator/utils.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
 
 #include <nlohmann/json.hpp>
 
 #include <lanelet2_validation/Cli.h>
 #include <lanelet2_validation/Validation.h>
 
+#include <chrono>
 #include <map>
+#include <memory>
+#include <optional>
 #include <queue>
-#include <regex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -37,6 +43,7 @@ using json = nlohmann::json;
 
 namespace lanelet::autoware::validation
 {
+class TimingProfile;
 
 /**
  * @brief alias for code clarity
@@ -55,6 +62,11 @@ struct ValidatorInfo
 
 using Validators = std::unordered_map<ValidatorName, ValidatorInfo>;
 
+/**
+ * @brief expected cost of each validator in milliseconds (see estimate_validator_costs())
+ */
+using ValidatorCosts = std::unordered_map<ValidatorName, double>;
+
 /**
  * @brief 1st is either of "point", "linestring", "polygon", "lanelet", "area", "regulatory
  * element", "primitive"
@@ -64,21 +76,32 @@ using SimplePrimitive = std::pair<std::string, lanelet::Id>;
 using ValidatorExclusionMap = std::map<ValidatorName, std::vector<SimplePrimitive>>;
 
 /**
- * @brief simply call lanelet::validation::validateMap
- * @return return lanelet::validation::validateMap()
+ * @brief simply call lanelet::validation::validateMap with the configuration snapshot and the
+ * validation context installed
+ * @return return lanelet::validation::validateMap() without issues outside the region of interest
+ * of context (if it has one)
  */
 std::vector<lanelet::validation::DetectedIssues> apply_validation(
   const lanelet::LaneletMap & lanelet_map,
-  const lanelet::validation::ValidationConfig & val_config);
+  const lanelet::validation::ValidationConfig & val_config,
+  const ValidatorConfigPtr & config = ValidatorConfigStore::current(),
+  const ValidationContextPtr & context = ValidationContext::current());
 
 Validators parse_validators(const json & json_data);
 
 /**
- * @brief topologically sort the validators
+ * @brief topologically sort the validators, putting the most expensive ready validator first.
+ *
+ * A validator is ready once all its prerequisites are in the queue. Among the ready validators,
+ * the one with the longest chain of costs through itself and the validators depending on it comes
+ * first (longest processing time first, ties broken by name), so that validators run concurrently
+ * by validate_all_requirements() do not start a long chain last. Without costs, every validator
+ * costs default_validator_cost_ms.
+ *
  * @return names of validators(1st), remaining validators(2nd, usually normal)
  */
 std::tuple<std::queue<ValidatorName>, Validators> create_validation_queue(
-  const Validators & validators);
+  const Validators & validators, const ValidatorCosts & costs = {});
 
 /**
  * @brief find a validator block by name
@@ -98,21 +121,91 @@ std::vector<lanelet::validation::DetectedIssues> describe_unused_validators_to_j
 std::vector<lanelet::validation::DetectedIssues> check_prerequisite_completion(
   const Validators & validators, const ValidatorName & target_validator_name);
 
+/**
+ * @brief set "passed" of each requirement in json_data, which passes if all its validators passed
+ */
+void evaluate_requirements(json & json_data);
+
 /**
  * @brief check if requirement have passed, count the number of error/warning, etc., then set it to
  * json_data and print to stdout
  */
 void summarize_validator_results(json & json_data);
 
+/**
+ * @brief same as above but takes the number of errors/warnings instead of counting them in
+ * json_data, for results whose issues were streamed by ResultsWriter
+ */
+void summarize_validator_results(json & json_data, const IssueCounts & issue_counts);
+
+/**
+ * @brief count the errors/warnings in issues
+ */
+IssueCounts count_issues(const std::vector<lanelet::validation::DetectedIssues> & issues);
+
 /**
  * @brief helper to create a ValidationConfig with .checksFilter = {validator_name}
  */
 lanelet::validation::ValidationConfig replace_validator(
   const lanelet::validation::ValidationConfig & input, const ValidatorName & validator_name);
 
+/**
+ * @brief the deadline of --global_deadline, or nullopt if it is not set
+ */
+std::optional<std::chrono::steady_clock::time_point> global_deadline(
+  const lanelet::autoware::validation::MetaConfig & validator_config);
+
+/**
+ * @brief the deadline of a validator starting at start, which is the earlier of
+ * --timeout_per_validator after start and --global_deadline, or nullopt if neither is set
+ */
+std::optional<std::chrono::steady_clock::time_point> validator_deadline(
+  const lanelet::autoware::validation::MetaConfig & validator_config,
+  const std::chrono::steady_clock::time_point & start);
+
+/**
+ * @brief the issue cap of a validator for --max_issues_per_code and --stop_at_issue_cap, or nullptr
+ * if its issues are not capped. The "max_issues_per_code" parameter of the validator in config
+ * overrides --max_issues_per_code.
+ */
+std::shared_ptr<IssueCap> create_issue_cap(
+  const lanelet::autoware::validation::MetaConfig & validator_config,
+  const ValidatorConfig & config, const ValidatorName & validator_name);
+
+/**
+ * @brief run all validators of the requirements in json_data. The validators read their
+ * parameters and issue definitions from config during the whole run, and the region of interest
+ * and the issue locator from context.
+ *
+ * The issues of each validator are added to json_data, or handed to results_writer as soon as
+ * the validator finishes if it is given. The issues handed to results_writer are not kept, so the
+ * returned issues only contain the ones in json_data then (see ResultsWriter::issue_counts()).
+ *
+ * A validator still running at its deadline (see validator_deadline()) stops at its next
+ * cancellation check. If the check actually stopped it, it gets "outcome": "timeout" in json_data
+ * and an error issue in addition to the issues found so far, so that the validators depending on
+ * it are skipped.
+ *
+ * The issues of each issue code past the cap of create_issue_cap() are replaced by a summary
+ * issue, and their number is added to json_data as "suppressed_issues".
+ *
+ * With --fail_fast, the validator stops at its first error not in the exclusion list, and the
+ * validators after it are not run. They get "outcome": "cancelled" and an error issue, except for
+ * those skipped for their prerequisites.
+ *
+ * The validators are started in the order of create_validation_queue() with the costs of
+ * estimate_validator_costs() for timing_profile. With --validator_jobs above 1, up to that many
+ * validators whose prerequisites have finished run at once on the shared thread pool, and the
+ * loops inside them run serially. The centerlines of all lanelets are computed beforehand, since
+ * lanelet2 caches them in the lanelets without synchronization. The elapsed time of each
+ * validator that ran is recorded to timing_profile.
+ */
 std::vector<lanelet::validation::DetectedIssues> validate_all_requirements(
   json & json_data, const lanelet::autoware::validation::MetaConfig & validator_config,
-  const lanelet::LaneletMap & lanelet_map, const ValidatorExclusionMap & exclusion_map);
+  const lanelet::LaneletMap & lanelet_map, const ValidatorExclusionMap & exclusion_map,
+  const ValidatorConfigPtr & config = ValidatorConfigStore::current(),
+  const ValidationContextPtr & context = ValidationContext::current(),
+  ResultsWriter * results_writer = nullptr, TimingProfile * timing_profile = nullptr);
 
 void export_results(json & json_data, const std::string output_file_path);
 
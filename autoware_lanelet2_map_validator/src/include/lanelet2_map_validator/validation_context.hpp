@@ -0,0 +1,105 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef LANELET2_MAP_VALIDATOR__VALIDATION_CONTEXT_HPP_
+#define LANELET2_MAP_VALIDATOR__VALIDATION_CONTEXT_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+
+namespace lanelet::autoware::validation
+{
+class FailFast;
+class IssueCap;
+class IssueLocator;
+class RegionOfInterest;
+
+/**
+ * @brief The state of a validation run, as opposed to its configuration (see ValidatorConfig).
+ *
+ * The region of interest and the issue locator apply to the whole run, while the deadline, the
+ * issue cap, the watcher of --fail_fast and the stop flag belong to the validator being run, so
+ * validate_all_requirements() derives a context for each validator from the one of the run.
+ * A context is not modified once it is installed with a Scope.
+ */
+struct ValidationContext
+{
+  // The part of the map to validate, or nullptr if the whole map is validated
+  std::shared_ptr<const RegionOfInterest> region_of_interest;
+
+  // The time at which validators stop checking further primitives, or nullopt if they run to
+  // completion
+  std::optional<std::chrono::steady_clock::time_point> deadline;
+
+  // Set by validation_cancelled() when it returns true because the deadline has passed, so that
+  // the caller can tell whether the deadline actually stopped the validator, or nullptr
+  std::shared_ptr<std::atomic<bool>> deadline_hit;
+
+  // The cap of issues per issue code, or nullptr if every issue is kept
+  std::shared_ptr<IssueCap> issue_cap;
+
+  // The watcher of --fail_fast, or nullptr without it
+  std::shared_ptr<FailFast> fail_fast;
+
+  // Set by the caller to stop the validator (e.g. when its results are no longer needed), or
+  // nullptr if it cannot be stopped this way
+  std::shared_ptr<const std::atomic<bool>> stop_flag;
+
+  // The locator of --issue_geometry that adds the position of each issue to the results, or
+  // nullptr without it
+  std::shared_ptr<IssueLocator> issue_locator;
+
+  /**
+   * @brief Installs a context on the calling thread while this object is alive
+   */
+  class Scope
+  {
+  public:
+    explicit Scope(std::shared_ptr<const ValidationContext> context);
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope & operator=(const Scope &) = delete;
+
+  private:
+    std::shared_ptr<const ValidationContext> previous_;
+  };
+
+  /**
+   * @brief The context installed on the calling thread, or an empty context (i.e. the whole map
+   * without any limit) if none is installed
+   */
+  static const std::shared_ptr<const ValidationContext> & current();
+};
+
+using ValidationContextPtr = std::shared_ptr<const ValidationContext>;
+
+/**
+ * @brief Whether the deadline of the validation context of the calling thread has passed, its
+ * issue cap is exhausted (see IssueCap::exhausted()), --fail_fast found an error or its stop flag
+ * is set.
+ *
+ * Validators check this in their loops over the primitives of the map and stop the loop once it
+ * returns true, so that a validator stuck on a pathological part of the map reports the issues
+ * found so far instead of blocking the run (see --timeout_per_validator and --global_deadline),
+ * and a validator already known to fail stops early with --stop_at_issue_cap or --fail_fast.
+ */
+bool validation_cancelled();
+
+}  // namespace lanelet::autoware::validation
+
+#endif  // LANELET2_MAP_VALIDATOR__VALIDATION_CONTEXT_HPP_
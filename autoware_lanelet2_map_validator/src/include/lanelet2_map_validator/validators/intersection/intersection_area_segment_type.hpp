@@ -19,6 +19,7 @@
 #include <lanelet2_validation/ValidatorFactory.h>
 
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 namespace lanelet::autoware::validation
@@ -43,14 +44,14 @@ private:
   lanelet::validation::Issues check_intersection_area_segment_type(const lanelet::LaneletMap & map);
 
   /**
-   * @brief Create a submap consisting of road_border linestrings and lanelet edges only.
+   * @brief Create a lookup of the IDs of points that belong to a border.
+   * The borders are road_border linestrings and the starting/ending edges of road lanelets.
+   * This is built once per map and shared among all intersection areas.
    *
    * @param map
-   * @param intersection_area
-   * @return lanelet::LaneletSubmapUPtr
+   * @return std::unordered_set<lanelet::Id> (IDs of border points)
    */
-  lanelet::LaneletSubmapUPtr create_nearby_borders_submap(
-    const lanelet::LaneletMap & map, const lanelet::ConstPolygon3d & intersection_area);
+  std::unordered_set<lanelet::Id> create_border_point_lookup(const lanelet::LaneletMap & map);
 
   /**
    * @brief Create a list-up-string from Ids=vector<Id>
@@ -29,6 +29,22 @@ public:
 
 private:
   lanelet::validation::Issues check_intersection_area_tagging(const lanelet::LaneletMap & map);
+
+  /**
+   * @brief Check the intersection_area tags of road lanelets covered by the intersection area
+   * (Issue-001 and Issue-002)
+   */
+  void check_lanelets_in_intersection_area(
+    const lanelet::LaneletMap & map, const lanelet::ConstPolygon3d & polygon3d,
+    lanelet::validation::Issues & issues);
+
+  /**
+   * @brief Check that the intersection area tagged to the lanelet covers the lanelet, and that
+   * turning lanelets are tagged (Issue-003 and Issue-004)
+   */
+  void check_intersection_area_tag(
+    const lanelet::LaneletMap & map, const lanelet::ConstLanelet & lanelet,
+    lanelet::validation::Issues & issues);
 };
 }  // namespace lanelet::autoware::validation
 
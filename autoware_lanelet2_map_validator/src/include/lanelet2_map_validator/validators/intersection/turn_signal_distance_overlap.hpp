@@ -16,12 +16,13 @@
 #define LANELET2_MAP_VALIDATOR__VALIDATORS__INTERSECTION__TURN_SIGNAL_DISTANCE_OVERLAP_HPP_
 
 #include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/lane_topology.hpp"
 
-#include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_validation/Validation.h>
 #include <lanelet2_validation/ValidatorFactory.h>
 
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace lanelet::autoware::validation
@@ -46,9 +47,20 @@ public:
 
 private:
   lanelet::validation::Issues check_turn_signal_distance_overlap(const lanelet::LaneletMap & map);
-  std::unordered_set<lanelet::Id> find_overlapping_lanelets(
-    const ConstLanelet & intersection_lane,
-    const lanelet::routing::RoutingGraphPtr & routing_graph_ptr, double distance_threshold);
+  /**
+   * @brief Search backward from all turning lanelets at once and list up the previous lanelets
+   * that have the opposite turn_direction within the turn_signal_distance of each turning lanelet.
+   * The lanelets are traversed level by level, the number of steps from the turning lanelets, and
+   * each lanelet of a level is expanded once for all turning lanelets reaching it. The results are
+   * the same as a breadth-first search from each turning lanelet.
+   *
+   * @param turning_lanes
+   * @param lane_topology
+   * @return std::unordered_map<lanelet::Id, std::unordered_set<lanelet::Id>> (turning lanelet ID
+   * -> IDs of the overlapping previous lanelets)
+   */
+  std::unordered_map<lanelet::Id, std::unordered_set<lanelet::Id>> find_overlapping_lanelets(
+    const lanelet::ConstLanelets & turning_lanes, const LaneTopology & lane_topology);
   std::string set_to_string(std::unordered_set<lanelet::Id> & id_set);
   double calc_lanelet_length(const lanelet::ConstLanelet & lane);
 
@@ -16,8 +16,10 @@
 #define LANELET2_MAP_VALIDATOR__VALIDATORS__LANE__BORDER_SHARING_HPP_
 
 #include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/lane_topology.hpp"
 
-#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_core/primitives/BoundingBox.h>
+#include <lanelet2_routing/Types.h>
 #include <lanelet2_traffic_rules/GenericTrafficRules.h>
 #include <lanelet2_validation/Validation.h>
 #include <lanelet2_validation/ValidatorFactory.h>
@@ -38,21 +40,37 @@ public:
   {
     const auto parameters = ValidatorConfigStore::parameters()[name()];
     iou_threshold_ = get_parameter_or<double>(parameters, "iou_threshold", 0.05);
+    simplification_tolerance_ =
+      get_parameter_or<double>(parameters, "simplification_tolerance", 0.0);
   }
 
+  struct ExpandedPolygon
+  {
+    lanelet::BasicPolygon2d polygon;
+    lanelet::BoundingBox2d bounding_box;
+  };
+
+  /**
+   * @brief return a polygon which is an expanded shape of the lanelet and its bounding box. each
+   * point will be expanded to the lateral direction, and its variation length is about (average
+   * length of both edges of the lanelet) * (scale_factor-1). Each bound is walked only once,
+   * and the points at the bends of a bound are shifted along the miter of its segments.
+   */
+  ExpandedPolygon expanded_lanelet_polygon(
+    const lanelet::ConstLanelet & lane, const double & scale_factor);
+
 private:
   lanelet::validation::Issues check_border_sharing(const lanelet::LaneletMap & map);
 
   /**
-   * @brief return a polygon which is an expanded shape of the lanelet. each point will be expanded
-   * to the lateral direction, and its variation length is about (average length of both edges of
-   * the lanelet) * (scale_factor-1)
+   * @brief append the points of the bound shifted by delta to its left side, and extend the end
+   * points by delta to the longitudinal direction
    */
-  lanelet::BasicPolygon2d expanded_lanelet_polygon(
-    const lanelet::ConstLanelet & lane, const double & scale_factor);
+  static void append_offset_bound(
+    const lanelet::BasicLineString2d & bound, const double delta, ExpandedPolygon & expanded);
 
   lanelet::routing::RelationType get_relation(
-    const lanelet::routing::RoutingGraphUPtr & routing_graph_ptr, const lanelet::ConstLanelet from,
+    const LaneTopology & lane_topology, const lanelet::ConstLanelet from,
     const lanelet::ConstLanelet to);
 
   /**
@@ -62,6 +80,7 @@ private:
     const lanelet::BasicPolygon2d & polygon1, const lanelet::BasicPolygon2d & polygon2);
 
   double iou_threshold_;
+  double simplification_tolerance_;
 };
 
 namespace traffic_rules
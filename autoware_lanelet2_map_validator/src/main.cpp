@@ -14,20 +14,227 @@
 
 #include "lanelet2_map_validator/cli.hpp"
 #include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/fail_fast.hpp"
 #include "lanelet2_map_validator/io.hpp"
+#include "lanelet2_map_validator/issue_cap.hpp"
+#include "lanelet2_map_validator/issue_locator.hpp"
 #include "lanelet2_map_validator/map_loader.hpp"
+#include "lanelet2_map_validator/progress.hpp"
+#include "lanelet2_map_validator/results_writer.hpp"
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/shards.hpp"
+#include "lanelet2_map_validator/streaming.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
+#include "lanelet2_map_validator/timing_profile.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 #include "lanelet2_map_validator/validation.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
+namespace
+{
+// Report the run_finished event and return the number of errors
+size_t report_run_finished(const lanelet::autoware::validation::IssueCounts & issue_counts)
+{
+  lanelet::autoware::validation::report_progress(
+    "run_finished", {{"errors", issue_counts.errors}, {"warnings", issue_counts.warnings}});
+  return issue_counts.errors;
+}
+
+size_t report_run_finished(const json & json_data)
+{
+  size_t errors = 0;
+  size_t warnings = 0;
+  for (const auto & requirement : json_data["requirements"]) {
+    for (const auto & validator : requirement["validators"]) {
+      for (const auto & issue : validator.value("issues", json::array())) {
+        if (
+          issue["severity"] ==
+          lanelet::validation::toString(lanelet::validation::Severity::Error)) {
+          errors++;
+        } else if (
+          issue["severity"] ==
+          lanelet::validation::toString(lanelet::validation::Severity::Warning)) {
+          warnings++;
+        }
+      }
+    }
+  }
+  lanelet::autoware::validation::report_progress(
+    "run_finished", {{"errors", errors}, {"warnings", warnings}});
+  return errors;
+}
+
+// The exit code of a run that found the given number of errors
+int exit_code(const lanelet::autoware::validation::MetaConfig & meta_config, const size_t errors)
+{
+  // The coordinator process of --shards treats other exit codes of the workers as failures
+  if (meta_config.fail_fast && errors > 0 && meta_config.shard_output.empty()) {
+    return lanelet::autoware::validation::fail_fast_exit_code;
+  }
+  return 0;
+}
+
+json load_requirements(
+  const lanelet::autoware::validation::MetaConfig & meta_config, const std::string & option)
+{
+  if (meta_config.requirements_file.empty()) {
+    throw std::invalid_argument(option + " requires an input requirements file (-i)");
+  }
+  if (!std::filesystem::is_regular_file(meta_config.requirements_file)) {
+    throw std::invalid_argument("Input JSON file doesn't exist or is not a file!");
+  }
+  std::ifstream input_file(meta_config.requirements_file);
+  json json_data;
+  input_file >> json_data;
+  return json_data;
+}
+
+// The validators run by -i or -v
+std::vector<std::string> selected_validators(
+  const lanelet::autoware::validation::MetaConfig & meta_config)
+{
+  if (meta_config.requirements_file.empty()) {
+    return lanelet::validation::availabeChecks(  // cspell:disable-line
+      meta_config.command_line_config.validationConfig.checksFilter);
+  }
+  std::vector<std::string> validator_names;
+  for (const auto & [name, info] : lanelet::autoware::validation::parse_validators(
+         load_requirements(meta_config, "--input_requirements"))) {
+    validator_names.push_back(name);
+  }
+  return validator_names;
+}
+
+std::unique_ptr<lanelet::autoware::validation::ResultsWriter> open_results_writer(
+  const lanelet::autoware::validation::MetaConfig & meta_config)
+{
+  if (meta_config.output_file_path.empty()) {
+    return nullptr;
+  }
+  return std::make_unique<lanelet::autoware::validation::ResultsWriter>(
+    meta_config.output_file_path,
+    lanelet::autoware::validation::parse_results_format(meta_config.output_format));
+}
+
+lanelet::autoware::validation::ValidatorExclusionMap load_exclusion_map(
+  const lanelet::autoware::validation::MetaConfig & meta_config)
+{
+  lanelet::autoware::validation::ValidatorExclusionMap exclusion_map;
+  if (!meta_config.exclusion_list.empty()) {
+    if (!std::filesystem::is_regular_file(meta_config.exclusion_list)) {
+      throw std::invalid_argument("Exclusion list doesn't exist or is not a file!");
+    }
+    std::ifstream exclusion_list(meta_config.exclusion_list);
+    json exclusion_list_json;
+    exclusion_list >> exclusion_list_json;
+
+    exclusion_map = lanelet::autoware::validation::import_exclusion_list(exclusion_list_json);
+  } else {
+    for (const std::string & validator_name :
+         lanelet::validation::availabeChecks(".*")) {  // cspell:disable-line
+      exclusion_map[validator_name] = std::vector<lanelet::autoware::validation::SimplePrimitive>();
+    }
+  }
+  return exclusion_map;
+}
+
+// Summarize the merged results of --shards or --streaming and write them with the additional
+// validation_info fields, and return the exit code
+int finish_merged_validation(
+  json & json_data, const lanelet::autoware::validation::MetaConfig & meta_config,
+  lanelet::autoware::validation::ResultsWriter * results_writer, const json & validation_info)
+{
+  lanelet::autoware::validation::summarize_validator_results(json_data);
+
+  // The map is not loaded as a whole in these modes
+  lanelet::autoware::validation::stream_validator_info_to_map(
+    meta_config.command_line_config.mapFile,
+    std::filesystem::path(meta_config.requirements_file).filename().string(),
+    json_data.value("version", ""));
+
+  if (results_writer) {
+    lanelet::autoware::validation::ProgressPhase write_results_phase("write_results");
+    lanelet::autoware::validation::insert_validation_info_to_json(json_data, meta_config);
+    json_data["validation_info"].update(validation_info);
+    results_writer->finish(json_data);
+    write_results_phase.finish({{"output_file", results_writer->output_file().string()}});
+    std::cout << "Results are output to " << results_writer->output_file() << std::endl;
+  }
+  return exit_code(meta_config, report_run_finished(json_data));
+}
+
+// Validate the map in worker processes of --shards and write the merged results
+int run_sharded_validation(
+  int argc, char * argv[], const lanelet::autoware::validation::MetaConfig & meta_config)
+{
+  json json_data = load_requirements(meta_config, "--shards");
+  const auto results_writer = open_results_writer(meta_config);
+
+  lanelet::autoware::validation::report_progress(
+    "run_started", {{"map_file", meta_config.command_line_config.mapFile},
+                    {"shards", meta_config.shards}});
+
+  lanelet::autoware::validation::ProgressPhase validation_phase("validation");
+  const std::vector<json> shard_results = lanelet::autoware::validation::run_shard_workers(
+    argc, const_cast<const char **>(argv), meta_config.shards);  // NOLINT
+  lanelet::autoware::validation::merge_shard_results(json_data, shard_results);
+  validation_phase.finish({{"shards", meta_config.shards}});
+
+  return finish_merged_validation(
+    json_data, meta_config, results_writer.get(), {{"shards", meta_config.shards}});
+}
+
+// Validate the map tile by tile without loading it as a whole and write the merged results
+int run_streaming_validation(const lanelet::autoware::validation::MetaConfig & meta_config)
+{
+  json json_data = load_requirements(meta_config, "--streaming");
+  const auto results_writer = open_results_writer(meta_config);
+  const auto exclusion_map = load_exclusion_map(meta_config);
+  const auto validator_config = lanelet::autoware::validation::ValidatorConfigStore::initialize(
+    meta_config.parameters_file, "", meta_config.language);
+
+  lanelet::autoware::validation::report_progress(
+    "run_started", {{"map_file", meta_config.command_line_config.mapFile},
+                    {"jobs", lanelet::autoware::validation::parallel_jobs()}});
+
+  lanelet::autoware::validation::ProgressPhase index_map_phase("index_map");
+  const lanelet::autoware::validation::OsmTileIndex index(
+    meta_config.command_line_config.mapFile, meta_config.tile_size);
+  index_map_phase.finish({{"elements", index.element_count()}, {"tiles", index.tiles().size()}});
+
+  lanelet::autoware::validation::ProgressPhase validation_phase("validation");
+  const auto results = lanelet::autoware::validation::validate_tiles(
+    index, json_data, meta_config, exclusion_map, validator_config,
+    meta_config.tile_cache_mb * 1024 * 1024);
+  lanelet::autoware::validation::merge_shard_results(json_data, results.tile_results);
+  lanelet::autoware::validation::mark_global_context_validators(json_data, *validator_config);
+  validation_phase.finish();
+
+  if (!results.loading_issues.empty()) {
+    std::cout << "Errors found on map loading." << std::endl;
+    lanelet::validation::printAllIssues({{"loading", results.loading_issues}});
+  }
+
+  return finish_merged_validation(
+    json_data, meta_config, results_writer.get(),
+    {{"streaming",
+      {{"tiles", results.tile_results.size()}, {"tile_size", meta_config.tile_size}}}});
+}
+}  // namespace
+
 int main(int argc, char * argv[])
 {
   lanelet::autoware::validation::MetaConfig meta_config =
@@ -56,6 +263,24 @@ int main(int argc, char * argv[])
     return 0;
   }
 
+  // A worker process of --shards writes its results for the coordinator process to merge, and
+  // shares the hardware threads with the other workers
+  const bool is_shard_worker = !meta_config.shard_output.empty();
+  if (is_shard_worker) {
+    meta_config.output_file_path = meta_config.shard_output;
+    meta_config.output_format = "json";
+    meta_config.progress.clear();
+    if (meta_config.jobs == 0) {
+      meta_config.jobs = std::max<size_t>(
+        1, std::thread::hardware_concurrency() / std::max<size_t>(1, meta_config.shards));
+    }
+  }
+
+  lanelet::autoware::validation::set_parallel_jobs(meta_config.jobs);
+  if (!meta_config.progress.empty()) {
+    lanelet::autoware::validation::open_progress_stream(meta_config.progress);
+  }
+
   // Check map file
   if (meta_config.command_line_config.mapFile.empty()) {
     throw std::invalid_argument("No map file specified!");
@@ -64,10 +289,70 @@ int main(int argc, char * argv[])
     throw std::invalid_argument("Map file doesn't exist or is not a file!");
   }
 
+  // Check the region of interest before spending time on loading the map
+  std::optional<lanelet::BoundingBox2d> roi_bounding_box;
+  if (!meta_config.roi.empty()) {
+    roi_bounding_box = lanelet::autoware::validation::parse_roi_bounding_box(meta_config.roi);
+  }
+  const std::vector<lanelet::Id> roi_ids =
+    lanelet::autoware::validation::parse_roi_ids(meta_config.roi_ids);
+
+  if (meta_config.shards == 0) {
+    throw std::invalid_argument("The number of shards must be at least 1!");
+  }
+  if (meta_config.shards > 1 && (roi_bounding_box || !roi_ids.empty())) {
+    throw std::invalid_argument("--shards cannot be combined with --roi or --roi_ids!");
+  }
+  if (meta_config.streaming && (meta_config.shards > 1 || roi_bounding_box || !roi_ids.empty())) {
+    throw std::invalid_argument(
+      "--streaming cannot be combined with --shards, --roi or --roi_ids!");
+  }
+  if (meta_config.issue_geometry && (meta_config.shards > 1 || meta_config.streaming)) {
+    throw std::invalid_argument(
+      "--issue_geometry cannot be combined with --shards or --streaming!");
+  }
+  if (meta_config.issue_geometry && meta_config.requirements_file.empty()) {
+    throw std::invalid_argument("--issue_geometry requires an input requirements file (-i)");
+  }
+  if (meta_config.shards > 1 && !is_shard_worker) {
+    const int sharded_exit_code = run_sharded_validation(argc, argv, meta_config);
+    lanelet::autoware::validation::close_progress_stream();
+    return sharded_exit_code;
+  }
+  if (meta_config.streaming) {
+    const int streaming_exit_code = run_streaming_validation(meta_config);
+    lanelet::autoware::validation::close_progress_stream();
+    return streaming_exit_code;
+  }
+
+  lanelet::autoware::validation::report_progress(
+    "run_started", {{"map_file", meta_config.command_line_config.mapFile},
+                    {"jobs", lanelet::autoware::validation::parallel_jobs()}});
+
+  // Load parameters and issues_info files
+  std::string parameters_file =
+    (!meta_config.parameters_file.empty()) ? meta_config.parameters_file : "";
+  // Currently, an empty string means "use the config/issues_info.json"
+  std::string issues_info_file = "";
+  auto validator_config = lanelet::autoware::validation::ValidatorConfigStore::initialize(
+    parameters_file, issues_info_file, meta_config.language);
+
+  // Load only the layers that the selected validators need. The whole map is loaded for --roi_ids
+  // since the IDs may belong to any layer.
+  std::optional<lanelet::autoware::validation::MapLayers> map_layers;
+  if (roi_ids.empty()) {
+    map_layers = lanelet::autoware::validation::required_map_layers(
+      *validator_config, selected_validators(meta_config));
+  }
+
   // Load map and catch loading_issues
+  lanelet::autoware::validation::ProgressPhase load_map_phase("load_map");
   const auto [lanelet_map_ptr, loading_issues] = lanelet::autoware::validation::loadAndValidateMap(
     meta_config.projector_type, meta_config.command_line_config.mapFile,
-    meta_config.command_line_config.validationConfig);
+    meta_config.command_line_config.validationConfig, map_layers);
+  load_map_phase.finish(
+    {{"loaded", lanelet_map_ptr != nullptr},
+     {"layers", map_layers ? json(map_layers->names()) : json("all")}});
 
   if (!loading_issues[0].issues.empty()) {
     std::cout << "Errors found on map loading." << std::endl;
@@ -75,32 +360,22 @@ int main(int argc, char * argv[])
   }
 
   // Load exclusion list
-  lanelet::autoware::validation::ValidatorExclusionMap exclusion_map;
-  if (!meta_config.exclusion_list.empty()) {
-    if (!std::filesystem::is_regular_file(meta_config.exclusion_list)) {
-      throw std::invalid_argument("Exclusion list doesn't exist or is not a file!");
-    }
-    std::ifstream exclusion_list(meta_config.exclusion_list);
-    json exclusion_list_json;
-    exclusion_list >> exclusion_list_json;
+  const auto exclusion_map = load_exclusion_map(meta_config);
 
-    exclusion_map = lanelet::autoware::validation::import_exclusion_list(exclusion_list_json);
-  } else {
-    for (const std::string & validator_name :
-         lanelet::validation::availabeChecks(".*")) {  // cspell:disable-line
-      exclusion_map[validator_name] = std::vector<lanelet::autoware::validation::SimplePrimitive>();
-    }
+  // Restrict the validators to the region of interest
+  auto validation_context = std::make_shared<lanelet::autoware::validation::ValidationContext>();
+  if (lanelet_map_ptr && (roi_bounding_box || !roi_ids.empty())) {
+    validation_context->region_of_interest =
+      lanelet::autoware::validation::RegionOfInterest::create(
+        *lanelet_map_ptr, roi_bounding_box, roi_ids);
+  } else if (lanelet_map_ptr && is_shard_worker) {
+    validation_context->region_of_interest =
+      lanelet::autoware::validation::RegionOfInterest::create_shard(
+        *lanelet_map_ptr, meta_config.shard_index, meta_config.shards);
   }
 
-  // Load parameters and issues_info files
-  std::string parameters_file =
-    (!meta_config.parameters_file.empty()) ? meta_config.parameters_file : "";
-  // Currently, an empty string means "use the config/issues_info.json"
-  std::string issues_info_file = "";
-  lanelet::autoware::validation::ValidatorConfigStore::initialize(
-    parameters_file, issues_info_file, meta_config.language);
-
   // Validation against lanelet::LaneletMap object
+  int run_exit_code = 0;
   if (!lanelet_map_ptr) {
     throw std::invalid_argument("The map file was not possible to load!");
   } else if (!meta_config.requirements_file.empty()) {
@@ -111,31 +386,119 @@ int main(int argc, char * argv[])
     json json_data;
     input_file >> json_data;
 
+    // Issues are written to the results file as each validator finishes
+    std::unique_ptr<lanelet::autoware::validation::ResultsWriter> results_writer;
+    if (!meta_config.output_file_path.empty()) {
+      results_writer = std::make_unique<lanelet::autoware::validation::ResultsWriter>(
+        meta_config.output_file_path,
+        lanelet::autoware::validation::parse_results_format(meta_config.output_format));
+    }
+
+    // Issues get the position of their primitive and are indexed by tile for viewers
+    std::shared_ptr<lanelet::autoware::validation::IssueLocator> issue_locator;
+    if (meta_config.issue_geometry) {
+      issue_locator = std::make_shared<lanelet::autoware::validation::IssueLocator>(
+        *lanelet_map_ptr, meta_config.issue_tile_size);
+      validation_context->issue_locator = issue_locator;
+    }
+
+    // The validators measured in previous runs are started longest first
+    std::optional<lanelet::autoware::validation::TimingProfile> timing_profile;
+    if (!meta_config.timing_profile.empty()) {
+      timing_profile =
+        lanelet::autoware::validation::TimingProfile::load(meta_config.timing_profile);
+    }
+
+    lanelet::autoware::validation::ProgressPhase validation_phase("validation");
     const auto mapping_issues = lanelet::autoware::validation::validate_all_requirements(
-      json_data, meta_config, *lanelet_map_ptr, exclusion_map);
+      json_data, meta_config, *lanelet_map_ptr, exclusion_map, validator_config,
+      validation_context, results_writer.get(), timing_profile ? &*timing_profile : nullptr);
+    validation_phase.finish();
 
-    lanelet::autoware::validation::summarize_validator_results(json_data);
-    lanelet::validation::printAllIssues(mapping_issues);
+    // The worker processes of --shards only validate a part of the map
+    if (timing_profile && !is_shard_worker) {
+      timing_profile->save(meta_config.timing_profile);
+    }
 
-    lanelet::autoware::validation::insert_validator_info_to_map(
-      meta_config.command_line_config.mapFile,
-      std::filesystem::path(meta_config.requirements_file).filename().string(),
-      json_data.value("version", ""));
+    // With a results file, the issues are only written there and the validators only kept their
+    // numbers
+    lanelet::autoware::validation::IssueCounts issue_counts =
+      lanelet::autoware::validation::count_issues(mapping_issues);
+    if (results_writer) {
+      issue_counts += results_writer->issue_counts();
+    }
+    lanelet::autoware::validation::summarize_validator_results(json_data, issue_counts);
+    if (!results_writer) {
+      lanelet::validation::printAllIssues(mapping_issues);
+    }
+
+    // The map file is updated once by the coordinator process of --shards
+    if (!is_shard_worker) {
+      lanelet::autoware::validation::insert_validator_info_to_map(
+        meta_config.command_line_config.mapFile,
+        std::filesystem::path(meta_config.requirements_file).filename().string(),
+        json_data.value("version", ""));
+    }
 
     if (!meta_config.output_file_path.empty()) {
+      lanelet::autoware::validation::ProgressPhase write_results_phase("write_results");
       lanelet::autoware::validation::insert_validation_info_to_json(json_data, meta_config);
-      lanelet::autoware::validation::export_results(json_data, meta_config.output_file_path);
+      if (validation_context->region_of_interest) {
+        json_data["validation_info"]["region_of_interest"] =
+          validation_context->region_of_interest->to_json();
+      }
+      results_writer->finish(json_data);
+      write_results_phase.finish({{"output_file", results_writer->output_file().string()}});
+      std::cout << "Results are output to " << results_writer->output_file() << std::endl;
+      if (issue_locator) {
+        const std::filesystem::path index_file =
+          results_writer->output_file().parent_path() /
+          lanelet::autoware::validation::issue_index_file_name;
+        issue_locator->write_index(index_file);
+        std::cout << "Issue index is output to " << index_file << std::endl;
+      }
     }
+    run_exit_code = exit_code(meta_config, report_run_finished(issue_counts));
   } else {
+    lanelet::autoware::validation::ProgressPhase validation_phase("validation");
+    // Without requirements all validators run at once, so only the global deadline applies
+    validation_context->deadline = lanelet::autoware::validation::global_deadline(meta_config);
+    // Every issue code belongs to a single validator, so one cap for all of them still caps each
+    // validator. --stop_at_issue_cap is not applied since it would stop the other validators too.
+    std::shared_ptr<lanelet::autoware::validation::IssueCap> issue_cap;
+    if (meta_config.max_issues_per_code > 0) {
+      issue_cap =
+        std::make_shared<lanelet::autoware::validation::IssueCap>(meta_config.max_issues_per_code);
+      validation_context->issue_cap = issue_cap;
+    }
+    // The issues are filtered by the exclusion lists of all validators below
+    if (meta_config.fail_fast) {
+      std::vector<lanelet::autoware::validation::SimplePrimitive> excluded_primitives;
+      for (const auto & [validator_name, primitives] : exclusion_map) {
+        excluded_primitives.insert(
+          excluded_primitives.end(), primitives.begin(), primitives.end());
+      }
+      validation_context->fail_fast =
+        std::make_shared<lanelet::autoware::validation::FailFast>(excluded_primitives);
+    }
     auto issues = lanelet::autoware::validation::apply_validation(
-      *lanelet_map_ptr, meta_config.command_line_config.validationConfig);
+      *lanelet_map_ptr, meta_config.command_line_config.validationConfig, validator_config,
+      validation_context);
+    validation_phase.finish();
     for (const std::string & validator_name :
          lanelet::validation::availabeChecks(".*")) {  // cspell:disable-line
       lanelet::autoware::validation::filter_out_primitives(
         issues, exclusion_map.at(validator_name));
     }
+    if (issue_cap && issue_cap->suppressed_count() > 0) {
+      issues.push_back({"suppressed_issues", issue_cap->summary_issues()});
+    }
     lanelet::validation::printAllIssues(issues);
+    run_exit_code = exit_code(
+      meta_config, report_run_finished(lanelet::autoware::validation::count_issues(issues)));
   }
 
-  return 0;
+  lanelet::autoware::validation::close_progress_stream();
+
+  return run_exit_code;
 }
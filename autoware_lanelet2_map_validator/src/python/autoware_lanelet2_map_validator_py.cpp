@@ -0,0 +1,296 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Python bindings of ValidationSession. The results are exposed as NumPy arrays that share the
+// memory of the C++ objects, so that a viewer can look up issues and draw the map without parsing
+// the results file and the map again.
+
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/issue_message.hpp"
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/session.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+
+#include <nlohmann/json.hpp>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_validation/Validation.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace lanelet::autoware::validation
+{
+namespace
+{
+/**
+ * @brief The issues of a validation as columns, one row per issue
+ */
+struct IssueTable
+{
+  std::vector<int64_t> ids;
+  std::vector<uint8_t> severities;  //<! lanelet::validation::Severity
+  std::vector<uint8_t> primitives;  //<! lanelet::validation::Primitive
+  std::vector<double> positions;    //<! x, y of the center of the primitive, NaN if not in the map
+  std::vector<double> bounding_boxes;  //<! min_x, min_y, max_x, max_y, NaN if not in the map
+  std::vector<std::string> validators;
+  std::vector<std::string> issue_codes;  //<! Empty for issues without an issue code
+  std::vector<std::string> messages;
+};
+
+/**
+ * @brief The linestrings (or polygons) of a layer in CSR layout. The points of the i-th
+ * linestring are coordinates[offsets[i]] to coordinates[offsets[i + 1] - 1].
+ */
+struct LineStringTable
+{
+  std::vector<int64_t> ids;
+  std::vector<int64_t> offsets;
+  std::vector<double> coordinates;  //<! x, y
+};
+
+struct PyValidationResults
+{
+  std::string json;
+  bool passed = false;
+  size_t errors = 0;
+  size_t warnings = 0;
+  std::shared_ptr<IssueTable> issues;
+};
+
+std::shared_ptr<IssueTable> create_issue_table(
+  const lanelet::LaneletMap & map, const std::vector<lanelet::validation::DetectedIssues> & issues)
+{
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  auto table = std::make_shared<IssueTable>();
+  for (const auto & detected_issues : issues) {
+    for (const auto & issue : detected_issues.issues) {
+      const IssueMessage message = split_issue_message(issue.message);
+      table->ids.push_back(issue.id);
+      table->severities.push_back(static_cast<uint8_t>(issue.severity));
+      table->primitives.push_back(static_cast<uint8_t>(issue.primitive));
+      table->validators.push_back(detected_issues.checkName);
+      table->issue_codes.push_back(message.issue_code);
+      table->messages.push_back(message.text);
+
+      const auto box = issue_bounding_box(map, issue);
+      const std::array<double, 4> corners =
+        box ? std::array<double, 4>{box->min().x(), box->min().y(), box->max().x(), box->max().y()}
+            : std::array<double, 4>{nan, nan, nan, nan};
+      table->bounding_boxes.insert(table->bounding_boxes.end(), corners.begin(), corners.end());
+      table->positions.push_back((corners[0] + corners[2]) / 2.0);
+      table->positions.push_back((corners[1] + corners[3]) / 2.0);
+    }
+  }
+  return table;
+}
+
+template <typename Layer>
+std::shared_ptr<LineStringTable> create_linestring_table(const Layer & layer)
+{
+  auto table = std::make_shared<LineStringTable>();
+  table->offsets.push_back(0);
+  for (const auto & linestring : layer) {
+    table->ids.push_back(linestring.id());
+    for (const auto & point : linestring) {
+      table->coordinates.push_back(point.x());
+      table->coordinates.push_back(point.y());
+    }
+    table->offsets.push_back(static_cast<int64_t>(table->coordinates.size() / 2));
+  }
+  return table;
+}
+
+/**
+ * @brief A read-only NumPy view of values with the given number of columns, kept alive by owner
+ */
+template <typename T>
+py::array_t<T> view(const std::vector<T> & values, const size_t columns, const py::object & owner)
+{
+  const auto rows = static_cast<py::ssize_t>(values.size() / columns);
+  py::array_t<T> array =
+    columns == 1
+      ? py::array_t<T>({rows}, {static_cast<py::ssize_t>(sizeof(T))}, values.data(), owner)
+      : py::array_t<T>(
+          {rows, static_cast<py::ssize_t>(columns)},
+          {static_cast<py::ssize_t>(columns * sizeof(T)), static_cast<py::ssize_t>(sizeof(T))},
+          values.data(), owner);
+  array.attr("setflags")(py::arg("write") = false);
+  return array;
+}
+
+PyValidationResults validate(
+  ValidationSession & session, const std::string & requirements,
+  const std::optional<std::array<double, 4>> & roi)
+{
+  std::shared_ptr<const RegionOfInterest> region_of_interest;
+  if (roi) {
+    region_of_interest = RegionOfInterest::create(
+      session.map(),
+      lanelet::BoundingBox2d(
+        lanelet::BasicPoint2d((*roi)[0], (*roi)[1]), lanelet::BasicPoint2d((*roi)[2], (*roi)[3])),
+      {});
+  }
+  const ValidationResults results =
+    session.validate(nlohmann::json::parse(requirements), region_of_interest);
+
+  PyValidationResults py_results;
+  py_results.json = results.json_data.dump();
+  py_results.passed = results.passed();
+  py_results.errors = results.errors;
+  py_results.warnings = results.warnings;
+  py_results.issues = create_issue_table(session.map(), results.issues);
+  return py_results;
+}
+}  // namespace
+}  // namespace lanelet::autoware::validation
+
+PYBIND11_MODULE(autoware_lanelet2_map_validator_py, m)
+{
+  using lanelet::autoware::validation::IssueTable;
+  using lanelet::autoware::validation::LineStringTable;
+  using lanelet::autoware::validation::PyValidationResults;
+  using lanelet::autoware::validation::ValidationSession;
+  using lanelet::autoware::validation::view;
+
+  m.doc() = "In-process validation of lanelet2 maps with autoware_lanelet2_map_validator";
+
+  py::enum_<lanelet::validation::Severity>(m, "Severity")
+    .value("Error", lanelet::validation::Severity::Error)
+    .value("Warning", lanelet::validation::Severity::Warning)
+    .value("Info", lanelet::validation::Severity::Info);
+
+  py::enum_<lanelet::validation::Primitive>(m, "Primitive")
+    .value("Point", lanelet::validation::Primitive::Point)
+    .value("LineString", lanelet::validation::Primitive::LineString)
+    .value("Polygon", lanelet::validation::Primitive::Polygon)
+    .value("Lanelet", lanelet::validation::Primitive::Lanelet)
+    .value("Area", lanelet::validation::Primitive::Area)
+    .value("RegulatoryElement", lanelet::validation::Primitive::RegulatoryElement)
+    .value("Primitive", lanelet::validation::Primitive::Primitive);
+
+  m.def(
+    "available_validators",
+    [](const std::string & filter) {
+      return lanelet::validation::availabeChecks(filter);  // cspell:disable-line
+    },
+    py::arg("filter") = ".*", "Names of the validators matching the regular expression");
+
+  py::class_<IssueTable, std::shared_ptr<IssueTable>>(m, "IssueTable")
+    .def("__len__", [](const IssueTable & table) { return table.ids.size(); })
+    .def_property_readonly(
+      "ids", [](py::object self) { return view(self.cast<const IssueTable &>().ids, 1, self); })
+    .def_property_readonly(
+      "severities",
+      [](py::object self) { return view(self.cast<const IssueTable &>().severities, 1, self); })
+    .def_property_readonly(
+      "primitives",
+      [](py::object self) { return view(self.cast<const IssueTable &>().primitives, 1, self); })
+    .def_property_readonly(
+      "positions",
+      [](py::object self) { return view(self.cast<const IssueTable &>().positions, 2, self); })
+    .def_property_readonly(
+      "bounding_boxes",
+      [](py::object self) {
+        return view(self.cast<const IssueTable &>().bounding_boxes, 4, self);
+      })
+    .def_readonly("validators", &IssueTable::validators)
+    .def_readonly("issue_codes", &IssueTable::issue_codes)
+    .def_readonly("messages", &IssueTable::messages);
+
+  py::class_<LineStringTable, std::shared_ptr<LineStringTable>>(m, "LineStringTable")
+    .def("__len__", [](const LineStringTable & table) { return table.ids.size(); })
+    .def_property_readonly(
+      "ids",
+      [](py::object self) { return view(self.cast<const LineStringTable &>().ids, 1, self); })
+    .def_property_readonly(
+      "offsets",
+      [](py::object self) { return view(self.cast<const LineStringTable &>().offsets, 1, self); })
+    .def_property_readonly("coordinates", [](py::object self) {
+      return view(self.cast<const LineStringTable &>().coordinates, 2, self);
+    });
+
+  py::class_<PyValidationResults>(m, "ValidationResults")
+    .def_readonly("json", &PyValidationResults::json)
+    .def_readonly("passed", &PyValidationResults::passed)
+    .def_readonly("errors", &PyValidationResults::errors)
+    .def_readonly("warnings", &PyValidationResults::warnings)
+    .def_readonly("issues", &PyValidationResults::issues);
+
+  py::class_<ValidationSession>(m, "ValidationSession")
+    .def_static(
+      "load",
+      [](
+        const std::string & map_file, const std::string & projector_type, const double origin_lat,
+        const double origin_lon, const std::string & parameters_file, const std::string & language,
+        const size_t validator_jobs) {
+        lanelet::autoware::validation::MetaConfig meta_config;
+        meta_config.projector_type = projector_type;
+        meta_config.command_line_config.validationConfig.origin.lat = origin_lat;
+        meta_config.command_line_config.validationConfig.origin.lon = origin_lon;
+        meta_config.language = language;
+        meta_config.validator_jobs = validator_jobs;
+        return ValidationSession::load(
+          map_file,
+          lanelet::autoware::validation::ValidatorConfig::load(parameters_file, "", language),
+          meta_config);
+      },
+      py::arg("map_file"), py::arg("projector_type") = "mgrs", py::arg("origin_lat") = 0.0,
+      py::arg("origin_lon") = 0.0, py::arg("parameters_file") = "", py::arg("language") = "en",
+      py::arg("validator_jobs") = 1, py::call_guard<py::gil_scoped_release>(),
+      "Load the map and the parameters (the default parameters if parameters_file is empty)")
+    .def(
+      "set_exclusion_list",
+      [](ValidationSession & session, const std::string & exclusion_list) {
+        session.set_exclusion_map(lanelet::autoware::validation::import_exclusion_list(
+          nlohmann::json::parse(exclusion_list)));
+      },
+      py::arg("exclusion_list"), "Use the contents of an exclusion list file for the next calls")
+    .def(
+      "validate", &lanelet::autoware::validation::validate, py::arg("requirements"),
+      py::arg("roi") = std::nullopt, py::call_guard<py::gil_scoped_release>(),
+      "Run the validators of the contents of a requirements file, only around the bounding box "
+      "roi = (min_x, min_y, max_x, max_y) if it is given")
+    .def_property_readonly(
+      "loading_issues",
+      [](const ValidationSession & session) {
+        return lanelet::autoware::validation::create_issue_table(
+          session.map(), session.loading_issues());
+      })
+    .def(
+      "linestrings",
+      [](const ValidationSession & session) {
+        return lanelet::autoware::validation::create_linestring_table(
+          session.map().lineStringLayer);
+      },
+      "The linestrings of the map for drawing")
+    .def(
+      "polygons",
+      [](const ValidationSession & session) {
+        return lanelet::autoware::validation::create_linestring_table(session.map().polygonLayer);
+      },
+      "The polygons of the map for drawing");
+}
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/area/buffer_zone_validity.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <boost/geometry/algorithms/area.hpp>
@@ -54,7 +55,10 @@ lanelet::validation::Issues BufferZoneValidity::check_buffer_zone_validity(
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & polygon : map.polygonLayer) {
+  for (const auto & polygon : primitives_in_roi(map.polygonLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !polygon.hasAttribute(lanelet::AttributeName::Type) ||
       polygon.attribute(lanelet::AttributeName::Type).value() != "hatched_road_markings") {
@@ -101,8 +105,7 @@ lanelet::validation::Issues BufferZoneValidity::check_buffer_zone_validity(
               std::map<std::string, std::string> overlap_map;
               overlap_map["lanelet_id"] = std::to_string(ll.id());
               overlap_map["lanelet_subtype"] = subtype;
-              issues.emplace_back(
-                construct_issue_from_code(issue_code(this->name(), 3), polygon.id(), overlap_map));
+              add_issue_from_code(issues, issue_code(this->name(), 3), polygon.id(), overlap_map);
             }
           }
         }
@@ -129,8 +132,7 @@ lanelet::validation::Issues BufferZoneValidity::check_buffer_zone_validity(
       }
 
       point_ids_map["point_ids"] = ids_stream.str();
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 1), polygon.id(), point_ids_map));
+      add_issue_from_code(issues, issue_code(this->name(), 1), polygon.id(), point_ids_map);
     }
 
     // Issue-002
@@ -142,8 +144,7 @@ lanelet::validation::Issues BufferZoneValidity::check_buffer_zone_validity(
       std::map<std::string, std::string> reason_map;
       reason_map["boost_geometry_message"] =
         boost::geometry::validity_failure_type_message(failure_type);
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 2), polygon.id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 2), polygon.id(), reason_map);
     }
   }
 
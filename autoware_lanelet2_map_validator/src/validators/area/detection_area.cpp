@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/area/detection_area.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -43,7 +44,10 @@ lanelet::validation::Issues DetectionAreaValidator::check_detection_area(
   lanelet::validation::Issues issues;
 
   std::set<lanelet::Id> detection_area_polygon_ids;
-  for (const auto & polygon : map.polygonLayer) {
+  for (const auto & polygon : primitives_in_roi(map.polygonLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       polygon.hasAttribute(lanelet::AttributeName::Type) &&
       polygon.attribute(lanelet::AttributeName::Type) == "detection_area") {
@@ -53,7 +57,10 @@ lanelet::validation::Issues DetectionAreaValidator::check_detection_area(
 
   std::set<lanelet::Id> referenced_detection_area_polygon_ids;
 
-  for (const auto & reg_elem : map.regulatoryElementLayer) {
+  for (const auto & reg_elem : primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       reg_elem->hasAttribute(lanelet::AttributeName::Subtype) &&
       reg_elem->attribute(lanelet::AttributeName::Subtype) == "detection_area") {
@@ -68,7 +75,7 @@ lanelet::validation::Issues DetectionAreaValidator::check_detection_area(
             referenced_detection_area_polygon_ids.insert(poly.id());
           }
         }
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 2), reg_elem->id());
         continue;
       }
 
@@ -77,7 +84,7 @@ lanelet::validation::Issues DetectionAreaValidator::check_detection_area(
       if (
         !polygon.hasAttribute(lanelet::AttributeName::Type) ||
         polygon.attribute(lanelet::AttributeName::Type) != "detection_area") {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 3), reg_elem->id());
         continue;
       }
 
@@ -90,14 +97,14 @@ lanelet::validation::Issues DetectionAreaValidator::check_detection_area(
         ref_lines.size() != 1 || !ref_lines[0].hasAttribute(lanelet::AttributeName::Type) ||
         ref_lines[0].attribute(lanelet::AttributeName::Type) !=
           lanelet::AttributeValueString::StopLine) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 4), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 4), reg_elem->id());
         continue;
       }
 
       // Issue-005: Regulatory element should be referred by at least one lanelet
       const auto referrers = map.laneletLayer.findUsages(reg_elem);
       if (referrers.empty()) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 5), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 5), reg_elem->id());
       }
 
       // Issue-006: Check if there are non-road referrers (should only be referred by road lanelets)
@@ -108,11 +115,15 @@ lanelet::validation::Issues DetectionAreaValidator::check_detection_area(
                  lane.attribute(lanelet::AttributeName::Subtype) !=
                    lanelet::AttributeValueString::Road;
         })) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 6), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 6), reg_elem->id());
       }
     }
   }
 
+  if (validation_cancelled()) {
+    return issues;
+  }
+
   // Issue-001: Find detection_area polygons not referred by any regulatory element
   std::set<lanelet::Id> unreferenced_detection_areas;
   std::set_difference(
@@ -121,7 +132,7 @@ lanelet::validation::Issues DetectionAreaValidator::check_detection_area(
     std::inserter(unreferenced_detection_areas, unreferenced_detection_areas.begin()));
 
   for (const auto & polygon_id : unreferenced_detection_areas) {
-    issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), polygon_id));
+    add_issue_from_code(issues, issue_code(this->name(), 1), polygon_id);
   }
 
   return issues;
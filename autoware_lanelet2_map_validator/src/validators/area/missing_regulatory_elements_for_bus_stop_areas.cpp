@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/area/missing_regulatory_elements_for_bus_stop_areas.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <autoware_lanelet2_extension/regulatory_elements/bus_stop_area.hpp>
@@ -51,7 +52,10 @@ MissingRegulatoryElementsForBusStopAreas::check_missing_regulatory_elements_for_
 
   std::set<lanelet::Id> bus_stop_area_polygon_ids;
 
-  for (const auto & polygon : map.polygonLayer) {
+  for (const auto & polygon : primitives_in_roi(map.polygonLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       polygon.hasAttribute(lanelet::AttributeName::Type) &&
       polygon.attribute(lanelet::AttributeName::Type) == lanelet::autoware::BusStopArea::RuleName) {
@@ -59,8 +63,9 @@ MissingRegulatoryElementsForBusStopAreas::check_missing_regulatory_elements_for_
     }
   }
 
+  const auto reg_elems = primitives_in_roi(map.regulatoryElementLayer, name());
   auto reg_elem_with_bus_stop_polygon =
-    map.regulatoryElementLayer | ranges::views::filter([](auto && elem) {
+    reg_elems | ranges::views::filter([](auto && elem) {
       const auto & attrs = elem->attributes();
       const auto & it = attrs.find(lanelet::AttributeName::Subtype);
       return it != attrs.end() && it->second == lanelet::autoware::BusStopArea::RuleName;
@@ -78,6 +83,10 @@ MissingRegulatoryElementsForBusStopAreas::check_missing_regulatory_elements_for_
     }
   }
 
+  if (validation_cancelled()) {
+    return issues;
+  }
+
   std::set<lanelet::Id> unreferenced_bus_stop_areas;
   std::set_difference(
     bus_stop_area_polygon_ids.begin(), bus_stop_area_polygon_ids.end(),
@@ -85,7 +94,7 @@ MissingRegulatoryElementsForBusStopAreas::check_missing_regulatory_elements_for_
     std::inserter(unreferenced_bus_stop_areas, unreferenced_bus_stop_areas.begin()));
 
   for (const auto & bus_stop_area_id : unreferenced_bus_stop_areas) {
-    issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), bus_stop_area_id));
+    add_issue_from_code(issues, issue_code(this->name(), 1), bus_stop_area_id);
   }
 
   return issues;
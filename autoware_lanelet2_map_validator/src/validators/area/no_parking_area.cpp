@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/area/no_parking_area.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -44,7 +45,10 @@ lanelet::validation::Issues NoParkingAreaValidator::check_no_parking_area(
   lanelet::validation::Issues issues;
 
   std::set<lanelet::Id> no_parking_area_polygon_ids;
-  for (const auto & polygon : map.polygonLayer) {
+  for (const auto & polygon : primitives_in_roi(map.polygonLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       polygon.hasAttribute(lanelet::AttributeName::Type) &&
       polygon.attribute(lanelet::AttributeName::Type) == "no_parking_area") {
@@ -54,7 +58,10 @@ lanelet::validation::Issues NoParkingAreaValidator::check_no_parking_area(
 
   std::set<lanelet::Id> referenced_no_parking_area_polygon_ids;
 
-  for (const auto & reg_elem : map.regulatoryElementLayer) {
+  for (const auto & reg_elem : primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       reg_elem->hasAttribute(lanelet::AttributeName::Subtype) &&
       reg_elem->attribute(lanelet::AttributeName::Subtype) == "no_parking_area") {
@@ -69,7 +76,7 @@ lanelet::validation::Issues NoParkingAreaValidator::check_no_parking_area(
             referenced_no_parking_area_polygon_ids.insert(poly.id());
           }
         }
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 2), reg_elem->id());
         continue;
       }
 
@@ -78,7 +85,7 @@ lanelet::validation::Issues NoParkingAreaValidator::check_no_parking_area(
       if (
         !polygon.hasAttribute(lanelet::AttributeName::Type) ||
         polygon.attribute(lanelet::AttributeName::Type) != "no_parking_area") {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 3), reg_elem->id());
         continue;
       }
 
@@ -87,7 +94,7 @@ lanelet::validation::Issues NoParkingAreaValidator::check_no_parking_area(
       // Issue-004: Regulatory element should be referred by at least one lanelet
       const auto referrers = map.laneletLayer.findUsages(reg_elem);
       if (referrers.empty()) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 4), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 4), reg_elem->id());
       }
 
       // Issue-005: Check if there are non-road referrers (should only be referred by road lanelets)
@@ -98,11 +105,15 @@ lanelet::validation::Issues NoParkingAreaValidator::check_no_parking_area(
                  lane.attribute(lanelet::AttributeName::Subtype) !=
                    lanelet::AttributeValueString::Road;
         })) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 5), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 5), reg_elem->id());
       }
     }
   }
 
+  if (validation_cancelled()) {
+    return issues;
+  }
+
   // Issue-001: Find no_parking_area polygons not referred by any regulatory element
   std::set<lanelet::Id> unreferenced_no_parking_areas;
   std::set_difference(
@@ -111,7 +122,7 @@ lanelet::validation::Issues NoParkingAreaValidator::check_no_parking_area(
     std::inserter(unreferenced_no_parking_areas, unreferenced_no_parking_areas.begin()));
 
   for (const auto & polygon_id : unreferenced_no_parking_areas) {
-    issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), polygon_id));
+    add_issue_from_code(issues, issue_code(this->name(), 1), polygon_id);
   }
 
   return issues;
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/area/no_stopping_area.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <autoware_lanelet2_extension/regulatory_elements/no_stopping_area.hpp>
@@ -46,7 +47,10 @@ lanelet::validation::Issues NoStoppingAreaValidator::check_no_stopping_area(
   lanelet::validation::Issues issues;
 
   std::set<lanelet::Id> no_stopping_area_polygon_ids;
-  for (const auto & polygon : map.polygonLayer) {
+  for (const auto & polygon : primitives_in_roi(map.polygonLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       polygon.hasAttribute(lanelet::AttributeName::Type) &&
       polygon.attribute(lanelet::AttributeName::Type) ==
@@ -57,7 +61,10 @@ lanelet::validation::Issues NoStoppingAreaValidator::check_no_stopping_area(
 
   std::set<lanelet::Id> referenced_no_stopping_area_polygon_ids;
 
-  for (const auto & reg_elem : map.regulatoryElementLayer) {
+  for (const auto & reg_elem : primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       reg_elem->hasAttribute(lanelet::AttributeName::Subtype) &&
       reg_elem->attribute(lanelet::AttributeName::Subtype) ==
@@ -74,7 +81,7 @@ lanelet::validation::Issues NoStoppingAreaValidator::check_no_stopping_area(
             referenced_no_stopping_area_polygon_ids.insert(poly.id());
           }
         }
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 2), reg_elem->id());
         continue;
       }
 
@@ -84,7 +91,7 @@ lanelet::validation::Issues NoStoppingAreaValidator::check_no_stopping_area(
         !polygon.hasAttribute(lanelet::AttributeName::Type) ||
         polygon.attribute(lanelet::AttributeName::Type) !=
           lanelet::autoware::NoStoppingArea::RuleName) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 3), reg_elem->id());
         continue;
       }
 
@@ -93,7 +100,7 @@ lanelet::validation::Issues NoStoppingAreaValidator::check_no_stopping_area(
       // Issue-004: Regulatory element should refer to at most one stop_line
       const auto & ref_lines = reg_elem->getParameters<lanelet::ConstLineString3d>("ref_line");
       if (ref_lines.size() > 1) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 4), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 4), reg_elem->id());
         continue;
       }
 
@@ -103,8 +110,7 @@ lanelet::validation::Issues NoStoppingAreaValidator::check_no_stopping_area(
         if (
           !stop_line.hasAttribute(lanelet::AttributeName::Type) ||
           stop_line.attribute(lanelet::AttributeName::Type) != "stop_line") {
-          issues.emplace_back(
-            construct_issue_from_code(issue_code(this->name(), 5), reg_elem->id()));
+          add_issue_from_code(issues, issue_code(this->name(), 5), reg_elem->id());
           continue;
         }
       }
@@ -112,7 +118,7 @@ lanelet::validation::Issues NoStoppingAreaValidator::check_no_stopping_area(
       // Issue-006: Regulatory element should be referred by at least one road subtype lanelet
       const auto referrers = map.laneletLayer.findUsages(reg_elem);
       if (referrers.empty()) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 6), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 6), reg_elem->id());
       }
 
       // Issue-007: Check if there are non-road referrers (should only be referred by road lanelets)
@@ -122,11 +128,15 @@ lanelet::validation::Issues NoStoppingAreaValidator::check_no_stopping_area(
           return !lane.hasAttribute(lanelet::AttributeName::Subtype) ||
                  lane.attribute(lanelet::AttributeName::Subtype) != "road";
         })) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 7), reg_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 7), reg_elem->id());
       }
     }
   }
 
+  if (validation_cancelled()) {
+    return issues;
+  }
+
   // Issue-001: Find no_stopping_area polygons not referred by any regulatory element
   std::set<lanelet::Id> unreferenced_no_stopping_areas;
   std::set_difference(
@@ -135,7 +145,7 @@ lanelet::validation::Issues NoStoppingAreaValidator::check_no_stopping_area(
     std::inserter(unreferenced_no_stopping_areas, unreferenced_no_stopping_areas.begin()));
 
   for (const auto & polygon_id : unreferenced_no_stopping_areas) {
-    issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), polygon_id));
+    add_issue_from_code(issues, issue_code(this->name(), 1), polygon_id);
   }
 
   return issues;
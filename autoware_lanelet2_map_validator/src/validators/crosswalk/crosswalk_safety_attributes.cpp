@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/crosswalk/crosswalk_safety_attributes.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <map>
@@ -42,7 +43,10 @@ lanelet::validation::Issues CrosswalkSafetyAttributesValidator::check_crosswalk_
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & ll : map.laneletLayer) {
+  for (const auto & ll : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     const auto & attrs = ll.attributes();
     const auto & subtype_it = attrs.find(lanelet::AttributeName::Subtype);
 
@@ -61,14 +65,12 @@ lanelet::validation::Issues CrosswalkSafetyAttributesValidator::check_crosswalk_
         if (idx != speed_value.length() || speed <= 0.0) {
           std::map<std::string, std::string> reason_map;
           reason_map["attribute_value"] = speed_value;
-          issues.emplace_back(
-            construct_issue_from_code(issue_code(this->name(), 1), ll.id(), reason_map));
+          add_issue_from_code(issues, issue_code(this->name(), 1), ll.id(), reason_map);
         }
       } catch (const std::exception &) {
         std::map<std::string, std::string> reason_map;
         reason_map["attribute_value"] = speed_value;
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 1), ll.id(), reason_map));
+        add_issue_from_code(issues, issue_code(this->name(), 1), ll.id(), reason_map);
       }
     }
 
@@ -82,14 +84,12 @@ lanelet::validation::Issues CrosswalkSafetyAttributesValidator::check_crosswalk_
         if (idx != distance_value.length() || distance <= 0.0) {
           std::map<std::string, std::string> reason_map;
           reason_map["attribute_value"] = distance_value;
-          issues.emplace_back(
-            construct_issue_from_code(issue_code(this->name(), 2), ll.id(), reason_map));
+          add_issue_from_code(issues, issue_code(this->name(), 2), ll.id(), reason_map);
         }
       } catch (const std::exception &) {
         std::map<std::string, std::string> reason_map;
         reason_map["attribute_value"] = distance_value;
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 2), ll.id(), reason_map));
+        add_issue_from_code(issues, issue_code(this->name(), 2), ll.id(), reason_map);
       }
     }
   }
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/crosswalk/missing_regulatory_elements_for_crosswalks.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <range/v3/view/filter.hpp>
@@ -49,7 +50,10 @@ MissingRegulatoryElementsForCrosswalksValidator::checkMissingRegulatoryElementsF
   // Get all lanelets whose type is crosswalk
   std::set<lanelet::Id> cw_ids;
 
-  for (const auto & ll : map.laneletLayer) {
+  for (const auto & ll : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     const auto & attrs = ll.attributes();
     const auto & it = attrs.find(lanelet::AttributeName::Subtype);
     // Check if this lanelet is crosswalk
@@ -59,8 +63,9 @@ MissingRegulatoryElementsForCrosswalksValidator::checkMissingRegulatoryElementsF
   }
 
   // Filter regulatory elements whose type is crosswalk and has refers
+  const auto reg_elems = primitives_in_roi(map.regulatoryElementLayer, name());
   auto reg_elem_cw =
-    map.regulatoryElementLayer | ranges::views::filter([](auto && elem) {
+    reg_elems | ranges::views::filter([](auto && elem) {
       const auto & attrs = elem->attributes();
       const auto & it = attrs.find(lanelet::AttributeName::Subtype);
       return it != attrs.end() && it->second == lanelet::AttributeValueString::Crosswalk;
@@ -79,10 +84,14 @@ MissingRegulatoryElementsForCrosswalksValidator::checkMissingRegulatoryElementsF
     }
   }
 
+  if (validation_cancelled()) {
+    return issues;
+  }
+
   // Check if all lanelets of crosswalk referred by regulatory elements
   for (const auto & cw_id : cw_ids) {
     if (cw_ids_reg_elem.find(cw_id) == cw_ids_reg_elem.end()) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), cw_id));
+      add_issue_from_code(issues, issue_code(this->name(), 1), cw_id);
     }
   }
 
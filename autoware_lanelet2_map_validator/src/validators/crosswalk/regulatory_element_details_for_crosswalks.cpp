@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/crosswalk/regulatory_element_details_for_crosswalks.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <autoware_lanelet2_extension/regulatory_elements/crosswalk.hpp>
@@ -55,7 +56,8 @@ RegulatoryElementsDetailsForCrosswalksValidator::checkRegulatoryElementOfCrosswa
 {
   lanelet::validation::Issues issues;
   // filter elem whose Subtype is crosswalk
-  auto elems = map.regulatoryElementLayer | ranges::views::filter([](auto && elem) {
+  const auto reg_elems = primitives_in_roi(map.regulatoryElementLayer, name());
+  auto elems = reg_elems | ranges::views::filter([](auto && elem) {
                  const auto & attrs = elem->attributes();
                  const auto & it = attrs.find(lanelet::AttributeName::Subtype);
                  return it != attrs.end() && it->second == lanelet::AttributeValueString::Crosswalk;
@@ -69,17 +71,17 @@ RegulatoryElementsDetailsForCrosswalksValidator::checkRegulatoryElementOfCrosswa
 
     // Report error if regulatory element does not have lanelet of crosswalk
     if (refers.empty()) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), elem->id());
     } else if (refers.size() > 1) {  // Report error if regulatory element has two or more lanelet
                                      // of crosswalk
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 2), elem->id());
     }
 
     // Report Info if regulatory element does not have stop line
     if (ref_lines.empty()) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 3), elem->id());
     } else if (ref_lines.size() > 1) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 9), elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 9), elem->id());
     }
 
     // If this is a crosswalk type regulatory element, the "refers" has to be a "crosswalk" subtype
@@ -97,11 +99,11 @@ RegulatoryElementsDetailsForCrosswalksValidator::checkRegulatoryElementOfCrosswa
 
     for (const lanelet::ConstLanelet & lane : refers) {
       if (!lane.hasAttribute(lanelet::AttributeName::ParticipantPedestrian)) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 10), lane.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 10), lane.id());
       } else if (!lane.attribute(lanelet::AttributeName::ParticipantPedestrian)
                     .asBool()
                     .value_or(false)) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 11), lane.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 11), lane.id());
       }
 
       // Issue-012: check intersection between crosswalk lanelet and road lanelets that reference
@@ -124,8 +126,7 @@ RegulatoryElementsDetailsForCrosswalksValidator::checkRegulatoryElementOfCrosswa
           std::map<std::string, std::string> reason_map;
           reason_map["crosswalk_id"] = std::to_string(lane.id());
           reason_map["road_lanelet_id"] = std::to_string(refer_elem.id());
-          issues.emplace_back(
-            construct_issue_from_code(issue_code(this->name(), 12), elem->id(), reason_map));
+          add_issue_from_code(issues, issue_code(this->name(), 12), elem->id(), reason_map);
         }
       }
     }
@@ -177,7 +178,7 @@ RegulatoryElementsDetailsForCrosswalksValidator::checkRegulatoryElementOfCrosswa
 
     if (bounding_box_size > max_bounding_box_size_) {
       std::map<std::string, std::string> threshold_map;
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 13), elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 13), elem->id());
     }
   }
   return issues;
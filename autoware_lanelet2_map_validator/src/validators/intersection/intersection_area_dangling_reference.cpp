@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/intersection_area_dangling_reference.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -21,7 +22,6 @@
 #include <map>
 #include <optional>
 #include <string>
-#include <unordered_set>
 #include <vector>
 
 namespace lanelet::autoware::validation
@@ -62,23 +62,24 @@ IntersectionAreaDanglingReferenceValidator::check_intersection_area_dangling_ref
     return id;
   };
 
-  std::unordered_set<lanelet::Id> intersection_area_ids;
-  for (const auto & area : map.polygonLayer) {
-    if (
-      area.attributeOr(lanelet::AttributeName::Type, "none") == std::string("intersection_area")) {
-      intersection_area_ids.emplace(area.id());
-    }
-  }
+  // The referred polygons are looked up directly, since they may be outside the region of interest
+  const auto is_intersection_area = [&map](const lanelet::Id id) {
+    return map.polygonLayer.exists(id) &&
+           map.polygonLayer.get(id).attributeOr(lanelet::AttributeName::Type, "none") ==
+             std::string("intersection_area");
+  };
 
   lanelet::validation::Issues issues;
-  for (const auto & lanelet : map.laneletLayer) {
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (const auto id_opt = is_intersection_with_area(lanelet); id_opt) {
       const auto id = id_opt.value();
-      if (intersection_area_ids.find(id) == intersection_area_ids.end()) {
+      if (!is_intersection_area(id)) {
         std::map<std::string, std::string> area_id_map;
         area_id_map["area_id"] = std::to_string(id);
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 1), lanelet.id(), area_id_map));
+        add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id(), area_id_map);
       }
     }
   }
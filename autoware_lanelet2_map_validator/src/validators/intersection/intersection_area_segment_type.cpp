@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/intersection_area_segment_type.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <boost/geometry/algorithms/is_valid.hpp>
@@ -22,9 +23,9 @@
 #include <lanelet2_core/geometry/Polygon.h>
 #include <lanelet2_core/primitives/Polygon.h>
 
-#include <limits>
 #include <map>
 #include <string>
+#include <unordered_set>
 
 namespace lanelet::autoware::validation
 {
@@ -49,45 +50,48 @@ IntersectionAreaSegmentTypeValidator::check_intersection_area_segment_type(
 {
   lanelet::validation::Issues issues;
 
-  for (const lanelet::ConstPolygon3d & polygon3d : map.polygonLayer) {
+  const auto border_point_lookup = create_border_point_lookup(map);
+
+  if (validation_cancelled()) {
+    return issues;
+  }
+
+  for (const lanelet::ConstPolygon3d & polygon3d : primitives_in_roi(map.polygonLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !polygon3d.hasAttribute(lanelet::AttributeName::Type) ||
       polygon3d.attribute(lanelet::AttributeName::Type).value() != "intersection_area") {
       continue;
     }
 
-    const auto borders_submap = create_nearby_borders_submap(map, polygon3d);
     lanelet::Ids invalid_point_ids = {};
     for (const lanelet::ConstPoint3d & point : polygon3d) {
-      lanelet::LineStrings3d search_results = borders_submap->lineStringLayer.findUsages(point);
-      if (search_results.empty()) {
+      if (border_point_lookup.count(point.id()) == 0) {
         invalid_point_ids.push_back(point.id());
       }
     }
     if (!invalid_point_ids.empty()) {
       std::map<std::string, std::string> point_ids_map;
       point_ids_map["point_ids"] = ids_to_string(invalid_point_ids);
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 1), polygon3d.id(), point_ids_map));
+      add_issue_from_code(issues, issue_code(this->name(), 1), polygon3d.id(), point_ids_map);
     }
   }
 
   return issues;
 }
 
-lanelet::LaneletSubmapUPtr IntersectionAreaSegmentTypeValidator::create_nearby_borders_submap(
-  const lanelet::LaneletMap & map, const lanelet::ConstPolygon3d & intersection_area)
+std::unordered_set<lanelet::Id> IntersectionAreaSegmentTypeValidator::create_border_point_lookup(
+  const lanelet::LaneletMap & map)
 {
-  lanelet::BoundingBox2d bbox2d =
-    lanelet::geometry::boundingBox2d(lanelet::traits::toBasicPolygon2d(intersection_area));
+  std::unordered_set<lanelet::Id> lookup;
 
-  lanelet::ConstLanelets nearby_lanelets = map.laneletLayer.search(bbox2d);
-  lanelet::ConstLineStrings3d nearby_linestrings = map.lineStringLayer.search(bbox2d);
-
-  lanelet::LineStrings3d nearby_borders;
-
-  // Collect lanelet edges intersecting the intersection area
-  for (const auto & lanelet : nearby_lanelets) {
+  // Collect the end points of the starting/ending edges of road lanelets
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !lanelet.hasAttribute(lanelet::AttributeName::Subtype) ||
       lanelet.attribute(lanelet::AttributeName::Subtype).value() !=
@@ -95,43 +99,35 @@ lanelet::LaneletSubmapUPtr IntersectionAreaSegmentTypeValidator::create_nearby_b
       continue;
     }
 
-    if (bbox2d.contains(lanelet.leftBound2d().front().basicPoint2d())) {
-      lanelet::Point3d left_point(lanelet.leftBound().front());
-      lanelet::Point3d right_point(lanelet.rightBound().front());
-
-      lanelet::AttributeMap attribute;
-      attribute["type"] = "lanelet_edge";  // An instant linestring type for this code
-
-      lanelet::LineString3d lanelet_front_edge(
-        lanelet::utils::getId(), {left_point, right_point}, attribute);
-      nearby_borders.push_back(lanelet_front_edge);
+    const auto left_bound = lanelet.leftBound();
+    const auto right_bound = lanelet.rightBound();
+    if (left_bound.empty() || right_bound.empty()) {
+      continue;
     }
 
-    if (bbox2d.contains(lanelet.leftBound2d().back().basicPoint2d())) {
-      lanelet::Point3d left_point(lanelet.leftBound().back());
-      lanelet::Point3d right_point(lanelet.rightBound().back());
-
-      lanelet::AttributeMap attribute;
-      attribute["type"] = "lanelet_edge";  // An instant linestring type for this code
-
-      lanelet::LineString3d lanelet_back_edge(
-        lanelet::utils::getId(), {left_point, right_point}, attribute);
-      nearby_borders.push_back(lanelet_back_edge);
-    }
+    lookup.insert(
+      {left_bound.front().id(), right_bound.front().id(), left_bound.back().id(),
+       right_bound.back().id()});
   }
 
-  // Collect road_border subtype linestrings
-  for (const auto & linestring : nearby_linestrings) {
+  // Collect the points of road_border type linestrings
+  for (const auto & linestring : primitives_in_roi(map.lineStringLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
-      linestring.hasAttribute(lanelet::AttributeName::Type) &&
-      linestring.attribute(lanelet::AttributeName::Type).value() ==
+      !linestring.hasAttribute(lanelet::AttributeName::Type) ||
+      linestring.attribute(lanelet::AttributeName::Type).value() !=
         lanelet::AttributeValueString::RoadBorder) {
-      auto data = std::const_pointer_cast<LineStringData>(linestring.constData());
-      nearby_borders.push_back(lanelet::LineString3d(data, linestring.inverted()));
+      continue;
+    }
+
+    for (const lanelet::ConstPoint3d & point : linestring) {
+      lookup.insert(point.id());
     }
   }
 
-  return lanelet::utils::createSubmap(nearby_borders);
+  return lookup;
 }
 
 std::string IntersectionAreaSegmentTypeValidator::ids_to_string(const lanelet::Ids ids)
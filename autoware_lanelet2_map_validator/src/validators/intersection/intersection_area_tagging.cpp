@@ -14,6 +14,8 @@
 
 #include "lanelet2_map_validator/validators/intersection/intersection_area_tagging.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -47,93 +49,111 @@ lanelet::validation::Issues IntersectionAreaTaggingValidator::check_intersection
 {
   lanelet::validation::Issues issues;
 
-  for (const lanelet::ConstPolygon3d & polygon3d : map.polygonLayer) {
+  // Both checks below only read the map, so the intersection areas and the lanelets are checked
+  // in parallel. Issues keep the order of the layers.
+  appendIssues(
+    issues,
+    parallel_collect<lanelet::validation::Issue>(
+      primitives_in_roi(map.polygonLayer, name()),
+      [&](const lanelet::ConstPolygon3d & polygon3d, lanelet::validation::Issues & area_issues) {
+        if (
+          polygon3d.attributeOr(lanelet::AttributeName::Type, "none") ==
+          std::string("intersection_area")) {
+          check_lanelets_in_intersection_area(map, polygon3d, area_issues);
+        }
+      }));
+
+  appendIssues(
+    issues,
+    parallel_collect<lanelet::validation::Issue>(
+      primitives_in_roi(map.laneletLayer, name()),
+      [&](const lanelet::ConstLanelet & lanelet, lanelet::validation::Issues & lanelet_issues) {
+        check_intersection_area_tag(map, lanelet, lanelet_issues);
+      }));
+
+  return issues;
+}
+
+void IntersectionAreaTaggingValidator::check_lanelets_in_intersection_area(
+  const lanelet::LaneletMap & map, const lanelet::ConstPolygon3d & polygon3d,
+  lanelet::validation::Issues & issues)
+{
+  lanelet::BasicPolygon2d area_polygon2d = lanelet::traits::toBasicPolygon2d(polygon3d);
+  lanelet::BoundingBox2d bbox2d = lanelet::geometry::boundingBox2d(area_polygon2d);
+  lanelet::ConstLanelets nearby_lanelets = map.laneletLayer.search(bbox2d);
+
+  // Check precise coverage for nearby lanelets
+  for (const lanelet::ConstLanelet & lanelet : nearby_lanelets) {
     if (
-      polygon3d.attributeOr(lanelet::AttributeName::Type, "none") !=
-      std::string("intersection_area")) {
+      lanelet.attributeOr(lanelet::AttributeName::Subtype, "") !=
+      std::string(lanelet::AttributeValueString::Road)) {
       continue;
     }
-
-    lanelet::BasicPolygon2d area_polygon2d = lanelet::traits::toBasicPolygon2d(polygon3d);
-    lanelet::BoundingBox2d bbox2d = lanelet::geometry::boundingBox2d(area_polygon2d);
-    lanelet::ConstLanelets nearby_lanelets = map.laneletLayer.search(bbox2d);
-
-    // Check precise coverage for nearby lanelets
-    for (const lanelet::ConstLanelet & lanelet : nearby_lanelets) {
-      if (
-        lanelet.attributeOr(lanelet::AttributeName::Subtype, "") !=
-        std::string(lanelet::AttributeValueString::Road)) {
-        continue;
-      }
-      lanelet::BasicPolygon2d lanelet_polygon = lanelet.polygon2d().basicPolygon();
-      if (polygon_overlap_ratio(lanelet_polygon, area_polygon2d) >= 0.99) {
-        lanelet::Id tagged_area_id = lanelet.attributeOr("intersection_area", lanelet::InvalId);
-
-        if (tagged_area_id == lanelet::InvalId) {
-          // Issue-001: Lanelet missing intersection_area tag
-          std::map<std::string, std::string> area_id_map;
-          area_id_map["area_id"] = std::to_string(polygon3d.id());
-          issues.emplace_back(
-            construct_issue_from_code(issue_code(this->name(), 1), lanelet.id(), area_id_map));
-        } else {
-          // Direct ID comparison
-          if (tagged_area_id != polygon3d.id()) {
-            // Issue-002: Lanelet has wrong intersection_area tag
-            std::map<std::string, std::string> tag_map;
-            tag_map["expected_area_id"] = std::to_string(polygon3d.id());
-            tag_map["actual_area_id"] = std::to_string(tagged_area_id);
-            issues.emplace_back(
-              construct_issue_from_code(issue_code(this->name(), 2), lanelet.id(), tag_map));
-          }
+    lanelet::BasicPolygon2d lanelet_polygon = lanelet.polygon2d().basicPolygon();
+    if (polygon_overlap_ratio(lanelet_polygon, area_polygon2d) >= 0.99) {
+      lanelet::Id tagged_area_id = lanelet.attributeOr("intersection_area", lanelet::InvalId);
+
+      if (tagged_area_id == lanelet::InvalId) {
+        // Issue-001: Lanelet missing intersection_area tag
+        std::map<std::string, std::string> area_id_map;
+        area_id_map["area_id"] = std::to_string(polygon3d.id());
+        add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id(), area_id_map);
+      } else {
+        // Direct ID comparison
+        if (tagged_area_id != polygon3d.id()) {
+          // Issue-002: Lanelet has wrong intersection_area tag
+          std::map<std::string, std::string> tag_map;
+          tag_map["expected_area_id"] = std::to_string(polygon3d.id());
+          tag_map["actual_area_id"] = std::to_string(tagged_area_id);
+          add_issue_from_code(issues, issue_code(this->name(), 2), lanelet.id(), tag_map);
         }
       }
     }
   }
+}
 
+void IntersectionAreaTaggingValidator::check_intersection_area_tag(
+  const lanelet::LaneletMap & map, const lanelet::ConstLanelet & lanelet,
+  lanelet::validation::Issues & issues)
+{
   // Issue-003: Lanelet has intersection_area tag but is not completely covered by the referenced
   // area
   // Issue-004: Lanelet has turn_direction tag but missing intersection_area tag
-  for (const lanelet::ConstLanelet & lanelet : map.laneletLayer) {
-    lanelet::Id tagged_area_id = lanelet.attributeOr("intersection_area", lanelet::InvalId);
-    std::string turn_direction = lanelet.attributeOr("turn_direction", "");
-
-    // Issue-004: Check if lanelet has turn_direction but missing intersection_area tag
-    if (!turn_direction.empty() && tagged_area_id == lanelet::InvalId) {
-      std::map<std::string, std::string> tag_map;
-      tag_map["turn_direction"] = turn_direction;
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 4), lanelet.id(), tag_map));
-    }
+  lanelet::Id tagged_area_id = lanelet.attributeOr("intersection_area", lanelet::InvalId);
+  std::string turn_direction = lanelet.attributeOr("turn_direction", "");
+
+  // Issue-004: Check if lanelet has turn_direction but missing intersection_area tag
+  if (!turn_direction.empty() && tagged_area_id == lanelet::InvalId) {
+    std::map<std::string, std::string> tag_map;
+    tag_map["turn_direction"] = turn_direction;
+    add_issue_from_code(issues, issue_code(this->name(), 4), lanelet.id(), tag_map);
+  }
 
-    // Issue-003: Continue with existing intersection_area validation
-    if (tagged_area_id == lanelet::InvalId) {
-      continue;
-    }
-    bool found_area = false;
-    lanelet::BasicPolygon2d area_polygon2d;
-
-    if (map.polygonLayer.exists(tagged_area_id)) {
-      lanelet::ConstPolygon3d polygon3d = map.polygonLayer.get(tagged_area_id);
-      if (
-        polygon3d.attributeOr(lanelet::AttributeName::Type, "none") ==
-        std::string("intersection_area")) {
-        area_polygon2d = lanelet::traits::toBasicPolygon2d(polygon3d);
-        found_area = true;
-      }
-    }
+  // Issue-003: Continue with existing intersection_area validation
+  if (tagged_area_id == lanelet::InvalId) {
+    return;
+  }
+  bool found_area = false;
+  lanelet::BasicPolygon2d area_polygon2d;
 
-    if (!found_area) {
-      continue;  // (should be caught by dangling reference validator)
-    }
-    lanelet::BasicPolygon2d lanelet_polygon = lanelet.polygon2d().basicPolygon();
-    if (polygon_overlap_ratio(lanelet_polygon, area_polygon2d) < 0.99) {
-      std::map<std::string, std::string> area_id_map;
-      area_id_map["area_id"] = std::to_string(tagged_area_id);
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 3), lanelet.id(), area_id_map));
+  if (map.polygonLayer.exists(tagged_area_id)) {
+    lanelet::ConstPolygon3d polygon3d = map.polygonLayer.get(tagged_area_id);
+    if (
+      polygon3d.attributeOr(lanelet::AttributeName::Type, "none") ==
+      std::string("intersection_area")) {
+      area_polygon2d = lanelet::traits::toBasicPolygon2d(polygon3d);
+      found_area = true;
     }
   }
 
-  return issues;
+  if (!found_area) {
+    return;  // (should be caught by dangling reference validator)
+  }
+  lanelet::BasicPolygon2d lanelet_polygon = lanelet.polygon2d().basicPolygon();
+  if (polygon_overlap_ratio(lanelet_polygon, area_polygon2d) < 0.99) {
+    std::map<std::string, std::string> area_id_map;
+    area_id_map["area_id"] = std::to_string(tagged_area_id);
+    add_issue_from_code(issues, issue_code(this->name(), 3), lanelet.id(), area_id_map);
+  }
 }
 }  // namespace lanelet::autoware::validation
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/intersection_area_validity.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <boost/geometry/algorithms/is_valid.hpp>
@@ -50,7 +51,10 @@ lanelet::validation::Issues IntersectionAreaValidityValidator::check_intersectio
 {
   lanelet::validation::Issues issues;
 
-  for (const lanelet::ConstPolygon3d & polygon3d : map.polygonLayer) {
+  for (const lanelet::ConstPolygon3d & polygon3d : primitives_in_roi(map.polygonLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !polygon3d.hasAttribute(lanelet::AttributeName::Type) ||
       polygon3d.attribute(lanelet::AttributeName::Type).value() != "intersection_area") {
@@ -64,8 +68,7 @@ lanelet::validation::Issues IntersectionAreaValidityValidator::check_intersectio
     if (!polygon_is_valid && failure_type != bg::validity_failure_type::failure_wrong_orientation) {
       std::map<std::string, std::string> reason_map;
       reason_map["boost_geometry_message"] = bg::validity_failure_type_message(failure_type);
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 1), polygon3d.id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 1), polygon3d.id(), reason_map);
     }
   }
 
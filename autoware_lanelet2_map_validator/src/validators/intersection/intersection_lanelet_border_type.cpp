@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/intersection_lanelet_border_type.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -43,19 +44,22 @@ IntersectionLaneletBorderTypeValidator::check_intersection_lanelet_border_type(
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & lanelet : map.laneletLayer) {
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (lanelet.hasAttribute("intersection_area")) {
       const std::string left_type =
         lanelet.leftBound().attributeOr(lanelet::AttributeName::Type, "");
       if (left_type != "virtual" && left_type != "road_border") {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), lanelet.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id());
         continue;  // skip right bound check if left bound is already invalid
       }
 
       const std::string right_type =
         lanelet.rightBound().attributeOr(lanelet::AttributeName::Type, "");
       if (right_type != "virtual" && right_type != "road_border") {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), lanelet.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id());
       }
     }
   }
@@ -14,10 +14,11 @@
 
 #include "lanelet2_map_validator/validators/intersection/lanelet_division.hpp"
 
+#include "lanelet2_map_validator/lane_topology.hpp"
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
-#include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
 #include <map>
@@ -47,10 +48,12 @@ lanelet::validation::Issues LaneletDivisionValidator::check_lanelet_division(
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
     lanelet::traffic_rules::TrafficRulesFactory::create(
       "validator", lanelet::Participants::Vehicle);
-  lanelet::routing::RoutingGraphUPtr routing_graph_ptr =
-    lanelet::routing::RoutingGraph::build(map, *traffic_rules);
+  const LaneTopology lane_topology = LaneTopology::build(map, *traffic_rules);
 
-  for (const lanelet::ConstLanelet & lanelet : map.laneletLayer) {
+  for (const lanelet::ConstLanelet & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     lanelet::Id current_intersection_area_id =
       lanelet.attributeOr("intersection_area", lanelet::InvalId);
 
@@ -58,7 +61,7 @@ lanelet::validation::Issues LaneletDivisionValidator::check_lanelet_division(
       continue;
     }
 
-    const lanelet::ConstLanelets successors = routing_graph_ptr->following(lanelet);
+    const lanelet::ConstLanelets successors = lane_topology.following(lanelet);
 
     for (const lanelet::ConstLanelet & successor : successors) {
       lanelet::Id successor_intersection_area_id =
@@ -70,8 +73,7 @@ lanelet::validation::Issues LaneletDivisionValidator::check_lanelet_division(
         substitution_map["successor_id"] = std::to_string(successor.id());
         substitution_map["intersection_area_id"] = std::to_string(current_intersection_area_id);
 
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 1), lanelet.id(), substitution_map));
+        add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id(), substitution_map);
       }
     }
   }
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/regulatory_element_details_for_virtual_traffic_lights.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <autoware_lanelet2_extension/regulatory_elements/virtual_traffic_light.hpp>
@@ -49,7 +50,10 @@ lanelet::validation::Issues RegulatoryElementDetailsForVirtualTrafficLightsValid
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & reg_elem : map.regulatoryElementLayer) {
+  for (const auto & reg_elem : primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       reg_elem->attributeOr(lanelet::AttributeName::Subtype, "") !=
       std::string(VirtualTrafficLight::RuleName)) {
@@ -64,21 +68,20 @@ lanelet::validation::Issues RegulatoryElementDetailsForVirtualTrafficLightsValid
       if (
         start_line.attributeOr(lanelet::AttributeName::Type, "") !=
         std::string(lanelet::AttributeValueString::Virtual)) {
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 1), start_line.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 1), start_line.id());
       }
     }
 
     const lanelet::ConstLineStrings3d stop_lines =
       reg_elem->getParameters<lanelet::ConstLineString3d>(lanelet::RoleName::RefLine);
     if (stop_lines.size() != 1) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), reg_elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 2), reg_elem->id());
     }
     for (const lanelet::ConstLineString3d & stop_line : stop_lines) {
       if (
         stop_line.attributeOr(lanelet::AttributeName::Type, "") !=
         std::string(lanelet::AttributeValueString::StopLine)) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), stop_line.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 3), stop_line.id());
       }
     }
 
@@ -90,14 +93,14 @@ lanelet::validation::Issues RegulatoryElementDetailsForVirtualTrafficLightsValid
       if (
         end_line.attributeOr(lanelet::AttributeName::Type, "") !=
         std::string(lanelet::AttributeValueString::Virtual)) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 4), end_line.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 4), end_line.id());
       }
     }
 
     const lanelet::ConstLineStrings3d refers_linestrings =
       reg_elem->getParameters<lanelet::ConstLineString3d>(lanelet::RoleName::Refers);
     if (refers_linestrings.size() == 0) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 5), reg_elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 5), reg_elem->id());
     }
     for (const lanelet::ConstLineString3d & refers_linestring : refers_linestrings) {
       if (
@@ -114,8 +117,8 @@ lanelet::validation::Issues RegulatoryElementDetailsForVirtualTrafficLightsValid
         }
         std::map<std::string, std::string> supported_refers_map;
         supported_refers_map["supported_refers"] = supported_type_str;
-        issues.emplace_back(construct_issue_from_code(
-          issue_code(this->name(), 6), refers_linestring.id(), supported_refers_map));
+        add_issue_from_code(
+          issues, issue_code(this->name(), 6), refers_linestring.id(), supported_refers_map);
       }
     }
 
@@ -161,7 +164,7 @@ lanelet::validation::Issues RegulatoryElementDetailsForVirtualTrafficLightsValid
     double bounding_box_size = std::hypot(dx, dy);
 
     if (bounding_box_size > max_bounding_box_size_) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 7), reg_elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 7), reg_elem->id());
     }
   }
 
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/right_of_way_for_virtual_traffic_lights.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <autoware_lanelet2_extension/regulatory_elements/virtual_traffic_light.hpp>
@@ -59,7 +60,10 @@ RightOfWayForVirtualTrafficLightsValidator::check_right_of_way_for_virtual_traff
     lanelet::Locations::Germany, lanelet::Participants::Vehicle);
   auto routing_graph = lanelet::routing::RoutingGraph::build(map, *traffic_rules);
 
-  for (const auto & lanelet : map.laneletLayer) {
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     const auto virtual_traffic_light_elems =
       lanelet.regulatoryElementsAs<lanelet::autoware::VirtualTrafficLight>();
 
@@ -71,13 +75,13 @@ RightOfWayForVirtualTrafficLightsValidator::check_right_of_way_for_virtual_traff
 
     if (right_of_way_elems.empty()) {
       // Issue-001: Lanelet with virtual_traffic_light missing right_of_way reference
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), lanelet.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id());
       continue;
     }
 
     if (right_of_way_elems.size() > 1) {
       // Issue-002: Multiple right_of_way regulatory elements in the same lanelet
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), lanelet.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 2), lanelet.id());
       continue;
     }
 
@@ -89,8 +93,7 @@ RightOfWayForVirtualTrafficLightsValidator::check_right_of_way_for_virtual_traff
 
     if (right_of_way_lanelets.size() != 1) {
       // Issue-003: right_of_way regulatory element should have exactly one right_of_way role
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 3), right_of_way_elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 3), right_of_way_elem->id());
       continue;
     }
 
@@ -103,8 +106,7 @@ RightOfWayForVirtualTrafficLightsValidator::check_right_of_way_for_virtual_traff
 
     if (!is_set_as_right_of_way) {
       // Issue-004: right_of_way regulatory element doesn't set this lanelet as right_of_way role
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 4), right_of_way_elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 4), right_of_way_elem->id());
       continue;
     }
 
@@ -144,8 +146,7 @@ RightOfWayForVirtualTrafficLightsValidator::check_right_of_way_for_virtual_traff
       // Issue-005: Conflicting lanelet not set as yield role
       std::map<std::string, std::string> reason_map;
       reason_map["conflicting_lanelet_id"] = std::to_string(missing_id);
-      issues.emplace_back(construct_issue_from_code(
-        issue_code(this->name(), 5), right_of_way_elem->id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 5), right_of_way_elem->id(), reason_map);
     }
 
     std::set<lanelet::Id> unnecessary_yields;
@@ -157,8 +158,7 @@ RightOfWayForVirtualTrafficLightsValidator::check_right_of_way_for_virtual_traff
       // Issue-006: Unnecessary yield relationship
       std::map<std::string, std::string> reason_map;
       reason_map["unnecessary_yield_to"] = std::to_string(unnecessary_id);
-      issues.emplace_back(construct_issue_from_code(
-        issue_code(this->name(), 6), right_of_way_elem->id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 6), right_of_way_elem->id(), reason_map);
     }
 
     for (const auto & [soft_conflicting_id, ratio] : soft_conflicting_ids) {
@@ -172,8 +172,7 @@ RightOfWayForVirtualTrafficLightsValidator::check_right_of_way_for_virtual_traff
       }
       reason_map["soft_conflicting_id"] = std::to_string(soft_conflicting_id);
       reason_map["percentage"] = oss.str();
-      issues.emplace_back(construct_issue_from_code(
-        issue_code(this->name(), 7), right_of_way_elem->id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 7), right_of_way_elem->id(), reason_map);
     }
   }
   return issues;
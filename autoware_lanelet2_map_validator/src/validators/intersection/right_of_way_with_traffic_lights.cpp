@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/right_of_way_with_traffic_lights.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -116,7 +117,10 @@ RightOfWayWithTrafficLightsValidator::check_right_of_way_with_traffic_lights(
     lanelet::Locations::Germany, lanelet::Participants::Vehicle);
   auto routing_graph = lanelet::routing::RoutingGraph::build(map, *traffic_rules);
 
-  for (const lanelet::ConstLanelet & lanelet : map.laneletLayer) {
+  for (const lanelet::ConstLanelet & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (!lanelet.hasAttribute("turn_direction")) {
       continue;
     }
@@ -137,12 +141,11 @@ RightOfWayWithTrafficLightsValidator::check_right_of_way_with_traffic_lights(
       // reference
       std::map<std::string, std::string> reason_map;
       reason_map["turn_direction"] = lanelet.attribute("turn_direction").value();
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 1), lanelet.id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id(), reason_map);
       continue;
     } else if (right_of_way_elems.size() > 1) {
       // issue-002: Multiple right_of_way regulatory element in the same lanelet
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), lanelet.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 2), lanelet.id());
       continue;
     }
 
@@ -159,8 +162,7 @@ RightOfWayWithTrafficLightsValidator::check_right_of_way_with_traffic_lights(
 
     if (!is_set_as_right_of_way) {
       // issue-003: right_of_way regulatory element doesn't set this lanelet as right_of_way role
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 3), right_of_way_elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 3), right_of_way_elem->id());
       continue;
     }
     auto yield_lanelets =
@@ -246,8 +248,7 @@ RightOfWayWithTrafficLightsValidator::check_right_of_way_with_traffic_lights(
       std::map<std::string, std::string> reason_map;
       reason_map["missing_yield_to"] = std::to_string(missing_id);
       reason_map["turn_direction"] = turn_direction;
-      issues.emplace_back(construct_issue_from_code(
-        issue_code(this->name(), 4), right_of_way_elem->id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 4), right_of_way_elem->id(), reason_map);
     }
 
     // find unnecessary yield relationships (in actual but not in expected)
@@ -261,8 +262,7 @@ RightOfWayWithTrafficLightsValidator::check_right_of_way_with_traffic_lights(
       std::map<std::string, std::string> reason_map;
       reason_map["unnecessary_yield_to"] = std::to_string(unnecessary_id);
       reason_map["turn_direction"] = turn_direction;
-      issues.emplace_back(construct_issue_from_code(
-        issue_code(this->name(), 5), right_of_way_elem->id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 5), right_of_way_elem->id(), reason_map);
     }
 
     // Issue-006: Slight chance to be yield (info)
@@ -276,8 +276,7 @@ RightOfWayWithTrafficLightsValidator::check_right_of_way_with_traffic_lights(
       }
       reason_map["soft_conflicting_id"] = std::to_string(soft_conflicting_id);
       reason_map["percentage"] = oss.str();
-      issues.emplace_back(construct_issue_from_code(
-        issue_code(this->name(), 6), right_of_way_elem->id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 6), right_of_way_elem->id(), reason_map);
     }
   }
 
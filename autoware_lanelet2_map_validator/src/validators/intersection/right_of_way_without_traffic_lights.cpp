@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/right_of_way_without_traffic_lights.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <autoware_lanelet2_extension/regulatory_elements/virtual_traffic_light.hpp>
@@ -63,7 +64,10 @@ RightOfWayWithoutTrafficLightsValidator::check_right_of_way_without_traffic_ligh
 
   std::map<lanelet::Id, bool> intersection_has_right_of_way;
 
-  for (const lanelet::ConstLanelet & lanelet : map.laneletLayer) {
+  for (const lanelet::ConstLanelet & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     bool has_turn_direction = lanelet.hasAttribute("turn_direction");
     bool has_intersection_area = lanelet.hasAttribute("intersection_area");
 
@@ -103,8 +107,7 @@ RightOfWayWithoutTrafficLightsValidator::check_right_of_way_without_traffic_ligh
 
       // Issue-001: right_of_way regulatory element should have exactly one right_of_way role
       if (right_of_way_lanelets.size() != 1) {
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 1), right_of_way_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 1), right_of_way_elem->id());
         continue;
       }
 
@@ -118,8 +121,7 @@ RightOfWayWithoutTrafficLightsValidator::check_right_of_way_without_traffic_ligh
 
       // Issue-002: right_of_way regulatory element doesn't set this lanelet as right_of_way role
       if (!is_set_as_right_of_way) {
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 2), right_of_way_elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 2), right_of_way_elem->id());
         continue;
       }
 
@@ -168,8 +170,8 @@ RightOfWayWithoutTrafficLightsValidator::check_right_of_way_without_traffic_ligh
       for (const auto & missing_id : missing_yields) {
         std::map<std::string, std::string> reason_map;
         reason_map["conflicting_lanelet_id"] = std::to_string(missing_id);
-        issues.emplace_back(construct_issue_from_code(
-          issue_code(this->name(), 3), right_of_way_elem->id(), reason_map));
+        add_issue_from_code(
+          issues, issue_code(this->name(), 3), right_of_way_elem->id(), reason_map);
       }
 
       // Issue-004: Check for unnecessary yield relationships
@@ -181,8 +183,8 @@ RightOfWayWithoutTrafficLightsValidator::check_right_of_way_without_traffic_ligh
       for (const auto & unnecessary_id : unnecessary_yields) {
         std::map<std::string, std::string> reason_map;
         reason_map["unnecessary_yield_to"] = std::to_string(unnecessary_id);
-        issues.emplace_back(construct_issue_from_code(
-          issue_code(this->name(), 4), right_of_way_elem->id(), reason_map));
+        add_issue_from_code(
+          issues, issue_code(this->name(), 4), right_of_way_elem->id(), reason_map);
       }
 
       // Issue-006: Slight chance to be yield (info)
@@ -196,19 +198,22 @@ RightOfWayWithoutTrafficLightsValidator::check_right_of_way_without_traffic_ligh
         }
         reason_map["soft_conflicting_id"] = std::to_string(soft_conflicting_id);
         reason_map["percentage"] = oss.str();
-        issues.emplace_back(construct_issue_from_code(
-          issue_code(this->name(), 6), right_of_way_elem->id(), reason_map));
+        add_issue_from_code(
+          issues, issue_code(this->name(), 6), right_of_way_elem->id(), reason_map);
       }
     }
   }
 
+  if (validation_cancelled()) {
+    return issues;
+  }
+
   // Issue-005: check for intersections that don't have any right_of_way regulatory elements
   for (const auto & [intersection_id, has_right_of_way] : intersection_has_right_of_way) {
     if (!has_right_of_way) {
       std::map<std::string, std::string> reason_map;
       reason_map["intersection_id"] = std::to_string(intersection_id);
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 5), intersection_id, reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 5), intersection_id, reason_map);
     }
   }
 
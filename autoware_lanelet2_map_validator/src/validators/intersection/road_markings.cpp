@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/road_markings.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <string>
@@ -39,7 +40,10 @@ lanelet::validation::Issues RoadMarkingsValidator::check_road_markings(
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & reg_elem : map.regulatoryElementLayer) {
+  for (const auto & reg_elem : primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (reg_elem->attributeOr(lanelet::AttributeName::Subtype, "") != std::string("road_marking")) {
       continue;
     }
@@ -51,7 +55,7 @@ lanelet::validation::Issues RoadMarkingsValidator::check_road_markings(
 
     if (refers.size() != 1 || ref_lines.size() != 0) {
       // Issue-001: road_marking should have exactly one refers linestring or no ref_lines
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), reg_elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), reg_elem->id());
       continue;
     }
 
@@ -60,7 +64,7 @@ lanelet::validation::Issues RoadMarkingsValidator::check_road_markings(
         refer.attributeOr(lanelet::AttributeName::Type, "") !=
         std::string(lanelet::AttributeValueString::StopLine)) {
         // Issue-002: refers linestring must be of type stop_line
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), refer.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 2), refer.id());
       }
     }
   }
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/turn_direction_tagging.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <boost/geometry/geometry.hpp>
@@ -50,7 +51,10 @@ lanelet::validation::Issues IntersectionTurnDirectionTaggingValidator::checkTurn
   lanelet::validation::Issues issues;
   const std::set<std::string> direction_set = {"left", "straight", "right"};
 
-  for (const lanelet::ConstPolygon3d & polygon3d : map.polygonLayer) {
+  for (const lanelet::ConstPolygon3d & polygon3d : primitives_in_roi(map.polygonLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !polygon3d.hasAttribute(lanelet::AttributeName::Type) ||
       polygon3d.attribute(lanelet::AttributeName::Type).value() != "intersection_area") {
@@ -74,7 +78,7 @@ lanelet::validation::Issues IntersectionTurnDirectionTaggingValidator::checkTurn
       }
 
       if (!lane.hasAttribute("turn_direction")) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), lane.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 1), lane.id());
         continue;
       }
 
@@ -82,8 +86,7 @@ lanelet::validation::Issues IntersectionTurnDirectionTaggingValidator::checkTurn
       if (direction_set.find(turn_direction) == direction_set.end()) {
         std::map<std::string, std::string> invalid_tag_map;
         invalid_tag_map["invalid_tag"] = turn_direction;
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 2), lane.id(), invalid_tag_map));
+        add_issue_from_code(issues, issue_code(this->name(), 2), lane.id(), invalid_tag_map);
       }
     }
   }
@@ -14,25 +14,42 @@
 
 #include "lanelet2_map_validator/validators/intersection/turn_signal_distance_overlap.hpp"
 
+#include "lanelet2_map_validator/lane_topology.hpp"
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <boost/geometry.hpp>
 
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/geometry/LineString.h>
-#include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
-#include <deque>
+#include <algorithm>
+#include <iterator>
 #include <map>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace lanelet::autoware::validation
 {
 namespace
 {
 lanelet::validation::RegisterMapValidator<TurnSignalDistanceOverlapValidator> reg;
+
+// Hash of (index of the turning lanelet, lanelet ID)
+struct SourceLaneletHash
+{
+  size_t operator()(const std::pair<size_t, lanelet::Id> & pair) const
+  {
+    const size_t h1 = std::hash<size_t>{}(pair.first);
+    const size_t h2 = std::hash<lanelet::Id>{}(pair.second);
+    return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6) + (h1 >> 2));
+  }
+};
 }
 
 lanelet::validation::Issues TurnSignalDistanceOverlapValidator::operator()(
@@ -53,72 +70,184 @@ lanelet::validation::Issues TurnSignalDistanceOverlapValidator::check_turn_signa
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
     lanelet::traffic_rules::TrafficRulesFactory::create(
       lanelet::Locations::Germany, lanelet::Participants::Vehicle);
-  lanelet::routing::RoutingGraphPtr routing_graph_ptr =
-    lanelet::routing::RoutingGraph::build(map, *traffic_rules);
+  const LaneTopology lane_topology = LaneTopology::build(map, *traffic_rules);
 
-  for (const auto & lane : map.laneletLayer) {
+  lanelet::ConstLanelets turning_lanes;
+  for (const auto & lane : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !lane.hasAttribute(turn_direction_tag_) ||
       lane.attribute(turn_direction_tag_).value() == "straight") {
       continue;
     }
+    turning_lanes.push_back(lane);
+  }
 
-    const double threshold =
-      lane.attributeOr(turn_signal_distance_tag_, default_turn_signal_distance_);
-    auto overlapping_lanelets = find_overlapping_lanelets(lane, routing_graph_ptr, threshold);
+  auto overlapping_lanelets_map = find_overlapping_lanelets(turning_lanes, lane_topology);
 
-    if (overlapping_lanelets.empty()) {
+  for (const auto & lane : turning_lanes) {
+    auto it = overlapping_lanelets_map.find(lane.id());
+    if (it == overlapping_lanelets_map.end() || it->second.empty()) {
       continue;
     }
 
     std::map<std::string, std::string> prev_ids_map;
-    prev_ids_map["prev_ids"] = set_to_string(overlapping_lanelets);
-    issues.emplace_back(
-      construct_issue_from_code(issue_code(this->name(), 1), lane.id(), prev_ids_map));
+    prev_ids_map["prev_ids"] = set_to_string(it->second);
+    add_issue_from_code(issues, issue_code(this->name(), 1), lane.id(), prev_ids_map);
   }
 
   return issues;
 }
 
-std::unordered_set<lanelet::Id> TurnSignalDistanceOverlapValidator::find_overlapping_lanelets(
-  const ConstLanelet & intersection_lane,
-  const lanelet::routing::RoutingGraphPtr & routing_graph_ptr, double distance_threshold)
+std::unordered_map<lanelet::Id, std::unordered_set<lanelet::Id>>
+TurnSignalDistanceOverlapValidator::find_overlapping_lanelets(
+  const lanelet::ConstLanelets & turning_lanes, const LaneTopology & lane_topology)
 {
-  std::unordered_set<lanelet::Id> result;
-  std::unordered_set<lanelet::Id> visited;
-  std::deque<std::pair<lanelet::ConstLanelet, double>> queue;
+  std::unordered_map<lanelet::Id, std::unordered_set<lanelet::Id>> result;
+
+  // Lanelet lengths and previous lanelets are shared among all turning lanelets,
+  // so each of them is computed only once no matter how many searches pass through it
+  std::unordered_map<lanelet::Id, double> length_cache;
+  std::unordered_map<lanelet::Id, lanelet::ConstLanelets> previous_cache;
+
+  const auto lanelet_length = [&](const lanelet::ConstLanelet & lane) {
+    auto it = length_cache.find(lane.id());
+    if (it == length_cache.end()) {
+      it = length_cache.emplace(lane.id(), calc_lanelet_length(lane)).first;
+    }
+    return it->second;
+  };
+
+  const auto previous_lanelets =
+    [&](const lanelet::ConstLanelet & lane) -> const lanelet::ConstLanelets & {
+    auto it = previous_cache.find(lane.id());
+    if (it == previous_cache.end()) {
+      it = previous_cache.emplace(lane.id(), lane_topology.previous(lane)).first;
+    }
+    return it->second;
+  };
 
-  for (const auto & prev : routing_graph_ptr->previous(intersection_lane)) {
-    queue.emplace_back(prev, calc_lanelet_length(prev));
+  std::vector<double> thresholds;
+  thresholds.reserve(turning_lanes.size());
+  for (const auto & lane : turning_lanes) {
+    thresholds.push_back(
+      lane.attributeOr(turn_signal_distance_tag_, default_turn_signal_distance_));
   }
 
-  while (!queue.empty()) {
-    auto [current, cum_length] = queue.front();
-    queue.pop_front();
+  // The lanelets reached with the same number of steps from any turning lanelet form a level of
+  // the traversal, and each lanelet of a level is expanded once for all turning lanelets reaching
+  // it. A label is a turning lanelet reaching the lanelet, with the cumulative length and its
+  // order in a breadth-first search from that turning lanelet alone (the position of the lanelet
+  // it was reached from, then the index among the previous lanelets), so that the first label of
+  // each turning lanelet is taken as in that search.
+  struct Label
+  {
+    size_t source;          // Index of the turning lanelet
+    double length;          // Cumulative length from the turning lanelet
+    size_t from_position;   // Position of the lanelet it was reached from in its level
+    size_t previous_index;  // Index among the previous lanelets of that lanelet
+  };
+  struct Level
+  {
+    lanelet::ConstLanelets lanelets;
+    std::unordered_map<lanelet::Id, size_t> indices;
+    std::vector<std::vector<Label>> labels;
 
-    if (visited.count(current.id()) > 0) {
-      continue;
+    void add(const lanelet::ConstLanelet & lane, const Label & label)
+    {
+      const auto [it, inserted] = indices.emplace(lane.id(), lanelets.size());
+      if (inserted) {
+        lanelets.push_back(lane);
+        labels.emplace_back();
+      }
+      labels[it->second].push_back(label);
     }
+  };
 
-    if (cum_length > distance_threshold) {
-      continue;
+  // Labels beyond the turn_signal_distance are pruned before they are added
+  Level level;
+  for (size_t i = 0; i < turning_lanes.size(); i++) {
+    const auto & previous = previous_lanelets(turning_lanes[i]);
+    for (size_t j = 0; j < previous.size(); j++) {
+      const double length = lanelet_length(previous[j]);
+      if (length <= thresholds[i]) {
+        level.add(previous[j], {i, length, 0, j});
+      }
     }
+  }
 
-    visited.insert(current.id());
+  std::unordered_set<std::pair<size_t, lanelet::Id>, SourceLaneletHash> visited;
+  while (!level.lanelets.empty()) {
+    // Take the first label of each turning lanelet not visiting the lanelet yet
+    std::unordered_map<size_t, std::vector<std::pair<std::pair<size_t, size_t>, Label *>>>
+      visits_by_source;
+    for (size_t k = 0; k < level.lanelets.size(); k++) {
+      const auto & current = level.lanelets[k];
+      auto & labels = level.labels[k];
+      std::sort(labels.begin(), labels.end(), [](const Label & a, const Label & b) {
+        return std::tie(a.source, a.from_position, a.previous_index) <
+               std::tie(b.source, b.from_position, b.previous_index);
+      });
+      auto last = labels.begin();
+      for (auto it = labels.begin(); it != labels.end(); ++it) {
+        if (
+          (it != labels.begin() && it->source == std::prev(it)->source) ||
+          !visited.emplace(it->source, current.id()).second) {
+          continue;
+        }
+        *last = *it;
+        visits_by_source[last->source].push_back(
+          {{last->from_position, last->previous_index}, &*last});
+        ++last;
 
-    if (current.hasAttribute(turn_direction_tag_)) {
-      if (
-        (intersection_lane.attribute(turn_direction_tag_).value() == "left" &&
-         current.attribute(turn_direction_tag_).value() == "right") ||
-        (intersection_lane.attribute(turn_direction_tag_).value() == "right" &&
-         current.attribute(turn_direction_tag_).value() == "left")) {
-        result.insert(current.id());
+        const auto & source = turning_lanes[it->source];
+        if (current.hasAttribute(turn_direction_tag_)) {
+          if (
+            (source.attribute(turn_direction_tag_).value() == "left" &&
+             current.attribute(turn_direction_tag_).value() == "right") ||
+            (source.attribute(turn_direction_tag_).value() == "right" &&
+             current.attribute(turn_direction_tag_).value() == "left")) {
+            result[source.id()].insert(current.id());
+          }
+        }
       }
+      labels.erase(last, labels.end());
     }
 
-    for (const auto & prev : routing_graph_ptr->previous(current)) {
-      queue.emplace_back(prev, cum_length + calc_lanelet_length(prev));
+    // The positions of the visited lanelets in the search of each turning lanelet order the labels
+    // of the next level
+    for (auto & source_visits : visits_by_source) {
+      auto & visits = source_visits.second;
+      std::sort(visits.begin(), visits.end(), [](const auto & a, const auto & b) {
+        return a.first < b.first;
+      });
+      for (size_t position = 0; position < visits.size(); position++) {
+        visits[position].second->from_position = position;
+      }
+    }
+
+    Level next_level;
+    for (size_t k = 0; k < level.lanelets.size(); k++) {
+      if (level.labels[k].empty()) {
+        continue;
+      }
+      const auto & previous = previous_lanelets(level.lanelets[k]);
+      for (size_t j = 0; j < previous.size(); j++) {
+        const double length = lanelet_length(previous[j]);
+        for (const auto & label : level.labels[k]) {
+          const double next_length = label.length + length;
+          if (
+            next_length > thresholds[label.source] ||
+            visited.count({label.source, previous[j].id()}) > 0) {
+            continue;
+          }
+          next_level.add(previous[j], {label.source, next_length, label.from_position, j});
+        }
+      }
     }
+    level = std::move(next_level);
   }
 
   return result;
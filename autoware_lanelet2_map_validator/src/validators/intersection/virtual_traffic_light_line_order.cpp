@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/intersection/virtual_traffic_light_line_order.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <autoware_lanelet2_extension/regulatory_elements/virtual_traffic_light.hpp>
@@ -61,7 +62,10 @@ VirtualTrafficLightLineOrderValidator::check_virtual_traffic_light_line_order(
   lanelet::routing::RoutingGraphUPtr routing_graph_ptr =
     lanelet::routing::RoutingGraph::build(map, *traffic_rules);
 
-  for (const auto & reg_elem : map.regulatoryElementLayer) {
+  for (const auto & reg_elem : primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (!is_target_virtual_traffic_light(reg_elem)) {
       continue;
     }
@@ -84,7 +88,7 @@ VirtualTrafficLightLineOrderValidator::check_virtual_traffic_light_line_order(
     const lanelet::Optional<lanelet::ConstLanelet> stop_lanelet = belonging_lanelet(stop_line, map);
 
     if (!start_lanelet) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), start_line.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), start_line.id());
       continue;
     }
 
@@ -100,8 +104,7 @@ VirtualTrafficLightLineOrderValidator::check_virtual_traffic_light_line_order(
       if (!end_line_opt) {
         std::map<std::string, std::string> lane_id_map;
         lane_id_map["id"] = std::to_string(lane.id());
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 2), reg_elem->id(), lane_id_map));
+        add_issue_from_code(issues, issue_code(this->name(), 2), reg_elem->id(), lane_id_map);
         continue;
       }
       end_pairs.push_back({end_line_opt.get(), lane});
@@ -113,7 +116,7 @@ VirtualTrafficLightLineOrderValidator::check_virtual_traffic_light_line_order(
     }
 
     if (is_start_line_intersecting) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), start_line.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 3), start_line.id());
       continue;
     }
 
@@ -124,8 +127,7 @@ VirtualTrafficLightLineOrderValidator::check_virtual_traffic_light_line_order(
       lanelet::Optional<lanelet::routing::LaneletPath> start_to_end_path_opt =
         routing_graph_ptr->shortestPath(start_lanelet.get(), referrer_lanelet, {}, false);
       if (!start_to_end_path_opt) {
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 4), reg_elem->id(), end_line_id_map));
+        add_issue_from_code(issues, issue_code(this->name(), 4), reg_elem->id(), end_line_id_map);
         continue;
       }
 
@@ -135,8 +137,7 @@ VirtualTrafficLightLineOrderValidator::check_virtual_traffic_light_line_order(
         {concat_left_bound, concat_right_bound.invert()});
 
       if (intersection_ratio(stop_line, concat_lanelet_polygon) < 0.1) {
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 5), stop_line.id(), end_line_id_map));
+        add_issue_from_code(issues, issue_code(this->name(), 5), stop_line.id(), end_line_id_map);
       }
 
       const lanelet::ConstLineString3d start_line_aligned =
@@ -153,8 +154,7 @@ VirtualTrafficLightLineOrderValidator::check_virtual_traffic_light_line_order(
                      start_line_aligned.back(), stop_line_aligned.back(), end_line_aligned.back(),
                      concat_right_bound);
       if (!is_ok) {
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 6), reg_elem->id(), end_line_id_map));
+        add_issue_from_code(issues, issue_code(this->name(), 6), reg_elem->id(), end_line_id_map);
         continue;
       }
     }
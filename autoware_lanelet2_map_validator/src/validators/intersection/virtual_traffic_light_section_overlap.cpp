@@ -15,6 +15,7 @@
 #include "lanelet2_map_validator/validators/intersection/virtual_traffic_light_section_overlap.hpp"
 
 #include "lanelet2_core/primitives/Traits.h"
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <boost/geometry.hpp>
@@ -59,7 +60,10 @@ VirtualTrafficLightSectionOverlapValidator::check_virtual_traffic_light_section_
 
   std::map<std::string, std::string> reg_elem_id_map;
 
-  for (const auto & lane : map.laneletLayer) {
+  for (const auto & lane : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     // Check the lanelet has a virtual_traffic_light regulatory element
     // and get the path ending with that lanelet
     const auto reg_elems = lane.regulatoryElementsAs<VirtualTrafficLight>();
@@ -115,8 +119,7 @@ VirtualTrafficLightSectionOverlapValidator::check_virtual_traffic_light_section_
 
         if (overlaps.size() > 1) {
           reg_elem_id_map["reg_elem_id"] = std::to_string(nearby_reg_elem->id());
-          issues.emplace_back(construct_issue_from_code(
-            issue_code(this->name(), 1), reg_elem->id(), reg_elem_id_map));
+          add_issue_from_code(issues, issue_code(this->name(), 1), reg_elem->id(), reg_elem_id_map);
           continue;
         }
 
@@ -159,8 +162,7 @@ VirtualTrafficLightSectionOverlapValidator::check_virtual_traffic_light_section_
           end_left_arc.length > start_left_arc.length ||
           end_right_arc.length > start_right_arc.length) {
           reg_elem_id_map["reg_elem_id"] = std::to_string(nearby_reg_elem->id());
-          issues.emplace_back(construct_issue_from_code(
-            issue_code(this->name(), 1), reg_elem->id(), reg_elem_id_map));
+          add_issue_from_code(issues, issue_code(this->name(), 1), reg_elem->id(), reg_elem_id_map);
         }
       }
     }
@@ -14,15 +14,18 @@
 
 #include "lanelet2_map_validator/validators/lane/border_sharing.hpp"
 
+#include "lanelet2_map_validator/lane_topology.hpp"
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <boost/geometry.hpp>
 
 #include <lanelet2_core/geometry/LineString.h>
 #include <lanelet2_core/geometry/Polygon.h>
-#include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <stdexcept>
@@ -35,6 +38,10 @@ namespace lanelet::autoware::validation
 namespace
 {
 lanelet::validation::RegisterMapValidator<BorderSharingValidator> reg;
+
+// Inner points are shifted at most this many times delta, so that a bound turning back on itself
+// does not throw its point far away
+constexpr double max_miter_scale = 4.0;
 }
 
 lanelet::validation::Issues BorderSharingValidator::operator()(const lanelet::LaneletMap & map)
@@ -54,61 +61,62 @@ lanelet::validation::Issues BorderSharingValidator::check_border_sharing(
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
     lanelet::traffic_rules::TrafficRulesFactory::create(
       "validator", lanelet::Participants::Vehicle);
-  lanelet::routing::RoutingGraphUPtr routing_graph_ptr =
-    lanelet::routing::RoutingGraph::build(map, *traffic_rules);
-
-  std::vector<std::pair<lanelet::Id, lanelet::Id>> suspicious_pairs;
-  for (const lanelet::ConstLanelet & current_lane : map.laneletLayer) {
-    // Get the surrounding polygon of the lanelet
-    const lanelet::BasicPolygon2d surrounding_polygon =
-      expanded_lanelet_polygon(current_lane, 1.05);
-
-    // Collect nearby lanelets which are candidates violating the requirements
-    lanelet::BoundingBox2d bbox2d = lanelet::geometry::boundingBox2d(surrounding_polygon);
-    lanelet::ConstLanelets nearby_lanelets = map.laneletLayer.search(bbox2d);
-
-    // Collect suspicious pairs of lanelets violating the border sharing rule
-    for (const auto & candidate_lane : nearby_lanelets) {
-      // Ignore its own self
-      if (current_lane.id() == candidate_lane.id()) {
-        continue;
-      }
-
-      // If current and candidate have a proper relation, that's OK so skip it
-      const lanelet::routing::RelationType relation =
-        get_relation(routing_graph_ptr, current_lane, candidate_lane);
-      if (
-        relation != lanelet::routing::RelationType::Conflicting &&
-        relation != lanelet::routing::RelationType::None) {
-        continue;
-      }
-
-      // Assume that high IoU means pseudo-bidirectional lanelets
-      if (
-        relation == lanelet::routing::RelationType::Conflicting &&
-        intersection_over_union(surrounding_polygon, candidate_lane.polygon2d().basicPolygon()) >
-          iou_threshold_) {
-        continue;
-      }
-
-      // Skip valid opposite lanes
-      if (
-        candidate_lane.rightBound() == current_lane.rightBound().invert() ||
-        candidate_lane.leftBound() == current_lane.leftBound().invert()) {
-        continue;
+  const LaneTopology lane_topology = LaneTopology::build(map, *traffic_rules);
+
+  // Each lanelet is checked independently, so they are processed in parallel. The pairs are
+  // merged in the order of the lanelets.
+  using IdPair = std::pair<lanelet::Id, lanelet::Id>;
+  const std::vector<IdPair> suspicious_pairs = parallel_collect<IdPair>(
+    primitives_in_roi(map.laneletLayer, name()),
+    [&](const lanelet::ConstLanelet & current_lane, std::vector<IdPair> & pairs) {
+      // Get the surrounding polygon of the lanelet
+      const auto [surrounding_polygon, bbox2d] = expanded_lanelet_polygon(current_lane, 1.05);
+
+      // Collect nearby lanelets which are candidates violating the requirements
+      lanelet::ConstLanelets nearby_lanelets = map.laneletLayer.search(bbox2d);
+
+      // Collect suspicious pairs of lanelets violating the border sharing rule
+      for (const auto & candidate_lane : nearby_lanelets) {
+        // Ignore its own self
+        if (current_lane.id() == candidate_lane.id()) {
+          continue;
+        }
+
+        // If current and candidate have a proper relation, that's OK so skip it
+        const lanelet::routing::RelationType relation =
+          get_relation(lane_topology, current_lane, candidate_lane);
+        if (
+          relation != lanelet::routing::RelationType::Conflicting &&
+          relation != lanelet::routing::RelationType::None) {
+          continue;
+        }
+
+        // Assume that high IoU means pseudo-bidirectional lanelets
+        if (
+          relation == lanelet::routing::RelationType::Conflicting &&
+          intersection_over_union(
+            surrounding_polygon, candidate_lane.polygon2d().basicPolygon()) > iou_threshold_) {
+          continue;
+        }
+
+        // Skip valid opposite lanes
+        if (
+          candidate_lane.rightBound() == current_lane.rightBound().invert() ||
+          candidate_lane.leftBound() == current_lane.leftBound().invert()) {
+          continue;
+        }
+
+        // If the surrounding_polygon covers the border of a non-related lanelet, that lanelet
+        // might be suspicious
+        if (
+          boost::geometry::covered_by(
+            candidate_lane.leftBound2d().basicLineString(), surrounding_polygon) ||
+          boost::geometry::covered_by(
+            candidate_lane.rightBound2d().basicLineString(), surrounding_polygon)) {
+          pairs.push_back({current_lane.id(), candidate_lane.id()});
+        }
       }
-
-      // If the surrounding_polygon covers the border of a non-related lanelet, that lanelet might
-      // be suspicious
-      if (
-        boost::geometry::covered_by(
-          candidate_lane.leftBound2d().basicLineString(), surrounding_polygon) ||
-        boost::geometry::covered_by(
-          candidate_lane.rightBound2d().basicLineString(), surrounding_polygon)) {
-        suspicious_pairs.push_back({current_lane.id(), candidate_lane.id()});
-      }
-    }
-  }
+    });
 
   // Sort out pairs by their directionality
   std::set<std::pair<lanelet::Id, lanelet::Id>> unidirectional_pairs;
@@ -131,11 +139,9 @@ lanelet::validation::Issues BorderSharingValidator::check_border_sharing(
   std::map<std::string, std::string> substitution_map1;
   for (const auto & pair : bidirectional_pairs) {
     substitution_map1["lanelet_id"] = std::to_string(pair.second);
-    issues.emplace_back(
-      construct_issue_from_code(issue_code(this->name(), 1), pair.first, substitution_map1));
+    add_issue_from_code(issues, issue_code(this->name(), 1), pair.first, substitution_map1);
     substitution_map1["lanelet_id"] = std::to_string(pair.first);
-    issues.emplace_back(
-      construct_issue_from_code(issue_code(this->name(), 1), pair.second, substitution_map1));
+    add_issue_from_code(issues, issue_code(this->name(), 1), pair.second, substitution_map1);
   }
 
   // Emplace issues violating vm-01-04
@@ -165,17 +171,16 @@ lanelet::validation::Issues BorderSharingValidator::check_border_sharing(
 
     substitution_map2["lanelet_ids"] = ids_to_string(adjacents);
 
-    issues.emplace_back(
-      construct_issue_from_code(issue_code(this->name(), 2), current_first, substitution_map2));
+    add_issue_from_code(issues, issue_code(this->name(), 2), current_first, substitution_map2);
   }
 
   return issues;
 }
 
-lanelet::BasicPolygon2d BorderSharingValidator::expanded_lanelet_polygon(
+BorderSharingValidator::ExpandedPolygon BorderSharingValidator::expanded_lanelet_polygon(
   const lanelet::ConstLanelet & lane, const double & scale_factor)
 {
-  lanelet::BasicPolygon2d result;
+  ExpandedPolygon result;
 
   lanelet::BasicLineString2d left_bound = lane.leftBound2d().basicLineString();
   lanelet::BasicLineString2d right_bound = lane.rightBound2d().invert().basicLineString();
@@ -189,63 +194,100 @@ lanelet::BasicPolygon2d BorderSharingValidator::expanded_lanelet_polygon(
   const double back_width = (left_bound.back() - right_bound.front()).norm();
   const double delta = (front_width + back_width) / 2 * (scale_factor - 1);
 
-  const auto unit_direction = [](lanelet::BasicPoint2d from, lanelet::BasicPoint2d to) {
-    lanelet::BasicPoint2d direction = to - from;
-    return (direction.norm() > 0.0) ? direction / direction.norm()
-                                    : lanelet::BasicPoint2d(0.0, 0.0);
-  };
+  if (simplification_tolerance_ > 0.0) {
+    lanelet::BasicLineString2d simplified;
+    boost::geometry::simplify(left_bound, simplified, simplification_tolerance_);
+    left_bound = std::move(simplified);
+    simplified.clear();
+    boost::geometry::simplify(right_bound, simplified, simplification_tolerance_);
+    right_bound = std::move(simplified);
+  }
 
-  for (const auto & point : left_bound) {
-    lanelet::ArcCoordinates arc_point = lanelet::geometry::toArcCoordinates(left_bound, point);
-    arc_point.distance += delta;
-    lanelet::BasicPoint2d extended_point =
-      lanelet::geometry::fromArcCoordinates(left_bound, arc_point);
+  result.polygon.reserve(left_bound.size() + right_bound.size());
+  append_offset_bound(left_bound, delta, result);
+  append_offset_bound(right_bound, delta, result);
 
-    if (point == left_bound.front()) {
-      extended_point += delta * unit_direction(left_bound[1], left_bound[0]);
-    }
-    if (point == left_bound.back()) {
-      extended_point +=
-        delta *
-        unit_direction(left_bound[left_bound.size() - 2], left_bound[left_bound.size() - 1]);
-    }
+  return result;
+}
+
+void BorderSharingValidator::append_offset_bound(
+  const lanelet::BasicLineString2d & bound, const double delta, ExpandedPolygon & expanded)
+{
+  const size_t num_points = bound.size();
+  if (num_points < 2) {
+    return;
+  }
 
-    result.push_back(extended_point);
+  // Left unit normals of each segment. A segment with zero length takes over the normal of the
+  // neighboring segment, and a bound without any length is not shifted.
+  std::vector<lanelet::BasicPoint2d> normals(num_points - 1, lanelet::BasicPoint2d(0.0, 0.0));
+  size_t first_valid = normals.size();
+  for (size_t i = 0; i + 1 < num_points; i++) {
+    const lanelet::BasicPoint2d direction = bound[i + 1] - bound[i];
+    const double length = direction.norm();
+    if (length > 0.0) {
+      normals[i] = lanelet::BasicPoint2d(-direction.y(), direction.x()) / length;
+      first_valid = std::min(first_valid, i);
+    } else if (i > 0) {
+      normals[i] = normals[i - 1];
+    }
+  }
+  for (size_t i = 0; i < first_valid && first_valid < normals.size(); i++) {
+    normals[i] = normals[first_valid];
   }
 
-  for (const auto & point : right_bound) {
-    lanelet::ArcCoordinates arc_point = lanelet::geometry::toArcCoordinates(right_bound, point);
-    arc_point.distance += delta;
-    lanelet::BasicPoint2d extended_point =
-      lanelet::geometry::fromArcCoordinates(right_bound, arc_point);
+  // The tangent in the direction of the bound is the normal rotated clockwise
+  const auto tangent = [](const lanelet::BasicPoint2d & normal) {
+    return lanelet::BasicPoint2d(normal.y(), -normal.x());
+  };
 
-    if (point == right_bound.front()) {
-      extended_point += delta * unit_direction(right_bound[1], right_bound[0]);
+  for (size_t i = 0; i < num_points; i++) {
+    lanelet::BasicPoint2d normal;
+    if (i == 0) {
+      normal = normals.front();
+    } else if (i + 1 == num_points) {
+      normal = normals.back();
+    } else {
+      // Shift inner points along the bisector of the neighboring segments, scaled by
+      // 1 / cos(half of the turning angle) so that both shifted segments stay delta away from the
+      // bound
+      const lanelet::BasicPoint2d sum = normals[i - 1] + normals[i];
+      if (sum.norm() > 0.0) {
+        const lanelet::BasicPoint2d bisector = sum / sum.norm();
+        const double cos_half_angle = bisector.dot(normals[i]);
+        normal = bisector / std::max(cos_half_angle, 1.0 / max_miter_scale);
+      } else {
+        normal = normals[i];
+      }
     }
-    if (point == right_bound.back()) {
-      extended_point +=
-        delta *
-        unit_direction(right_bound[right_bound.size() - 2], right_bound[right_bound.size() - 1]);
+
+    lanelet::BasicPoint2d extended_point = bound[i] + delta * normal;
+
+    // The end points are also extended to the longitudinal direction
+    if (i == 0) {
+      extended_point -= delta * tangent(normals.front());
+    }
+    if (i + 1 == num_points) {
+      extended_point += delta * tangent(normals.back());
     }
 
-    result.push_back(extended_point);
+    expanded.polygon.push_back(extended_point);
+    expanded.bounding_box.extend(extended_point);
   }
-
-  return result;
 }
 
 lanelet::routing::RelationType BorderSharingValidator::get_relation(
-  const lanelet::routing::RoutingGraphUPtr & routing_graph_ptr, const lanelet::ConstLanelet from,
+  const LaneTopology & lane_topology, const lanelet::ConstLanelet from,
   const lanelet::ConstLanelet to)
 {
   // This can get relations except "previous"
-  const auto relation = routing_graph_ptr->routingRelation(from, to, true);
+  const auto relation = lane_topology.routingRelation(from, to, true);
   if (!!relation) {
     return relation.get();
   }
 
   // Check previous
-  const auto previous_relation = routing_graph_ptr->routingRelation(to, from, false);
+  const auto previous_relation = lane_topology.routingRelation(to, from, false);
   if (!!previous_relation && previous_relation.get() == lanelet::routing::RelationType::Successor) {
     return lanelet::routing::RelationType::Successor;
   }
@@ -14,6 +14,8 @@
 
 #include "lanelet2_map_validator/validators/lane/centerline_geometry.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <Eigen/Dense>
@@ -46,98 +48,96 @@ lanelet::validation::Issues CenterlineGeometryValidator::operator()(const lanele
 lanelet::validation::Issues CenterlineGeometryValidator::check_centerline_geometry(
   const lanelet::LaneletMap & map)
 {
-  lanelet::validation::Issues issues;
+  // The custom centerlines are already set when the map is loaded, and each task only touches its
+  // own lanelet, so the lanelets can be checked in parallel. Issues keep the order of the layer.
+  return parallel_collect<lanelet::validation::Issue>(
+    primitives_in_roi(map.laneletLayer, name()),
+    [&](const lanelet::ConstLanelet & lane, lanelet::validation::Issues & issues) {
+      if (!lane.hasCustomCenterline()) {
+        return;
+      }
 
-  for (const auto & lane : map.laneletLayer) {
-    if (!lane.hasCustomCenterline()) {
-      continue;
-    }
-
-    const lanelet::ConstLineString3d centerline3d = lane.centerline3d();
-
-    const lanelet::BasicLineString2d starting_edge = {
-      lane.leftBound2d().front().basicPoint2d(), lane.rightBound2d().front().basicPoint2d()};
-    const lanelet::BasicLineString2d ending_edge = {
-      lane.leftBound2d().back().basicPoint2d(), lane.rightBound2d().back().basicPoint2d()};
-
-    const lanelet::BasicPolygon2d lane_polygon2d = lane.polygon2d().basicPolygon();
-    const lanelet::BasicPolygon3d lane_polygon3d = lane.polygon3d().basicPolygon();
-
-    lanelet::ConstPoints3d sticking_out_points;
-    for (const lanelet::ConstPoint3d & point : centerline3d) {
-      // if starting point of the centerline
-      if (point == centerline3d.front()) {
-        if (boost::geometry::distance(starting_edge, point.basicPoint2d()) > planar_threshold_) {
-          std::map<std::string, std::string> point_id_map;
-          point_id_map["point_id"] = std::to_string(point.id());
-          issues.emplace_back(construct_issue_from_code(
-            issue_code(this->name(), 1), centerline3d.id(), point_id_map));
+      const lanelet::ConstLineString3d centerline3d = lane.centerline3d();
+
+      const lanelet::BasicLineString2d starting_edge = {
+        lane.leftBound2d().front().basicPoint2d(), lane.rightBound2d().front().basicPoint2d()};
+      const lanelet::BasicLineString2d ending_edge = {
+        lane.leftBound2d().back().basicPoint2d(), lane.rightBound2d().back().basicPoint2d()};
+
+      const lanelet::BasicPolygon2d lane_polygon2d = lane.polygon2d().basicPolygon();
+      const lanelet::BasicPolygon3d lane_polygon3d = lane.polygon3d().basicPolygon();
+
+      lanelet::ConstPoints3d sticking_out_points;
+      for (const lanelet::ConstPoint3d & point : centerline3d) {
+        // if starting point of the centerline
+        if (point == centerline3d.front()) {
+          if (boost::geometry::distance(starting_edge, point.basicPoint2d()) > planar_threshold_) {
+            std::map<std::string, std::string> point_id_map;
+            point_id_map["point_id"] = std::to_string(point.id());
+            add_issue_from_code(
+              issues, issue_code(this->name(), 1), centerline3d.id(), point_id_map);
+          }
+          continue;
         }
-        continue;
-      }
-      // if ending point of the centerline
-      if (point == centerline3d.back()) {
-        if (boost::geometry::distance(ending_edge, point.basicPoint2d()) > planar_threshold_) {
-          std::map<std::string, std::string> point_id_map;
-          point_id_map["point_id"] = std::to_string(point.id());
-          issues.emplace_back(construct_issue_from_code(
-            issue_code(this->name(), 1), centerline3d.id(), point_id_map));
+        // if ending point of the centerline
+        if (point == centerline3d.back()) {
+          if (boost::geometry::distance(ending_edge, point.basicPoint2d()) > planar_threshold_) {
+            std::map<std::string, std::string> point_id_map;
+            point_id_map["point_id"] = std::to_string(point.id());
+            add_issue_from_code(
+              issues, issue_code(this->name(), 1), centerline3d.id(), point_id_map);
+          }
+          continue;
+        }
+        // else points of the centerline
+        if (!boost::geometry::covered_by(point.basicPoint2d(), lane_polygon2d)) {
+          sticking_out_points.push_back(point);
         }
-        continue;
       }
-      // else points of the centerline
-      if (!boost::geometry::covered_by(point.basicPoint2d(), lane_polygon2d)) {
-        sticking_out_points.push_back(point);
+      if (!sticking_out_points.empty()) {
+        std::map<std::string, std::string> point_ids_map;
+        point_ids_map["point_ids"] = primitives_to_ids_string(sticking_out_points);
+        add_issue_from_code(issues, issue_code(this->name(), 2), centerline3d.id(), point_ids_map);
       }
-    }
-    if (!sticking_out_points.empty()) {
-      std::map<std::string, std::string> point_ids_map;
-      point_ids_map["point_ids"] = primitives_to_ids_string(sticking_out_points);
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 2), centerline3d.id(), point_ids_map));
-    }
-
-    // quit validation if this is 2D mode
-    if (dimension_mode_ == twoD) {
-      continue;
-    }
-
-    // estimate the lanelet plane
-    Eigen::Vector3d centroid(0, 0, 0);
-    for (const auto & point : lane_polygon3d) {
-      centroid += point;
-    }
-    centroid /= lane_polygon3d.size();
-
-    Eigen::MatrixXd centered(lane_polygon3d.size(), 3);
-    for (size_t i = 0; i < lane_polygon3d.size(); ++i) {
-      centered.row(i) = lane_polygon3d[i] - centroid;
-    }
-
-    const Eigen::Matrix3d cov = centered.transpose() * centered;
-
-    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(cov);
-    if (solver.info() != Eigen::Success) {
-      throw std::runtime_error("Eigen decomposition failed in centerline_geometry");
-    }
-
-    Eigen::Vector3d normal = solver.eigenvectors().col(0).normalized();
-
-    // validate the point height based from the estimated lanelet plane
-    lanelet::ConstPoints3d distant_points;
-    for (const lanelet::ConstPoint3d & point : centerline3d) {
-      if (std::abs((point.basicPoint() - centroid).dot(normal)) > height_threshold_) {
-        distant_points.push_back(point);
+
+      // quit validation if this is 2D mode
+      if (dimension_mode_ == twoD) {
+        return;
       }
-    }
-    if (!distant_points.empty()) {
-      std::map<std::string, std::string> point_ids_map;
-      point_ids_map["point_ids"] = primitives_to_ids_string(distant_points);
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 3), centerline3d.id(), point_ids_map));
-    }
-  }
 
-  return issues;
+      // estimate the lanelet plane
+      Eigen::Vector3d centroid(0, 0, 0);
+      for (const auto & point : lane_polygon3d) {
+        centroid += point;
+      }
+      centroid /= lane_polygon3d.size();
+
+      Eigen::MatrixXd centered(lane_polygon3d.size(), 3);
+      for (size_t i = 0; i < lane_polygon3d.size(); ++i) {
+        centered.row(i) = lane_polygon3d[i] - centroid;
+      }
+
+      const Eigen::Matrix3d cov = centered.transpose() * centered;
+
+      Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(cov);
+      if (solver.info() != Eigen::Success) {
+        throw std::runtime_error("Eigen decomposition failed in centerline_geometry");
+      }
+
+      Eigen::Vector3d normal = solver.eigenvectors().col(0).normalized();
+
+      // validate the point height based from the estimated lanelet plane
+      lanelet::ConstPoints3d distant_points;
+      for (const lanelet::ConstPoint3d & point : centerline3d) {
+        if (std::abs((point.basicPoint() - centroid).dot(normal)) > height_threshold_) {
+          distant_points.push_back(point);
+        }
+      }
+      if (!distant_points.empty()) {
+        std::map<std::string, std::string> point_ids_map;
+        point_ids_map["point_ids"] = primitives_to_ids_string(distant_points);
+        add_issue_from_code(issues, issue_code(this->name(), 3), centerline3d.id(), point_ids_map);
+      }
+    });
 }
 }  // namespace lanelet::autoware::validation
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/lane/lane_change_attribute.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <boost/geometry/algorithms/area.hpp>
@@ -25,7 +26,6 @@
 #include <lanelet2_core/geometry/BoundingBox.h>
 #include <lanelet2_core/geometry/Polygon.h>
 #include <lanelet2_core/primitives/Polygon.h>
-#include <lanelet2_routing/RoutingGraph.h>
 
 #include <map>
 #include <string>
@@ -53,13 +53,6 @@ lanelet::validation::Issues LaneChangeAttributeValidator::check_lane_change_attr
 {
   lanelet::validation::Issues issues;
 
-  // Create routing graph for checking lanelet adjacency and direction
-  lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
-    lanelet::traffic_rules::TrafficRulesFactory::create(
-      lanelet::Locations::Germany, lanelet::Participants::Vehicle);
-  lanelet::routing::RoutingGraphPtr routing_graph =
-    lanelet::routing::RoutingGraph::build(map, *traffic_rules);
-
   std::unordered_set<Id> checked_bounds;
 
   auto check_bound = [&](
@@ -97,21 +90,22 @@ lanelet::validation::Issues LaneChangeAttributeValidator::check_lane_change_attr
     if (!bound.hasAttribute("lane_change")) {
       std::map<std::string, std::string> bound_type_map;
       bound_type_map["bound_type"] = bound_type;
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 1), bound.id(), bound_type_map));
+      add_issue_from_code(issues, issue_code(this->name(), 1), bound.id(), bound_type_map);
     } else {
       const std::string lane_change_value = bound.attribute("lane_change").value();
       if (lane_change_value != "yes" && lane_change_value != "no") {
         std::map<std::string, std::string> substitution_map;
         substitution_map["bound_type"] = bound_type;
         substitution_map["invalid_value"] = lane_change_value;
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 2), bound.id(), substitution_map));
+        add_issue_from_code(issues, issue_code(this->name(), 2), bound.id(), substitution_map);
       }
     }
   };
 
-  for (const auto & lanelet : map.laneletLayer) {
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !lanelet.hasAttribute(lanelet::AttributeName::Subtype) ||
       lanelet.attribute(lanelet::AttributeName::Subtype).value() !=
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/lane/lanelet_geometry.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <algorithm>
@@ -42,7 +43,10 @@ lanelet::validation::Issues LaneletGeometryValidator::check_lanelet_geometry(
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & lanelet : map.laneletLayer) {
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     std::set<lanelet::Id> left_point_ids;
     std::set<lanelet::Id> right_point_ids;
 
@@ -61,7 +65,7 @@ lanelet::validation::Issues LaneletGeometryValidator::check_lanelet_geometry(
 
     // Issue-001: lanelet has shared points between left and right bounds
     if (!shared_point_ids.empty()) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), lanelet.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id());
     }
   }
 
@@ -14,11 +14,12 @@
 
 #include "lanelet2_map_validator/validators/lane/lateral_subtype_connection.hpp"
 
+#include "lanelet2_map_validator/lane_topology.hpp"
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/geometry/LaneletMap.h>
-#include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
 #include <map>
@@ -62,8 +63,7 @@ void check_adjacent_subtype_compatibility(
     substitution_map["adjacent_lanelet_id"] = std::to_string(adjacent_lane.id());
     substitution_map["adjacent_subtype"] = adjacent_subtype;
     substitution_map["self_adjacent_subtype"] = current_subtype;
-    issues.emplace_back(construct_issue_from_code(
-      issue_code(validator_name, 1), current_lane.id(), substitution_map));
+    add_issue_from_code(issues, issue_code(validator_name, 1), current_lane.id(), substitution_map);
   }
 }
 }  // namespace
@@ -86,19 +86,21 @@ lanelet::validation::Issues LateralSubtypeConnectionValidator::check_lateral_sub
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
     lanelet::traffic_rules::TrafficRulesFactory::create(
       "validator", lanelet::Participants::Vehicle);
-  lanelet::routing::RoutingGraphUPtr routing_graph_ptr =
-    lanelet::routing::RoutingGraph::build(map, *traffic_rules);
+  const LaneTopology lane_topology = LaneTopology::build(map, *traffic_rules);
 
   std::set<std::pair<lanelet::Id, lanelet::Id>> processed_pairs;
 
-  for (const lanelet::ConstLanelet & lane : map.laneletLayer) {
-    const auto left_adjacent = routing_graph_ptr->adjacentLeft(lane);
+  for (const lanelet::ConstLanelet & lane : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
+    const auto left_adjacent = lane_topology.adjacentLeft(lane);
     if (left_adjacent) {
       check_adjacent_subtype_compatibility(
         lane, left_adjacent.get(), processed_pairs, issues, this->name());
     }
 
-    const auto right_adjacent = routing_graph_ptr->adjacentRight(lane);
+    const auto right_adjacent = lane_topology.adjacentRight(lane);
     if (right_adjacent) {
       check_adjacent_subtype_compatibility(
         lane, right_adjacent.get(), processed_pairs, issues, this->name());
@@ -54,7 +54,7 @@ LocalCoordinatesDeclarationValidator::check_local_coordinates_declaration(
       if (local_x || local_y) {
         is_local_mode = true;
         for (const lanelet::Id & id : non_local_point_ids) {
-          issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), id));
+          add_issue_from_code(issues, issue_code(this->name(), 1), id);
         }
       } else {
         non_local_point_ids.insert(point.id());
@@ -64,18 +64,18 @@ LocalCoordinatesDeclarationValidator::check_local_coordinates_declaration(
 
     // Points are assumed to have local_x and local_y from here
     if (!local_x && !local_y) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), point.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), point.id());
       continue;
     }
 
     // Only one coordinate (local_x or local_y) is defined
     if (local_x && !local_y) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), point.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 2), point.id());
       continue;
     }
 
     if (!local_x && local_y) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), point.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 3), point.id());
       continue;
     }
   }
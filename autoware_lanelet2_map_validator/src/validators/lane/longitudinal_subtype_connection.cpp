@@ -14,10 +14,11 @@
 
 #include "lanelet2_map_validator/validators/lane/longitudinal_subtype_connection.hpp"
 
+#include "lanelet2_map_validator/lane_topology.hpp"
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
-#include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
 #include <map>
@@ -51,19 +52,19 @@ LongitudinalSubtypeConnectionValidator::check_longitudinal_subtype_connection(
   lanelet::traffic_rules::TrafficRulesPtr vehicle_rules =
     lanelet::traffic_rules::TrafficRulesFactory::create(
       "validator", lanelet::Participants::Vehicle);
-  lanelet::routing::RoutingGraphUPtr vehicle_routing_graph_ptr =
-    lanelet::routing::RoutingGraph::build(map, *vehicle_rules);
+  const LaneTopology vehicle_topology = LaneTopology::build(map, *vehicle_rules);
 
   lanelet::traffic_rules::TrafficRulesPtr pedestrian_rules =
     lanelet::traffic_rules::TrafficRulesFactory::create(
       "validator", lanelet::Participants::Pedestrian);
-  lanelet::routing::RoutingGraphUPtr pedestrian_routing_graph_ptr =
-    lanelet::routing::RoutingGraph::build(map, *pedestrian_rules);
+  const LaneTopology pedestrian_topology = LaneTopology::build(map, *pedestrian_rules);
 
-  for (const lanelet::ConstLanelet & lane : map.laneletLayer) {
-    const lanelet::ConstLanelets vehicle_successors = vehicle_routing_graph_ptr->following(lane);
-    const lanelet::ConstLanelets pedestrian_successors =
-      pedestrian_routing_graph_ptr->following(lane);
+  for (const lanelet::ConstLanelet & lane : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
+    const lanelet::ConstLanelets vehicle_successors = vehicle_topology.following(lane);
+    const lanelet::ConstLanelets pedestrian_successors = pedestrian_topology.following(lane);
 
     lanelet::ConstLanelets successors;
     successors.reserve(vehicle_successors.size() + pedestrian_successors.size());
@@ -78,13 +79,13 @@ LongitudinalSubtypeConnectionValidator::check_longitudinal_subtype_connection(
 
     const std::string current_subtype = lane.attributeOr(lanelet::AttributeName::Subtype, "");
     if (current_subtype == "crosswalk" || current_subtype == "walkway") {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), lane.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), lane.id());
       continue;
     }
 
     for (const lanelet::ConstLanelet & successor : unique_successors) {
       if (successor.attributeOr(lanelet::AttributeName::Subtype, "") != current_subtype) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), lane.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 2), lane.id());
         break;
       }
     }
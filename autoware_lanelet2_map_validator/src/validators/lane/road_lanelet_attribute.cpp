@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/lane/road_lanelet_attribute.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -40,7 +41,10 @@ lanelet::validation::Issues RoadLaneletAttributeValidator::check_road_lanelet_at
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & lanelet : map.laneletLayer) {
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !lanelet.hasAttribute(lanelet::AttributeName::Subtype) ||
       lanelet.attribute(lanelet::AttributeName::Subtype).value() !=
@@ -51,11 +55,11 @@ lanelet::validation::Issues RoadLaneletAttributeValidator::check_road_lanelet_at
     if (
       !lanelet.hasAttribute("location") || (lanelet.attribute("location").value() != "urban" &&
                                             lanelet.attribute("location").value() != "private")) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), lanelet.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id());
     }
 
     if (!lanelet.hasAttribute("one_way") || lanelet.attribute("one_way").value() != "yes") {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), lanelet.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 2), lanelet.id());
     }
   }
 
@@ -14,11 +14,12 @@
 
 #include "lanelet2_map_validator/validators/lane/road_shoulder.hpp"
 
+#include "lanelet2_map_validator/lane_topology.hpp"
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/geometry/LineString.h>
 #include <lanelet2_core/primitives/Lanelet.h>
-#include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
 #include <string>
@@ -49,10 +50,12 @@ lanelet::validation::Issues RoadShoulderValidator::check_road_shoulder(
     lanelet::traffic_rules::TrafficRulesFactory::create(
       "validator", lanelet::Participants::Vehicle);
 
-  lanelet::routing::RoutingGraphUPtr routing_graph_ptr =
-    lanelet::routing::RoutingGraph::build(map, *traffic_rules);
+  const LaneTopology lane_topology = LaneTopology::build(map, *traffic_rules);
 
-  for (const auto & lanelet : map.laneletLayer) {
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     const auto & attrs = lanelet.attributes();
     const auto & type_it = attrs.find(lanelet::AttributeName::Type);
     const auto & subtype_it = attrs.find(lanelet::AttributeName::Subtype);
@@ -63,14 +66,14 @@ lanelet::validation::Issues RoadShoulderValidator::check_road_shoulder(
       continue;
     }
 
-    const auto left_lanelets = routing_graph_ptr->adjacentLeft(lanelet);
-    const auto right_lanelets = routing_graph_ptr->adjacentRight(lanelet);
+    const auto left_lanelets = lane_topology.adjacentLeft(lanelet);
+    const auto right_lanelets = lane_topology.adjacentRight(lanelet);
     const bool has_left = left_lanelets.has_value();
     const bool has_right = right_lanelets.has_value();
 
     // Issue-001: Road shoulder must have at least one adjacent lanelet
     if (!has_left && !has_right) {
-      issues.push_back(construct_issue_from_code(issue_code(this->name(), 1), lanelet.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id());
       continue;
     }
 
@@ -81,8 +84,7 @@ lanelet::validation::Issues RoadShoulderValidator::check_road_shoulder(
       const auto & bound_type_it = bound_attrs.find(lanelet::AttributeName::Type);
 
       if (bound_type_it == bound_attrs.end() || bound_type_it->second != "road_border") {
-        issues.push_back(
-          construct_issue_from_code(issue_code(this->name(), 3), empty_side_bound.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 3), empty_side_bound.id());
       }
     }
   }
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/lane/speed_limit_validity.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <map>
@@ -40,7 +41,10 @@ lanelet::validation::Issues SpeedLimitValidityValidator::check_speed_limit_valid
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & lanelet : map.laneletLayer) {
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !lanelet.hasAttribute(lanelet::AttributeName::Subtype) ||
       (lanelet.attribute(lanelet::AttributeName::Subtype).value() !=
@@ -63,8 +67,7 @@ lanelet::validation::Issues SpeedLimitValidityValidator::check_speed_limit_valid
           std::map<std::string, std::string> substitution_map;
           substitution_map["speed_limit_value"] = speed_limit_str;
           substitution_map["subtype"] = subtype;
-          issues.emplace_back(
-            construct_issue_from_code(issue_code(this->name(), 1), lanelet.id(), substitution_map));
+          add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id(), substitution_map);
         } else if (speed_limit < min_speed_limit_ || speed_limit > max_speed_limit_) {
           // Issue-002: speed_limit is outside the configured range
           std::map<std::string, std::string> substitution_map;
@@ -72,16 +75,14 @@ lanelet::validation::Issues SpeedLimitValidityValidator::check_speed_limit_valid
           substitution_map["subtype"] = subtype;
           substitution_map["min_speed_limit"] = std::to_string(static_cast<int>(min_speed_limit_));
           substitution_map["max_speed_limit"] = std::to_string(static_cast<int>(max_speed_limit_));
-          issues.emplace_back(
-            construct_issue_from_code(issue_code(this->name(), 2), lanelet.id(), substitution_map));
+          add_issue_from_code(issues, issue_code(this->name(), 2), lanelet.id(), substitution_map);
         }
       } catch (const std::exception &) {
         // Issue-001: speed_limit is not a valid number
         std::map<std::string, std::string> substitution_map;
         substitution_map["speed_limit_value"] = speed_limit_str;
         substitution_map["subtype"] = subtype;
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 1), lanelet.id(), substitution_map));
+        add_issue_from_code(issues, issue_code(this->name(), 1), lanelet.id(), substitution_map);
       }
     }
   }
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/lane/walkway_intersection.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <boost/geometry/algorithms/distance.hpp>
@@ -22,8 +23,6 @@
 #include <lanelet2_core/geometry/LineString.h>
 #include <lanelet2_core/geometry/Polygon.h>
 #include <lanelet2_core/primitives/Lanelet.h>
-#include <lanelet2_routing/RoutingGraph.h>
-#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
 #include <algorithm>
 #include <limits>
@@ -53,17 +52,13 @@ lanelet::validation::Issues WalkwayIntersectionValidator::check_walkway_intersec
 {
   lanelet::validation::Issues issues;
 
-  lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
-    lanelet::traffic_rules::TrafficRulesFactory::create(
-      "validator", lanelet::Participants::Vehicle);
-
-  lanelet::routing::RoutingGraphUPtr routing_graph_ptr =
-    lanelet::routing::RoutingGraph::build(map, *traffic_rules);
-
   std::vector<lanelet::ConstLanelet> walkway_lanelets;
   std::vector<lanelet::ConstLanelet> road_lanelets;
 
-  for (const auto & lanelet : map.laneletLayer) {
+  for (const auto & lanelet : primitives_in_roi(map.laneletLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (!lanelet.hasAttribute(lanelet::AttributeName::Subtype)) {
       continue;
     }
@@ -78,6 +73,10 @@ lanelet::validation::Issues WalkwayIntersectionValidator::check_walkway_intersec
     }
   }
 
+  if (validation_cancelled()) {
+    return issues;
+  }
+
   for (const auto & walkway : walkway_lanelets) {
     const auto walkway_polygon = walkway.polygon2d().basicPolygon();
 
@@ -113,8 +112,7 @@ lanelet::validation::Issues WalkwayIntersectionValidator::check_walkway_intersec
           std::map<std::string, std::string> substitutions_ext;
           substitutions_ext["road_lanelet_id"] = std::to_string(road.id());
           substitutions_ext["extension"] = std::to_string(actual_extension);
-          issues.push_back(construct_issue_from_code(
-            issue_code(this->name(), 2), walkway.id(), substitutions_ext));
+          add_issue_from_code(issues, issue_code(this->name(), 2), walkway.id(), substitutions_ext);
         }
       }
     }
@@ -122,8 +120,7 @@ lanelet::validation::Issues WalkwayIntersectionValidator::check_walkway_intersec
     // Report Issue-001 if no road conflicts were found
     if (!has_road_conflict) {
       std::map<std::string, std::string> substitutions;
-      issues.push_back(
-        construct_issue_from_code(issue_code(this->name(), 1), walkway.id(), substitutions));
+      add_issue_from_code(issues, issue_code(this->name(), 1), walkway.id(), substitutions);
     }
   }
 
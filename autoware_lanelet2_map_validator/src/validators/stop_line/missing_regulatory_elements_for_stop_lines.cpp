@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/stop_line/missing_regulatory_elements_for_stop_lines.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <range/v3/view/filter.hpp>
@@ -50,7 +51,8 @@ MissingRegulatoryElementsForStopLinesValidator::checkMissingRegulatoryElementsFo
   lanelet::validation::Issues issues;
 
   // Get all line strings whose type is stop line
-  auto sl_ids = map.lineStringLayer | ranges::views::filter([](auto && ls) {
+  const auto linestrings = primitives_in_roi(map.lineStringLayer, name());
+  auto sl_ids = linestrings | ranges::views::filter([](auto && ls) {
                   const auto & attrs = ls.attributes();
                   const auto & it = attrs.find(lanelet::AttributeName::Type);
                   return it != attrs.end() && it->second == lanelet::AttributeValueString::StopLine;
@@ -59,7 +61,8 @@ MissingRegulatoryElementsForStopLinesValidator::checkMissingRegulatoryElementsFo
                 ranges::views::unique;
 
   // Filter regulatory elements whose ref_line type is stop line
-  auto reg_elem_sl = map.regulatoryElementLayer | ranges::views::filter([](auto && elem) {
+  const auto reg_elems = primitives_in_roi(map.regulatoryElementLayer, name());
+  auto reg_elem_sl = reg_elems | ranges::views::filter([](auto && elem) {
                        const auto & params = elem->getParameters();
                        return (params.find(lanelet::RoleNameString::RefLine) != params.end()) ||
                               (params.find(lanelet::RoleNameString::Refers) != params.end());
@@ -91,7 +94,7 @@ MissingRegulatoryElementsForStopLinesValidator::checkMissingRegulatoryElementsFo
   // Check if all line strings of stop line referred by regulatory elements
   for (const auto & sl_id : sl_ids) {
     if (sl_ids_reg_elem.find(sl_id) == sl_ids_reg_elem.end()) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), sl_id));
+      add_issue_from_code(issues, issue_code(this->name(), 1), sl_id);
     }
   }
 
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/stop_line/regulatory_element_details_for_traffic_signs.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <range/v3/view/filter.hpp>
@@ -49,8 +50,9 @@ lanelet::validation::Issues RegulatoryElementDetailsForTrafficSignsValidator::
 {
   lanelet::validation::Issues issues;
 
+  const auto reg_elems = primitives_in_roi(map.regulatoryElementLayer, name());
   auto traffic_sign_elements =
-    map.regulatoryElementLayer | ranges::views::filter([](auto && elem) {
+    reg_elems | ranges::views::filter([](auto && elem) {
       return elem->hasAttribute(lanelet::AttributeName::Subtype) &&
              elem->attribute(lanelet::AttributeName::Subtype).value() == "traffic_sign";
     });
@@ -60,8 +62,7 @@ lanelet::validation::Issues RegulatoryElementDetailsForTrafficSignsValidator::
       regulatory_element->getParameters<lanelet::ConstLineString3d>(lanelet::RoleName::Refers);
     if (refers.empty()) {
       // Issue-001: missing refers in traffic_sign regulatory element
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 1), regulatory_element->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), regulatory_element->id());
       continue;
     }
 
@@ -73,7 +74,7 @@ lanelet::validation::Issues RegulatoryElementDetailsForTrafficSignsValidator::
         (type_it == attrs.end() || type_it->second != "traffic_sign") ||
         (subtype_it == attrs.end() || subtype_it->second != "stop_sign")) {
         // Issue-002: Refers linestring either does not have traffic_sign type or stop_sign subtype
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), refer.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 2), refer.id());
         continue;
       }
     }
@@ -82,8 +83,7 @@ lanelet::validation::Issues RegulatoryElementDetailsForTrafficSignsValidator::
       regulatory_element->getParameters<lanelet::ConstLineString3d>(lanelet::RoleName::RefLine);
     if (ref_lines.empty()) {
       // Issue-003: Missing ref_line in traffic_sign regulatory element
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 3), regulatory_element->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 3), regulatory_element->id());
       continue;
     }
 
@@ -92,7 +92,7 @@ lanelet::validation::Issues RegulatoryElementDetailsForTrafficSignsValidator::
       const auto & subtype_it = attrs.find(lanelet::AttributeName::Subtype);
       if (subtype_it == attrs.end() || subtype_it->second != "stop_line") {
         // Issue-004: RefLine linestring does not have stop_line subtype
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 4), ref_line.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 4), ref_line.id());
       }
     }
 
@@ -123,8 +123,7 @@ lanelet::validation::Issues RegulatoryElementDetailsForTrafficSignsValidator::
 
     if (bounding_box_size > max_bounding_box_size_) {
       // Issue-005: Traffic sign regulatory element bounding box exceeds threshold
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 5), regulatory_element->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 5), regulatory_element->id());
     }
   }
 
@@ -15,6 +15,7 @@
 #include "lanelet2_map_validator/validators/traffic_light/body_height.hpp"
 
 #include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <map>
@@ -40,7 +41,10 @@ lanelet::validation::Issues BodyHeightValidator::check_body_height(const lanelet
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & linestring : map.lineStringLayer) {
+  for (const auto & linestring : primitives_in_roi(map.lineStringLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     if (
       !linestring.hasAttribute(lanelet::AttributeName::Type) ||
       linestring.attribute(lanelet::AttributeName::Type).value() !=
@@ -49,7 +53,7 @@ lanelet::validation::Issues BodyHeightValidator::check_body_height(const lanelet
     }
 
     if (!linestring.hasAttribute("height")) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), linestring.id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), linestring.id());
       continue;
     }
 
@@ -60,8 +64,7 @@ lanelet::validation::Issues BodyHeightValidator::check_body_height(const lanelet
       reason_map["min_height"] = std::to_string(min_height_);
       reason_map["max_height"] = std::to_string(max_height_);
       reason_map["actual_height"] = std::to_string(height_value);
-      issues.emplace_back(
-        construct_issue_from_code(issue_code(this->name(), 2), linestring.id(), reason_map));
+      add_issue_from_code(issues, issue_code(this->name(), 2), linestring.id(), reason_map);
     }
   }
 
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/traffic_light/light_bulb_tagging.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -45,7 +46,10 @@ lanelet::validation::Issues LightBulbsTaggingValidator::check_light_bulb_tagging
   std::set<lanelet::Id> validated_bulbs;
 
   // Search from the regulatory element layer since the linestring layer might be too huge
-  for (const auto & reg_elem : map.regulatoryElementLayer) {
+  for (const auto & reg_elem : primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     const auto light_bulbs_linestrings =
       reg_elem->getParameters<lanelet::ConstLineString3d>("light_bulbs");
     for (const lanelet::ConstLineString3d & light_bulbs : light_bulbs_linestrings) {
@@ -56,16 +60,16 @@ lanelet::validation::Issues LightBulbsTaggingValidator::check_light_bulb_tagging
 
       for (const lanelet::ConstPoint3d & bulb : light_bulbs) {
         if (!bulb.hasAttribute("color")) {
-          issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), bulb.id()));
+          add_issue_from_code(issues, issue_code(this->name(), 1), bulb.id());
         } else if (
           expected_colors_.find(bulb.attribute("color").value()) == expected_colors_.end()) {
-          issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), bulb.id()));
+          add_issue_from_code(issues, issue_code(this->name(), 2), bulb.id());
         }
 
         if (
           bulb.hasAttribute("arrow") &&
           expected_arrows_.find(bulb.attribute("arrow").value()) == expected_arrows_.end()) {
-          issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), bulb.id()));
+          add_issue_from_code(issues, issue_code(this->name(), 3), bulb.id());
         }
       }
     }
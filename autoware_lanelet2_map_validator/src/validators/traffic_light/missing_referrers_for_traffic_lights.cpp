@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/traffic_light/missing_referrers_for_traffic_lights.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -42,7 +43,11 @@ MissingReferrersForTrafficLightsValidator::check_missing_referrers_for_traffic_l
 {
   lanelet::validation::Issues issues;
 
-  for (const lanelet::RegulatoryElementConstPtr & reg_elem : map.regulatoryElementLayer) {
+  for (const lanelet::RegulatoryElementConstPtr & reg_elem :
+       primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     // Skip non traffic light regulatory elements
     if (
       reg_elem->attribute(lanelet::AttributeName::Subtype).value() !=
@@ -54,7 +59,7 @@ MissingReferrersForTrafficLightsValidator::check_missing_referrers_for_traffic_l
     const lanelet::ConstLanelets referring_lanelets = map.laneletLayer.findUsages(reg_elem);
 
     if (referring_lanelets.size() == 0) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), reg_elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 1), reg_elem->id());
       continue;
     }
   }
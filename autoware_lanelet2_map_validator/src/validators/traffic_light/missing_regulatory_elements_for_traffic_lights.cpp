@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/traffic_light/missing_regulatory_elements_for_traffic_lights.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <range/v3/view/filter.hpp>
@@ -50,8 +51,9 @@ MissingRegulatoryElementsForTrafficLightsValidator::checkMissingRegulatoryElemen
   lanelet::validation::Issues issues;
 
   // Get all line strings whose type is traffic light
+  const auto linestrings = primitives_in_roi(map.lineStringLayer, name());
   auto tl_ids =
-    map.lineStringLayer | ranges::views::filter([](auto && ls) {
+    linestrings | ranges::views::filter([](auto && ls) {
       const auto & attrs = ls.attributes();
       const auto & it = attrs.find(lanelet::AttributeName::Type);
       return it != attrs.end() && it->second == lanelet::AttributeValueString::TrafficLight;
@@ -59,7 +61,8 @@ MissingRegulatoryElementsForTrafficLightsValidator::checkMissingRegulatoryElemen
     ranges::views::transform([](auto && ls) { return ls.id(); }) | ranges::views::unique;
 
   // Filter regulatory elements whose type is traffic light and has refers
-  auto reg_elem_tl = map.regulatoryElementLayer | ranges::views::filter([](auto && elem) {
+  const auto reg_elems = primitives_in_roi(map.regulatoryElementLayer, name());
+  auto reg_elem_tl = reg_elems | ranges::views::filter([](auto && elem) {
                        const auto & attrs = elem->attributes();
                        const auto & it = attrs.find(lanelet::AttributeName::Subtype);
                        const auto & params = elem->getParameters();
@@ -81,7 +84,7 @@ MissingRegulatoryElementsForTrafficLightsValidator::checkMissingRegulatoryElemen
   // Check if all line strings of traffic light referred by regulatory elements
   for (const auto & tl_id : tl_ids) {
     if (tl_ids_reg_elem.find(tl_id) == tl_ids_reg_elem.end()) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), tl_id));
+      add_issue_from_code(issues, issue_code(this->name(), 1), tl_id);
     }
   }
 
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/traffic_light/regulatory_element_details_for_traffic_lights.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <lanelet2_core/LaneletMap.h>
@@ -88,7 +89,10 @@ RegulatoryElementsDetailsForTrafficLightsValidator::checkRegulatoryElementOfTraf
 {
   lanelet::validation::Issues issues;
 
-  for (const auto & elem : map.regulatoryElementLayer) {
+  for (const auto & elem : primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     // Check through only traffic_light subtype regulatory_elements
     if (
       elem->attribute(lanelet::AttributeName::Subtype).value() !=
@@ -114,7 +118,7 @@ RegulatoryElementsDetailsForTrafficLightsValidator::checkRegulatoryElementOfTraf
           return lane.attributeOr(lanelet::AttributeName::Subtype, "") == std::string("crosswalk");
         });
       if (!is_only_seen_by_crosswalks) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 1), elem->id()));
+        add_issue_from_code(issues, issue_code(this->name(), 1), elem->id());
       }
     }
 
@@ -122,7 +126,7 @@ RegulatoryElementsDetailsForTrafficLightsValidator::checkRegulatoryElementOfTraf
       if (
         refer.attributeOr(lanelet::AttributeName::Type, "") !=
         std::string(lanelet::AttributeValueString::TrafficLight)) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), refer.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 2), refer.id());
       }
     }
 
@@ -130,26 +134,24 @@ RegulatoryElementsDetailsForTrafficLightsValidator::checkRegulatoryElementOfTraf
       if (
         ref_line.attributeOr(lanelet::AttributeName::Type, "") !=
         std::string(lanelet::AttributeValueString::StopLine)) {
-        issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), ref_line.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 3), ref_line.id());
       }
     }
 
     for (const auto & light_bulb : light_bulbs) {
       if (light_bulb.attributeOr(lanelet::AttributeName::Type, "") != std::string("light_bulbs")) {
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 4), light_bulb.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 4), light_bulb.id());
       }
 
       if (!light_bulb.hasAttribute("traffic_light_id")) {
-        issues.emplace_back(
-          construct_issue_from_code(issue_code(this->name(), 5), light_bulb.id()));
+        add_issue_from_code(issues, issue_code(this->name(), 5), light_bulb.id());
       }
     }
 
     if (refers.size() != light_bulbs.size()) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 6), elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 6), elem->id());
     } else if (!isOneByOne(refers, light_bulbs)) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 7), elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 7), elem->id());
     }
 
     lanelet::BoundingBox2d bbox2d;
@@ -189,7 +191,7 @@ RegulatoryElementsDetailsForTrafficLightsValidator::checkRegulatoryElementOfTraf
 
     if (bounding_box_size > max_bounding_box_size_) {
       // Issue-008: Traffic light regulatory element bounding box exceeds threshold
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 8), elem->id()));
+      add_issue_from_code(issues, issue_code(this->name(), 8), elem->id());
     }
   }
   return issues;
@@ -14,6 +14,7 @@
 
 #include "lanelet2_map_validator/validators/traffic_light/traffic_light_facing.hpp"
 
+#include "lanelet2_map_validator/roi.hpp"
 #include "lanelet2_map_validator/utils.hpp"
 
 #include <Eigen/Core>
@@ -67,7 +68,11 @@ lanelet::validation::Issues TrafficLightFacingValidator::check_traffic_light_fac
   std::map<lanelet::Id, int> traffic_light_facing_status;
 
   // Main validation procedure
-  for (const lanelet::RegulatoryElementConstPtr & reg_elem : map.regulatoryElementLayer) {
+  for (const lanelet::RegulatoryElementConstPtr & reg_elem :
+       primitives_in_roi(map.regulatoryElementLayer, name())) {
+    if (validation_cancelled()) {
+      break;
+    }
     // Skip non traffic light regulatory elements
     const auto tl_reg_elem = std::dynamic_pointer_cast<const lanelet::TrafficLight>(reg_elem);
     if (!tl_reg_elem) {
@@ -108,8 +113,7 @@ lanelet::validation::Issues TrafficLightFacingValidator::check_traffic_light_fac
         double cosine_angle =
           pseudo_stop_line.dot(comparing_line) / (pseudo_stop_line.norm() * comparing_line.norm());
         if (cosine_angle < 0.707) {  // about 45 deg
-          issues.emplace_back(
-            construct_issue_from_code(issue_code(this->name(), 1), refers_linestring.id()));
+          add_issue_from_code(issues, issue_code(this->name(), 1), refers_linestring.id());
         }
       }
 
@@ -125,12 +129,16 @@ lanelet::validation::Issues TrafficLightFacingValidator::check_traffic_light_fac
     }
   }
 
+  if (validation_cancelled()) {
+    return issues;
+  }
+
   // Digest the stop line non-existence and the traffic light facing error to issues
   for (const auto & [id, status] : traffic_light_facing_status) {
     if (status == FOUND_WRONG) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 2), id));
+      add_issue_from_code(issues, issue_code(this->name(), 2), id);
     } else if (status == FOUND_AMBIGUOUS) {
-      issues.emplace_back(construct_issue_from_code(issue_code(this->name(), 3), id));
+      add_issue_from_code(issues, issue_code(this->name(), 3), id);
     }
   }
 
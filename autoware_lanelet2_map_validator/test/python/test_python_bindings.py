@@ -0,0 +1,65 @@
+# Copyright 2026 TIER IV, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Smoke test of the Python bindings autoware_lanelet2_map_validator_py."""
+
+import json
+from pathlib import Path
+
+import autoware_lanelet2_map_validator_py as validator
+import numpy as np
+import pytest
+
+PACKAGE_DIRECTORY = Path(__file__).resolve().parents[2]
+SAMPLE_MAP = PACKAGE_DIRECTORY / "test" / "data" / "map" / "sample_map.osm"
+REQUIREMENT_SET = PACKAGE_DIRECTORY / "map_requirements" / "autoware_requirement_set.json"
+
+
+@pytest.fixture(scope="module")
+def session():
+    return validator.ValidationSession.load(str(SAMPLE_MAP), projector_type="mgrs")
+
+
+def test_available_validators():
+    assert "mapping.lane.speed_limit_validity" in validator.available_validators()
+    assert validator.available_validators("mapping.lane.speed_limit_validity") == [
+        "mapping.lane.speed_limit_validity"
+    ]
+
+
+def test_validate_sample_map(session):
+    requirements = REQUIREMENT_SET.read_text()
+    results = session.validate(requirements)
+
+    json_data = json.loads(results.json)
+    assert len(json_data["requirements"]) == len(json.loads(requirements)["requirements"])
+    assert results.passed == all(requirement["passed"] for requirement in json_data["requirements"])
+
+    issues = results.issues
+    assert issues.ids.shape == (len(issues),)
+    assert issues.positions.shape == (len(issues), 2)
+    assert issues.bounding_boxes.shape == (len(issues), 4)
+    assert len(issues.validators) == len(issues.issue_codes) == len(issues.messages) == len(issues)
+    severities = issues.severities
+    assert np.count_nonzero(severities == int(validator.Severity.Error)) == results.errors
+    assert np.count_nonzero(severities == int(validator.Severity.Warning)) == results.warnings
+    assert not issues.ids.flags.writeable
+
+
+def test_map_geometry(session):
+    linestrings = session.linestrings()
+    assert len(linestrings) > 0
+    assert linestrings.offsets.shape == (len(linestrings) + 1,)
+    assert linestrings.offsets[-1] == linestrings.coordinates.shape[0]
+    assert linestrings.coordinates.shape[1] == 2
@@ -12,12 +12,18 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "lanelet2_map_validator/issue_cap.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
 #include "lanelet2_map_validator/validators/area/detection_area.hpp"
 #include "map_validation_tester.hpp"
 
 #include <gtest/gtest.h>
 #include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/RegulatoryElement.h>
+#include <lanelet2_core/utility/Utilities.h>
 
+#include <algorithm>
+#include <memory>
 #include <string>
 
 class TestDetectionAreaValidator : public MapValidationTester
@@ -152,3 +158,44 @@ TEST_F(TestDetectionAreaValidator, DetectionAreaWithNonRoadRefer)  // NOLINT for
   EXPECT_TRUE(difference.empty()) << difference;
   EXPECT_EQ(issues[0].id, expected_reg_elem_id);
 }
+
+TEST_F(TestDetectionAreaValidator, CancelledAfterCollectingPolygons)  // NOLINT for gtest
+{
+  using lanelet::utils::getId;
+
+  // Every regulatory element refers to two detection_area polygons (Issue-002), so that the issue
+  // cap cancels the validator after all polygons are collected but before all regulatory elements
+  // are checked
+  const auto detection_area_polygon = [](const double x) {
+    lanelet::Polygon3d polygon(
+      getId(), {lanelet::Point3d(getId(), x, 0.0, 0.0),
+                lanelet::Point3d(getId(), x + 1.0, 0.0, 0.0),
+                lanelet::Point3d(getId(), x + 1.0, 1.0, 0.0)});
+    polygon.setAttribute(lanelet::AttributeName::Type, "detection_area");
+    return polygon;
+  };
+
+  map_ = std::make_shared<lanelet::LaneletMap>();
+  for (int i = 0; i < 10; i++) {
+    lanelet::RuleParameterMap parameters;
+    parameters[lanelet::RoleNameString::Refers] = {
+      detection_area_polygon(10.0 * i), detection_area_polygon(10.0 * i + 5.0)};
+    auto reg_elem = std::make_shared<lanelet::GenericRegulatoryElement>(getId(), parameters);
+    reg_elem->setAttribute(lanelet::AttributeName::Type, "regulatory_element");
+    reg_elem->setAttribute(lanelet::AttributeName::Subtype, "detection_area");
+    map_->add(reg_elem);
+  }
+
+  auto context = std::make_shared<lanelet::autoware::validation::ValidationContext>();
+  context->issue_cap = std::make_shared<lanelet::autoware::validation::IssueCap>(1, true);
+  const lanelet::autoware::validation::ValidationContext::Scope scope(context);
+
+  lanelet::autoware::validation::DetectionAreaValidator checker;
+  const auto & issues = checker(*map_);
+
+  EXPECT_TRUE(context->issue_cap->exhausted());
+  const std::string unreferenced_code = "[" + issue_code(test_target_, 1) + "]";
+  EXPECT_TRUE(std::none_of(issues.begin(), issues.end(), [&](const auto & issue) {
+    return issue.message.rfind(unreferenced_code, 0) == 0;
+  }));
+}
@@ -15,17 +15,82 @@
 #include "lanelet2_map_validator/validators/intersection/turn_signal_distance_overlap.hpp"
 #include "map_validation_tester.hpp"
 
+#include <boost/geometry.hpp>
+
 #include <gtest/gtest.h>
 #include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
+#include <deque>
 #include <map>
+#include <regex>
 #include <string>
+#include <unordered_set>
+#include <utility>
 
 class TestTurnSignalDistanceOverlapValidator : public MapValidationTester
 {
 protected:
   const std::string test_target_ =
     std::string(lanelet::autoware::validation::TurnSignalDistanceOverlapValidator::name());
+
+  // A breadth-first search from a single turning lanelet over the routing graph, which the
+  // validator has to give the same results as
+  static std::unordered_set<lanelet::Id> search_overlapping_lanelets(
+    const lanelet::ConstLanelet & intersection_lane,
+    const lanelet::routing::RoutingGraphPtr & routing_graph_ptr, const double distance_threshold)
+  {
+    const auto lanelet_length = [](const lanelet::ConstLanelet & lane) {
+      return static_cast<double>(boost::geometry::length(lane.centerline().basicLineString()));
+    };
+
+    std::unordered_set<lanelet::Id> result;
+    std::unordered_set<lanelet::Id> visited;
+    std::deque<std::pair<lanelet::ConstLanelet, double>> queue;
+
+    for (const auto & prev : routing_graph_ptr->previous(intersection_lane)) {
+      queue.emplace_back(prev, lanelet_length(prev));
+    }
+
+    while (!queue.empty()) {
+      auto [current, cum_length] = queue.front();
+      queue.pop_front();
+
+      if (visited.count(current.id()) > 0 || cum_length > distance_threshold) {
+        continue;
+      }
+      visited.insert(current.id());
+
+      const std::string direction = intersection_lane.attribute("turn_direction").value();
+      const std::string current_direction = current.attributeOr("turn_direction", "");
+      if (
+        (direction == "left" && current_direction == "right") ||
+        (direction == "right" && current_direction == "left")) {
+        result.insert(current.id());
+      }
+
+      for (const auto & prev : routing_graph_ptr->previous(current)) {
+        queue.emplace_back(prev, cum_length + lanelet_length(prev));
+      }
+    }
+    return result;
+  }
+
+  // The lanelet IDs listed in the issue message
+  std::unordered_set<lanelet::Id> listed_lanelet_ids(const std::string & message) const
+  {
+    std::unordered_set<lanelet::Id> ids;
+    const std::regex number("[0-9]+");
+    for (auto it = std::sregex_iterator(message.begin(), message.end(), number);
+         it != std::sregex_iterator(); ++it) {
+      const lanelet::Id id = std::stoll(it->str());
+      if (map_->laneletLayer.exists(id)) {
+        ids.insert(id);
+      }
+    }
+    return ids;
+  }
 };
 
 TEST_F(TestTurnSignalDistanceOverlapValidator, ValidatorAvailability)  // NOLINT for gtest
@@ -77,3 +142,41 @@ TEST_F(TestTurnSignalDistanceOverlapValidator, SampleMap)  // NOLINT for gtest
 
   EXPECT_EQ(issues.size(), 0);
 }
+
+TEST_F(TestTurnSignalDistanceOverlapValidator, SameAsSearchingFromEachLanelet)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  // Every lanelet turns, with various turn_signal_distance values, so that the searches from many
+  // turning lanelets pass through the same lanelets and reach them through paths of different
+  // lengths
+  for (auto lanelet : map_->laneletLayer) {
+    lanelet.setAttribute("turn_direction", std::string(lanelet.id() % 2 == 0 ? "left" : "right"));
+    lanelet.setAttribute(
+      "turn_signal_distance", 20.0 + 40.0 * static_cast<double>(lanelet.id() % 5));
+  }
+
+  lanelet::autoware::validation::TurnSignalDistanceOverlapValidator checker;
+  const auto & issues = checker(*map_);
+
+  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    lanelet::Locations::Germany, lanelet::Participants::Vehicle);
+  const auto routing_graph_ptr = lanelet::routing::RoutingGraph::build(*map_, *traffic_rules);
+
+  std::map<lanelet::Id, std::unordered_set<lanelet::Id>> expected_ids;
+  for (const auto & lanelet : map_->laneletLayer) {
+    const auto overlapping_lanelets = search_overlapping_lanelets(
+      lanelet, routing_graph_ptr, lanelet.attribute("turn_signal_distance").asDouble().value());
+    if (!overlapping_lanelets.empty()) {
+      expected_ids[lanelet.id()] = overlapping_lanelets;
+    }
+  }
+
+  ASSERT_FALSE(expected_ids.empty());
+  EXPECT_EQ(issues.size(), expected_ids.size());
+  for (const auto & issue : issues) {
+    ASSERT_EQ(expected_ids.count(issue.id), 1u) << "lanelet " << issue.id;
+    EXPECT_EQ(listed_lanelet_ids(issue.message), expected_ids.at(issue.id))
+      << "lanelet " << issue.id;
+  }
+}
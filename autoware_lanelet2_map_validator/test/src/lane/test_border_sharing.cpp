@@ -17,9 +17,15 @@
 
 #include <gtest/gtest.h>
 #include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/geometry/LineString.h>
+#include <lanelet2_core/utility/Utilities.h>
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 class TestBorderSharingValidator : public MapValidationTester
 {
@@ -232,3 +238,91 @@ TEST_F(TestBorderSharingValidator, SampleMap)  // NOLINT for gtest
 
   EXPECT_EQ(issues.size(), 0);
 }
+
+TEST_F(TestBorderSharingValidator, BentLaneletIsExpandedAlongTheMiter)  // NOLINT for gtest
+{
+  // A lanelet 3 m wide turning left by 60 degrees at its middle
+  const double half_width = 1.5;
+  const double angle = M_PI / 3;
+  const lanelet::BasicPoint2d corner(10.0, 0.0);
+  const lanelet::BasicPoint2d end =
+    corner + 10.0 * lanelet::BasicPoint2d(std::cos(angle), std::sin(angle));
+  const lanelet::BasicPoint2d first_normal(0.0, 1.0);
+  const lanelet::BasicPoint2d second_normal(-std::sin(angle), std::cos(angle));
+  const lanelet::BasicPoint2d corner_shift =
+    (first_normal + second_normal) / (1.0 + first_normal.dot(second_normal));
+  const auto bound = [&](const double offset) {
+    using lanelet::utils::getId;
+    const std::vector<lanelet::BasicPoint2d> points = {
+      offset * first_normal, corner + offset * corner_shift, end + offset * second_normal};
+    lanelet::LineString3d line_string(getId());
+    for (const auto & point : points) {
+      line_string.push_back(lanelet::Point3d(getId(), point.x(), point.y(), 0.0));
+    }
+    return line_string;
+  };
+  const lanelet::ConstLanelet lane(lanelet::utils::getId(), bound(half_width), bound(-half_width));
+
+  const double scale_factor = 1.05;
+  const double delta = 2.0 * half_width * (scale_factor - 1);
+  lanelet::autoware::validation::BorderSharingValidator checker;
+  const auto expanded = checker.expanded_lanelet_polygon(lane, scale_factor);
+
+  // The baseline shifts every point with the arc coordinates of its bound
+  lanelet::BasicPolygon2d baseline;
+  for (const auto & line_string :
+       {lane.leftBound2d().basicLineString(), lane.rightBound2d().invert().basicLineString()}) {
+    for (size_t i = 0; i < line_string.size(); i++) {
+      lanelet::ArcCoordinates arc_point =
+        lanelet::geometry::toArcCoordinates(line_string, line_string[i]);
+      arc_point.distance += delta;
+      lanelet::BasicPoint2d point = lanelet::geometry::fromArcCoordinates(line_string, arc_point);
+      if (i == 0) {
+        point += delta * (line_string[0] - line_string[1]).normalized();
+      }
+      if (i + 1 == line_string.size()) {
+        point += delta * (line_string[i] - line_string[i - 1]).normalized();
+      }
+      baseline.push_back(point);
+    }
+  }
+  ASSERT_EQ(expanded.polygon.size(), baseline.size());
+
+  // The end points are the same as the baseline, and the bends are shifted to where both shifted
+  // segments of the bound meet, delta away from both segments
+  for (const size_t i : {0, 2, 3, 5}) {
+    EXPECT_NEAR((expanded.polygon[i] - baseline[i]).norm(), 0.0, 1e-9) << "point " << i;
+  }
+  const auto distance_to_line = [](
+                                  const lanelet::BasicPoint2d & point,
+                                  const lanelet::BasicPoint2d & from,
+                                  const lanelet::BasicPoint2d & to) {
+    const lanelet::BasicPoint2d direction = (to - from).normalized();
+    const lanelet::BasicPoint2d relative = point - from;
+    return std::abs(direction.x() * relative.y() - direction.y() * relative.x());
+  };
+  const std::vector<std::pair<size_t, lanelet::BasicLineString2d>> bends = {
+    {1, lane.leftBound2d().basicLineString()},
+    {4, lane.rightBound2d().invert().basicLineString()}};
+  for (const auto & [i, line_string] : bends) {
+    const double first_distance =
+      distance_to_line(expanded.polygon[i], line_string[0], line_string[1]);
+    const double second_distance =
+      distance_to_line(expanded.polygon[i], line_string[1], line_string[2]);
+    EXPECT_NEAR(first_distance, delta, 1e-9) << "point " << i;
+    EXPECT_NEAR(second_distance, delta, 1e-9) << "point " << i;
+
+    // The baseline only keeps one of the shifted segments delta away at the bend
+    const double baseline_first_distance =
+      distance_to_line(baseline[i], line_string[0], line_string[1]);
+    const double baseline_second_distance =
+      distance_to_line(baseline[i], line_string[1], line_string[2]);
+    EXPECT_NEAR(
+      std::min(
+        std::abs(baseline_first_distance - delta), std::abs(baseline_second_distance - delta)),
+      0.0, 1e-9)
+      << "point " << i;
+    EXPECT_NEAR((expanded.polygon[i] - line_string[1]).norm(), delta / std::cos(angle / 2), 1e-9)
+      << "point " << i;
+  }
+}
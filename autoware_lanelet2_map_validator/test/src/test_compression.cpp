@@ -0,0 +1,124 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/compression.hpp"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+
+class CompressionTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    directory_ = std::filesystem::temp_directory_path() /
+                 ("test_compression_" + std::to_string(::getpid()));
+    std::filesystem::create_directories(directory_);
+
+    // Several megabytes of moderately compressible text, larger than the read ahead of the reader
+    for (int i = 0; contents_.size() < (5 << 20); ++i) {
+      contents_ += "  <node id=\"" + std::to_string(i) + "\" lat=\"35." + std::to_string(i * 7919) +
+                   "\" lon=\"139." + std::to_string(i * 104729) + "\"/>\n";
+    }
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  std::filesystem::path write_compressed(const std::string & file_name)
+  {
+    const std::filesystem::path file = directory_ / file_name;
+    CompressingOutputStream output(file, compression_of(file));
+    output << contents_;
+    output.finish();
+    return file;
+  }
+
+  static std::string read_decompressed(const std::filesystem::path & file)
+  {
+    DecompressingInputStream input(file);
+    std::string text{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+    input.rethrow_error();
+    return text;
+  }
+
+  std::filesystem::path directory_;
+  std::string contents_;
+};
+
+TEST(CompressionOfTest, ExtensionSelectsTheCompression)  // NOLINT for gtest
+{
+  EXPECT_EQ(compression_of("map.osm"), Compression::NONE);
+  EXPECT_EQ(compression_of("map.osm.gz"), Compression::GZIP);
+  EXPECT_EQ(compression_of("dir.gz/map.osm.zst"), Compression::ZSTD);
+  EXPECT_EQ(compression_of("map.gzip"), Compression::NONE);
+}
+
+TEST_F(CompressionTest, GzipRoundTrip)  // NOLINT for gtest
+{
+  const auto file = write_compressed("map.osm.gz");
+  EXPECT_LT(std::filesystem::file_size(file), contents_.size());
+  EXPECT_EQ(read_decompressed(file), contents_);
+}
+
+TEST_F(CompressionTest, ZstdRoundTrip)  // NOLINT for gtest
+{
+  const auto file = write_compressed("map.osm.zst");
+  EXPECT_LT(std::filesystem::file_size(file), contents_.size());
+  EXPECT_EQ(read_decompressed(file), contents_);
+}
+
+TEST_F(CompressionTest, ReaderCanStopEarly)  // NOLINT for gtest
+{
+  const auto file = write_compressed("map.osm.zst");
+  DecompressingInputStream input(file);
+  std::string line;
+  ASSERT_TRUE(std::getline(input, line));
+  EXPECT_EQ(line + "\n", contents_.substr(0, line.size() + 1));
+  // Destroying the stream stops the background thread blocked on the full queue
+}
+
+TEST_F(CompressionTest, TruncatedFileIsAnError)  // NOLINT for gtest
+{
+  for (const std::string file_name : {"map.osm.gz", "map.osm.zst"}) {
+    const auto file = write_compressed(file_name);
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) / 2);
+    EXPECT_THROW(read_decompressed(file), std::runtime_error) << file_name;
+  }
+}
+
+TEST_F(CompressionTest, CorruptedFileIsAnError)  // NOLINT for gtest
+{
+  for (const std::string file_name : {"map.osm.gz", "map.osm.zst"}) {
+    const std::filesystem::path file = directory_ / file_name;
+    std::ofstream(file) << contents_.substr(0, 1000);
+    EXPECT_THROW(read_decompressed(file), std::runtime_error) << file_name;
+  }
+}
+
+TEST_F(CompressionTest, MissingFileIsAnError)  // NOLINT for gtest
+{
+  EXPECT_THROW(DecompressingInputStream(directory_ / "missing.osm.gz"), std::runtime_error);
+}
+
+}  // namespace lanelet::autoware::validation
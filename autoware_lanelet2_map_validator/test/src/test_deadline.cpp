@@ -0,0 +1,186 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/cli.hpp"
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
+#include "lanelet2_map_validator/validators/lane/lanelet_geometry.hpp"
+#include "lanelet2_map_validator/validators/lane/speed_limit_validity.hpp"
+#include "map_validation_tester.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class DeadlineTest : public MapValidationTester
+{
+protected:
+  // speed_limit_validity and lanelet_geometry, which depends on it
+  static nlohmann::json requirements()
+  {
+    return nlohmann::json::parse(R"({
+      "requirements": [{
+        "id": "requirement",
+        "validators": [
+          {"name": "mapping.lane.speed_limit_validity"},
+          {
+            "name": "mapping.lane.lanelet_geometry",
+            "prerequisites": [{"name": "mapping.lane.speed_limit_validity"}]
+          }
+        ]
+      }]
+    })");
+  }
+
+  static bool has_issue_code(const nlohmann::json & validator, const std::string & issue_code)
+  {
+    for (const auto & issue : validator.value("issues", nlohmann::json::array())) {
+      if (issue.value("issue_code", "") == issue_code) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  nlohmann::json validate(const MetaConfig & meta_config)
+  {
+    nlohmann::json json_data = requirements();
+    validate_all_requirements(
+      json_data, meta_config, *map_,
+      import_exclusion_list(nlohmann::json{{"exclusion", nlohmann::json::array()}}));
+    return json_data;
+  }
+};
+
+TEST_F(DeadlineTest, ValidationCancelledFollowsTheDeadline)  // NOLINT for gtest
+{
+  const auto with_deadline = [](const std::chrono::steady_clock::time_point & deadline) {
+    auto context = std::make_shared<ValidationContext>();
+    context->deadline = deadline;
+    context->deadline_hit = std::make_shared<std::atomic<bool>>(false);
+    return context;
+  };
+  EXPECT_FALSE(validation_cancelled());
+  {
+    const auto context = with_deadline(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    const ValidationContext::Scope scope(context);
+    EXPECT_FALSE(validation_cancelled());
+    EXPECT_FALSE(context->deadline_hit->load());
+  }
+  {
+    const auto context = with_deadline(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+    const ValidationContext::Scope scope(context);
+    EXPECT_TRUE(validation_cancelled());
+    EXPECT_TRUE(context->deadline_hit->load());
+
+    // Parallel loops over the primitives stop as well
+    const std::vector<int> elements(1000, 1);
+    const auto collected = parallel_collect<int>(
+      elements, [](const int element, std::vector<int> & output) { output.push_back(element); });
+    EXPECT_TRUE(collected.empty());
+  }
+  EXPECT_FALSE(validation_cancelled());
+}
+
+TEST_F(DeadlineTest, NoDeadlineByDefault)  // NOLINT for gtest
+{
+  const MetaConfig meta_config;
+  EXPECT_FALSE(global_deadline(meta_config));
+  EXPECT_FALSE(validator_deadline(meta_config, std::chrono::steady_clock::now()));
+
+  load_target_map("sample_map.osm");
+  const nlohmann::json json_data = validate(meta_config);
+  for (const auto & validator : json_data["requirements"][0]["validators"]) {
+    EXPECT_FALSE(validator.contains("outcome"));
+    EXPECT_FALSE(has_issue_code(validator, "General.ValidationTimeout-001"));
+  }
+}
+
+TEST_F(DeadlineTest, ValidatorDeadlineIsTheEarlierOne)  // NOLINT for gtest
+{
+  MetaConfig meta_config;
+  meta_config.timeout_per_validator = 10.0;
+  meta_config.global_deadline = 60.0;
+
+  const auto start = meta_config.start_time + std::chrono::seconds(5);
+  EXPECT_EQ(*validator_deadline(meta_config, start), start + std::chrono::seconds(10));
+
+  const auto late_start = meta_config.start_time + std::chrono::seconds(55);
+  EXPECT_EQ(*validator_deadline(meta_config, late_start), *global_deadline(meta_config));
+}
+
+TEST_F(DeadlineTest, TimedOutValidatorFailsItsDependents)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  MetaConfig meta_config;
+  meta_config.timeout_per_validator = 1e-9;
+  const nlohmann::json json_data = validate(meta_config);
+
+  const nlohmann::json & timed_out = json_data["requirements"][0]["validators"][0];
+  EXPECT_EQ(timed_out.value("outcome", ""), "timeout");
+  EXPECT_FALSE(timed_out["passed"].get<bool>());
+  EXPECT_TRUE(has_issue_code(timed_out, "General.ValidationTimeout-001"));
+
+  const nlohmann::json & dependent = json_data["requirements"][0]["validators"][1];
+  EXPECT_FALSE(dependent.contains("outcome"));
+  EXPECT_FALSE(dependent["passed"].get<bool>());
+  EXPECT_TRUE(has_issue_code(dependent, "General.PrerequisitesFailure-001"));
+}
+
+TEST_F(DeadlineTest, ValidatorNotStoppedByItsDeadlineKeepsItsResults)  // NOLINT for gtest
+{
+  // Without any lanelet, the validators finish without checking their deadline
+  map_ = std::make_shared<lanelet::LaneletMap>();
+
+  MetaConfig meta_config;
+  meta_config.timeout_per_validator = 1e-9;
+  const nlohmann::json json_data = validate(meta_config);
+
+  for (const auto & validator : json_data["requirements"][0]["validators"]) {
+    EXPECT_FALSE(validator.contains("outcome"));
+    EXPECT_TRUE(validator["passed"].get<bool>());
+    EXPECT_FALSE(has_issue_code(validator, "General.ValidationTimeout-001"));
+  }
+}
+
+TEST_F(DeadlineTest, ValidatorsAfterTheGlobalDeadlineAreNotRun)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  MetaConfig meta_config;
+  meta_config.global_deadline = 1.0;
+  meta_config.start_time = std::chrono::steady_clock::now() - std::chrono::seconds(2);
+  const nlohmann::json json_data = validate(meta_config);
+
+  const nlohmann::json & not_run = json_data["requirements"][0]["validators"][0];
+  EXPECT_EQ(not_run.value("outcome", ""), "timeout");
+  ASSERT_EQ(not_run["issues"].size(), 1u);
+  EXPECT_EQ(not_run["issues"][0]["issue_code"], "General.ValidationTimeout-001");
+  EXPECT_FALSE(json_data["requirements"][0]["validators"][1]["passed"].get<bool>());
+}
+
+}  // namespace lanelet::autoware::validation
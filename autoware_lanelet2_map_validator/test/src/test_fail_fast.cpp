@@ -0,0 +1,220 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/cli.hpp"
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/fail_fast.hpp"
+#include "lanelet2_map_validator/utils.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
+#include "map_validation_tester.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class FailFastTest : public MapValidationTester
+{
+protected:
+  // speed_limit_validity with lanelet_geometry depending on it, and centerline_geometry with
+  // road_shoulder depending on it. Validators without prerequisites run first in any order, so
+  // road_shoulder always runs after speed_limit_validity.
+  static nlohmann::json requirements()
+  {
+    return nlohmann::json::parse(R"({
+      "requirements": [{
+        "id": "requirement",
+        "validators": [
+          {"name": "mapping.lane.speed_limit_validity"},
+          {
+            "name": "mapping.lane.lanelet_geometry",
+            "prerequisites": [{"name": "mapping.lane.speed_limit_validity"}]
+          },
+          {"name": "mapping.lane.centerline_geometry"},
+          {
+            "name": "mapping.lane.road_shoulder",
+            "prerequisites": [{"name": "mapping.lane.centerline_geometry"}]
+          }
+        ]
+      }]
+    })");
+  }
+
+  nlohmann::json validate(const MetaConfig & meta_config, const nlohmann::json & exclusion_list)
+  {
+    nlohmann::json json_data = requirements();
+    validate_all_requirements(json_data, meta_config, *map_, import_exclusion_list(exclusion_list));
+    return json_data;
+  }
+
+  static const nlohmann::json & find_validator(
+    const nlohmann::json & json_data, const std::string & name)
+  {
+    for (const auto & validator : json_data["requirements"][0]["validators"]) {
+      if (validator["name"] == name) {
+        return validator;
+      }
+    }
+    throw std::invalid_argument("No validator " + name);
+  }
+
+  static nlohmann::json no_exclusion() { return {{"exclusion", nlohmann::json::array()}}; }
+};
+
+TEST_F(FailFastTest, FailsAtTheFirstErrorNotExcluded)  // NOLINT for gtest
+{
+  FailFast fail_fast({{"lanelet", 10}});
+
+  lanelet::validation::Issue warning(
+    lanelet::validation::Severity::Warning, lanelet::validation::Primitive::Lanelet, 20, "");
+  fail_fast.report(warning);
+  EXPECT_FALSE(fail_fast.failed());
+
+  lanelet::validation::Issue excluded_error(
+    lanelet::validation::Severity::Error, lanelet::validation::Primitive::Lanelet, 10, "");
+  fail_fast.report(excluded_error);
+  EXPECT_FALSE(fail_fast.failed());
+
+  lanelet::validation::Issue error(
+    lanelet::validation::Severity::Error, lanelet::validation::Primitive::Lanelet, 20, "");
+  fail_fast.report(error);
+  EXPECT_TRUE(fail_fast.failed());
+}
+
+TEST_F(FailFastTest, SharedFailureStopsTheOtherValidators)  // NOLINT for gtest
+{
+  const auto run_failure = std::make_shared<std::atomic<bool>>(false);
+  FailFast failing({}, run_failure);
+  FailFast other({}, run_failure);
+  FailFast speculative({}, run_failure, false);
+
+  lanelet::validation::Issue error(
+    lanelet::validation::Severity::Error, lanelet::validation::Primitive::Lanelet, 20, "");
+
+  // An error of a validator that may be discarded only stops itself
+  speculative.report(error);
+  EXPECT_TRUE(speculative.failed());
+  EXPECT_FALSE(speculative.failed_run());
+  EXPECT_FALSE(failing.failed());
+  EXPECT_FALSE(other.failed());
+
+  failing.report(error);
+  EXPECT_TRUE(failing.failed_run());
+  EXPECT_TRUE(other.failed());
+  EXPECT_FALSE(other.failed_run());
+
+  // Only the validators stopped without an error of their own are stopped by another one
+  auto context = std::make_shared<ValidationContext>();
+  context->fail_fast = std::make_shared<FailFast>(std::vector<SimplePrimitive>{}, run_failure);
+  {
+    const ValidationContext::Scope scope(context);
+    EXPECT_TRUE(validation_cancelled());
+  }
+  EXPECT_TRUE(context->fail_fast->stopped_by_other_validator());
+  failing.notify_cancelled();
+  EXPECT_FALSE(failing.stopped_by_other_validator());
+}
+
+TEST_F(FailFastTest, AddedErrorsCancelTheValidator)  // NOLINT for gtest
+{
+  const auto fail_fast = std::make_shared<FailFast>(std::vector<SimplePrimitive>{});
+  auto context = std::make_shared<ValidationContext>();
+  context->fail_fast = fail_fast;
+  const ValidationContext::Scope scope(context);
+
+  lanelet::validation::Issues issues;
+  add_issue_from_code(issues, "Intersection.RightOfWayWithoutTrafficLights-001", 1);
+  EXPECT_FALSE(validation_cancelled());
+
+  add_issue_from_code(
+    issues, "Lane.SpeedLimitValidity-001", 2, {{"subtype", "road"}, {"speed_limit_value", "-10"}});
+  EXPECT_TRUE(validation_cancelled());
+  EXPECT_EQ(issues.size(), 2u);
+}
+
+TEST_F(FailFastTest, RemainingValidatorsAreCancelled)  // NOLINT for gtest
+{
+  load_target_map("lane/speed_limit_with_negative_value.osm");
+
+  MetaConfig meta_config;
+  meta_config.fail_fast = true;
+  const nlohmann::json json_data = validate(meta_config, no_exclusion());
+
+  const auto & failed = find_validator(json_data, "mapping.lane.speed_limit_validity");
+  EXPECT_FALSE(failed["passed"].get<bool>());
+  EXPECT_FALSE(failed.contains("outcome"));
+
+  // The dependent validator is skipped as usual, and the other one is not run
+  const auto & dependent = find_validator(json_data, "mapping.lane.lanelet_geometry");
+  EXPECT_FALSE(dependent.contains("outcome"));
+  EXPECT_EQ(dependent["issues"][0]["issue_code"], "General.PrerequisitesFailure-001");
+
+  // centerline_geometry is cancelled if it comes after speed_limit_validity, and road_shoulder
+  // otherwise
+  size_t cancelled_count = 0;
+  const std::vector<std::string> names = {
+    "mapping.lane.centerline_geometry", "mapping.lane.road_shoulder"};
+  for (const auto & name : names) {
+    const auto & validator = find_validator(json_data, name);
+    if (validator.value("outcome", "") != "cancelled") {
+      continue;
+    }
+    cancelled_count++;
+    EXPECT_FALSE(validator["passed"].get<bool>());
+    ASSERT_EQ(validator["issues"].size(), 1u);
+    EXPECT_EQ(validator["issues"][0]["issue_code"], "General.ValidationCancelled-001");
+  }
+  EXPECT_EQ(cancelled_count, 1u);
+}
+
+TEST_F(FailFastTest, ExcludedErrorsDoNotStopTheValidation)  // NOLINT for gtest
+{
+  load_target_map("lane/speed_limit_with_negative_value.osm");
+
+  MetaConfig meta_config;
+  meta_config.fail_fast = true;
+  const nlohmann::json all_issues = validate(meta_config, no_exclusion());
+  const auto & error = find_validator(all_issues, "mapping.lane.speed_limit_validity")["issues"][0];
+
+  nlohmann::json exclusion_list = no_exclusion();
+  exclusion_list["exclusion"].push_back({{"primitive", error["primitive"]}, {"id", error["id"]}});
+  const nlohmann::json json_data = validate(meta_config, exclusion_list);
+
+  for (const auto & validator : json_data["requirements"][0]["validators"]) {
+    EXPECT_FALSE(validator.contains("outcome")) << validator["name"];
+  }
+  EXPECT_TRUE(find_validator(json_data, "mapping.lane.speed_limit_validity")["passed"].get<bool>());
+}
+
+TEST_F(FailFastTest, NoCancellationByDefault)  // NOLINT for gtest
+{
+  load_target_map("lane/speed_limit_with_negative_value.osm");
+
+  const nlohmann::json json_data = validate(MetaConfig(), no_exclusion());
+  for (const auto & validator : json_data["requirements"][0]["validators"]) {
+    EXPECT_FALSE(validator.contains("outcome")) << validator["name"];
+  }
+}
+
+}  // namespace lanelet::autoware::validation
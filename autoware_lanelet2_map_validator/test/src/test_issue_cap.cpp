@@ -0,0 +1,190 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/cli.hpp"
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/issue_cap.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
+#include "lanelet2_map_validator/utils.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
+#include "map_validation_tester.hpp"
+
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class IssueCapTest : public MapValidationTester
+{
+protected:
+  const std::string error_code = "Lane.LocalCoordinatesDeclaration-001";
+  const std::string other_code = "Lane.SpeedLimitValidity-001";
+  const std::string info_code = "Intersection.RightOfWayWithoutTrafficLights-001";
+};
+
+TEST_F(IssueCapTest, IssuesPastTheCapAreSummarized)  // NOLINT for gtest
+{
+  const auto issue_cap = std::make_shared<IssueCap>(2);
+  auto context = std::make_shared<ValidationContext>();
+  context->issue_cap = issue_cap;
+  const ValidationContext::Scope scope(context);
+
+  lanelet::validation::Issues issues;
+  for (lanelet::Id id = 1; id <= 20; id++) {
+    add_issue_from_code(issues, error_code, id);
+  }
+  add_issue_from_code(
+    issues, other_code, 100, {{"subtype", "road"}, {"speed_limit_value", "-10"}});
+
+  ASSERT_EQ(issues.size(), 3u);
+  EXPECT_EQ(issues[0].id, 1);
+  EXPECT_EQ(issues[1].id, 2);
+  EXPECT_EQ(issues[2].id, 100);
+  EXPECT_EQ(issue_cap->suppressed_count(), 18u);
+  EXPECT_FALSE(issue_cap->exhausted());
+  EXPECT_FALSE(validation_cancelled());
+
+  const lanelet::validation::Issues summary_issues = issue_cap->summary_issues();
+  ASSERT_EQ(summary_issues.size(), 1u);
+  EXPECT_EQ(summary_issues[0].severity, lanelet::validation::Severity::Error);
+  EXPECT_EQ(summary_issues[0].id, lanelet::InvalId);
+  const std::string & message = summary_issues[0].message;
+  EXPECT_EQ(message.rfind("[General.IssuesSuppressed-001] 18 more issues of " + error_code, 0), 0u);
+  EXPECT_NE(message.find("3, 4, 5, 6, 7, 8, 9, 10, 11, 12, ..."), std::string::npos);
+}
+
+TEST_F(IssueCapTest, NoCapByDefault)  // NOLINT for gtest
+{
+  lanelet::validation::Issues issues;
+  for (lanelet::Id id = 1; id <= 20; id++) {
+    add_issue_from_code(issues, error_code, id);
+  }
+  EXPECT_EQ(issues.size(), 20u);
+
+  EXPECT_EQ(create_issue_cap(MetaConfig(), *ValidatorConfigStore::current(), "any"), nullptr);
+  EXPECT_THROW(IssueCap(0), std::invalid_argument);
+}
+
+TEST_F(IssueCapTest, StopAtCapOnlyForFailures)  // NOLINT for gtest
+{
+  const auto issue_cap = std::make_shared<IssueCap>(1, true);
+  auto context = std::make_shared<ValidationContext>();
+  context->issue_cap = issue_cap;
+  const ValidationContext::Scope scope(context);
+
+  lanelet::validation::Issues issues;
+  add_issue_from_code(issues, info_code, 1);
+  add_issue_from_code(issues, info_code, 2);
+  EXPECT_FALSE(issue_cap->exhausted());
+
+  add_issue_from_code(issues, error_code, 1);
+  EXPECT_FALSE(issue_cap->exhausted());
+  add_issue_from_code(issues, error_code, 2);
+  EXPECT_TRUE(issue_cap->exhausted());
+  EXPECT_TRUE(validation_cancelled());
+  EXPECT_EQ(issues.size(), 2u);
+}
+
+TEST_F(IssueCapTest, ParallelIssuesAreCountedOnce)  // NOLINT for gtest
+{
+  const auto issue_cap = std::make_shared<IssueCap>(100);
+  auto context = std::make_shared<ValidationContext>();
+  context->issue_cap = issue_cap;
+  const ValidationContext::Scope scope(context);
+
+  std::vector<lanelet::Id> ids(10000);
+  std::iota(ids.begin(), ids.end(), 1);
+  const auto issues = parallel_collect<lanelet::validation::Issue>(
+    ids, [&](const lanelet::Id id, lanelet::validation::Issues & output) {
+      add_issue_from_code(output, error_code, id);
+    });
+
+  EXPECT_EQ(issues.size(), 100u);
+  EXPECT_EQ(issue_cap->suppressed_count(), 9900u);
+}
+
+TEST_F(IssueCapTest, ParallelIssuesPassTheCapAsInASerialLoop)  // NOLINT for gtest
+{
+  // Issues of two codes, where the second one only appears in the later chunks
+  std::vector<lanelet::Id> ids(1000);
+  std::iota(ids.begin(), ids.end(), 1);
+  const auto add_issues = [&](const lanelet::Id id, lanelet::validation::Issues & output) {
+    add_issue_from_code(output, error_code, id);
+    if (id > 600 && id % 3 == 0) {
+      add_issue_from_code(
+        output, other_code, id, {{"subtype", "road"}, {"speed_limit_value", "-10"}});
+    }
+  };
+  const auto collect = [&](const size_t jobs) {
+    set_parallel_jobs(jobs);
+    const auto issue_cap = std::make_shared<IssueCap>(150);
+    auto context = std::make_shared<ValidationContext>();
+    context->issue_cap = issue_cap;
+    const ValidationContext::Scope scope(context);
+    auto issues = parallel_collect<lanelet::validation::Issue>(ids, add_issues);
+    const auto summary_issues = issue_cap->summary_issues();
+    issues.insert(issues.end(), summary_issues.begin(), summary_issues.end());
+    return std::make_pair(issues, issue_cap->suppressed_count());
+  };
+
+  const auto serial_results = collect(1);
+  for (int trial = 0; trial < 10; trial++) {
+    const auto parallel_results = collect(4);
+    EXPECT_EQ(parallel_results.second, serial_results.second);
+    ASSERT_EQ(parallel_results.first.size(), serial_results.first.size());
+    for (size_t i = 0; i < serial_results.first.size(); i++) {
+      EXPECT_EQ(parallel_results.first[i].id, serial_results.first[i].id);
+      EXPECT_EQ(parallel_results.first[i].message, serial_results.first[i].message);
+    }
+  }
+  set_parallel_jobs(0);
+
+  // The first issues of each code are listed and the rest are summarized in their order
+  EXPECT_EQ(serial_results.second, 850u);
+  EXPECT_EQ(serial_results.first.front().id, 1);
+  const std::string & summary_message = serial_results.first.back().message;
+  EXPECT_NE(
+    summary_message.find("151, 152, 153, 154, 155, 156, 157, 158, 159, 160, ..."),
+    std::string::npos);
+}
+
+TEST_F(IssueCapTest, ValidatorParameterOverridesTheCommandLine)  // NOLINT for gtest
+{
+  const std::string validator_name = "mapping.lane.local_coordinates_declaration";
+  const auto config = std::make_shared<const ValidatorConfig>(
+    YAML::Load(validator_name + ":\n  max_issues_per_code: 5\n"),
+    ValidatorConfigStore::issues_info(), "en");
+
+  MetaConfig meta_config;
+  meta_config.max_issues_per_code = 50;
+  const auto issue_cap = create_issue_cap(meta_config, *config, validator_name);
+  ASSERT_NE(issue_cap, nullptr);
+  EXPECT_EQ(issue_cap->max_issues_per_code(), 5u);
+
+  const auto other_cap = create_issue_cap(meta_config, *config, "mapping.lane.border_sharing");
+  ASSERT_NE(other_cap, nullptr);
+  EXPECT_EQ(other_cap->max_issues_per_code(), 50u);
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,148 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/issue_locator.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+#include "lanelet2_map_validator/validation_context.hpp"
+#include "map_validation_tester.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+
+class IssueLocatorTest : public MapValidationTester
+{
+protected:
+  static nlohmann::json requirements()
+  {
+    return nlohmann::json::parse(R"({
+      "requirements": [
+        {
+          "id": "speed_limit",
+          "validators": [{"name": "mapping.lane.speed_limit_validity"}]
+        }
+      ]
+    })");
+  }
+};
+
+TEST_F(IssueLocatorTest, IssuesArePositionedAtTheirPrimitives)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+  const IssueLocator locator(*map_, 100.0);
+
+  const lanelet::ConstLanelet lanelet = *map_->laneletLayer.begin();
+  const lanelet::BoundingBox2d box = lanelet::geometry::boundingBox2d(lanelet);
+  const lanelet::validation::Issue issue(
+    lanelet::validation::Severity::Error, lanelet::validation::Primitive::Lanelet, lanelet.id(),
+    "issue");
+
+  nlohmann::json issue_json = {{"id", lanelet.id()}};
+  locator.annotate(issue, issue_json);
+
+  ASSERT_TRUE(issue_json.contains("bounding_box"));
+  EXPECT_DOUBLE_EQ(issue_json["bounding_box"][0].get<double>(), box.min().x());
+  EXPECT_DOUBLE_EQ(issue_json["bounding_box"][3].get<double>(), box.max().y());
+  EXPECT_DOUBLE_EQ(issue_json["position"][0].get<double>(), box.center().x());
+  EXPECT_DOUBLE_EQ(issue_json["position"][1].get<double>(), box.center().y());
+
+  // Issues of primitives not found in the map have no geometry
+  const lanelet::validation::Issue unknown_issue(
+    lanelet::validation::Severity::Error, lanelet::validation::Primitive::Lanelet,
+    lanelet::InvalId, "issue");
+  nlohmann::json unknown_issue_json = nlohmann::json::object();
+  locator.annotate(unknown_issue, unknown_issue_json);
+  EXPECT_FALSE(unknown_issue_json.contains("position"));
+}
+
+TEST_F(IssueLocatorTest, IssuesAreIndexedByTile)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+  IssueLocator locator(*map_, 50.0);
+
+  locator.add_to_index("validator.b", {{"id", 1}, {"position", {120.0, -10.0}}});
+  locator.add_to_index("validator.a", {{"id", 2}, {"position", {149.0, -49.0}}});
+  locator.add_to_index("validator.a", {{"id", 3}, {"position", {10.0, 10.0}}});
+  locator.add_to_index("validator.a", {{"id", 4}});
+
+  const nlohmann::json index = locator.index_json();
+  EXPECT_DOUBLE_EQ(index["tile_size"].get<double>(), 50.0);
+  ASSERT_EQ(index["tiles"].size(), 2u);
+
+  // Tiles are ordered by [i, j]
+  EXPECT_EQ(index["tiles"][0]["tile"], nlohmann::json({0, 0}));
+
+  const auto & tile = index["tiles"][1];
+  EXPECT_EQ(tile["tile"], nlohmann::json({2, -1}));
+  EXPECT_EQ(tile["bounds"], nlohmann::json({100.0, -50.0, 150.0, 0.0}));
+  ASSERT_EQ(tile["issues"].size(), 2u);
+  EXPECT_EQ(tile["issues"][0]["validator"], "validator.a");
+  EXPECT_EQ(tile["issues"][0]["id"], 2);
+  EXPECT_EQ(tile["issues"][1]["validator"], "validator.b");
+
+  ASSERT_EQ(index["unlocated_issues"].size(), 1u);
+  EXPECT_EQ(index["unlocated_issues"][0]["id"], 4);
+}
+
+TEST_F(IssueLocatorTest, ValidationResultsHaveTheGeometry)  // NOLINT for gtest
+{
+  load_target_map("lane/speed_limit_with_negative_value.osm");
+  const auto locator = std::make_shared<IssueLocator>(*map_, 100.0);
+
+  auto context = std::make_shared<ValidationContext>();
+  context->issue_locator = locator;
+
+  nlohmann::json json_data = requirements();
+  const nlohmann::json exclusion_list = {{"exclusion", nlohmann::json::array()}};
+  validate_all_requirements(
+    json_data, MetaConfig(), *map_, import_exclusion_list(exclusion_list),
+    ValidatorConfigStore::current(), context);
+
+  const auto & issues = json_data["requirements"][0]["validators"][0]["issues"];
+  ASSERT_FALSE(issues.empty());
+  for (const auto & issue : issues) {
+    ASSERT_TRUE(issue.contains("position"));
+    EXPECT_TRUE(std::isfinite(issue["position"][0].get<double>()));
+    EXPECT_EQ(issue["bounding_box"].size(), 4u);
+  }
+
+  const nlohmann::json index = locator->index_json();
+  size_t indexed_issues = index["unlocated_issues"].size();
+  for (const auto & tile : index["tiles"]) {
+    indexed_issues += tile["issues"].size();
+  }
+  EXPECT_EQ(indexed_issues, issues.size());
+}
+
+TEST_F(IssueLocatorTest, TileSizeMustBePositive)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+  EXPECT_THROW(IssueLocator(*map_, 0.0), std::invalid_argument);
+  EXPECT_THROW(IssueLocator(*map_, -1.0), std::invalid_argument);
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,99 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/issue_message.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+
+class IssueMessageTest : public ::testing::Test
+{
+protected:
+  IssueMessageTest()
+  {
+    issues_info_ = nlohmann::json::parse(R"({
+      "Lane.Sample-001": {
+        "severity": "Error",
+        "primitive": "lanelet",
+        "message": {
+          "en": "Lanelet {lanelet_id} is next to {other_id}.",
+          "ja": "Lanelet {lanelet_id} は {other_id} の隣です。"
+        }
+      },
+      "Lane.Sample-002": {
+        "severity": "Warning",
+        "primitive": "lanelet",
+        "message": {
+          "en": "No substitutions {{here}}."
+        }
+      }
+    })");
+  }
+
+  ValidatorConfigPtr make_config(const std::string & language)
+  {
+    return std::make_shared<const ValidatorConfig>(YAML::Node(), issues_info_, language);
+  }
+
+  nlohmann::json issues_info_;
+};
+
+TEST_F(IssueMessageTest, MessagesAreSplitIntoCodeAndText)  // NOLINT for gtest
+{
+  const IssueMessage with_code =
+    split_issue_message("[General.PrerequisitesFailure-001]  Prerequisites didn't pass.");
+  EXPECT_EQ(with_code.issue_code, "General.PrerequisitesFailure-001");
+  EXPECT_EQ(with_code.text, "Prerequisites didn't pass.");
+
+  const IssueMessage without_code = split_issue_message("Some [free] text");
+  EXPECT_TRUE(without_code.issue_code.empty());
+  EXPECT_EQ(without_code.text, "Some [free] text");
+
+  const IssueMessage code_only = split_issue_message("[Lane.Sample-001]");
+  EXPECT_TRUE(code_only.issue_code.empty());
+  EXPECT_EQ(code_only.text, "[Lane.Sample-001]");
+}
+
+TEST_F(IssueMessageTest, MessageIsRenderedWhenConstructed)  // NOLINT for gtest
+{
+  const std::map<std::string, std::string> substitutions = {
+    {"lanelet_id", "12"}, {"other_id", "34"}};
+
+  const ValidatorConfigStore::Scope en_scope(make_config("en"));
+  EXPECT_EQ(
+    construct_issue_from_code("Lane.Sample-001", 12, substitutions).message,
+    "[Lane.Sample-001] Lanelet 12 is next to 34.");
+  {
+    const ValidatorConfigStore::Scope ja_scope(make_config("ja"));
+    EXPECT_EQ(
+      construct_issue_from_code("Lane.Sample-001", 12, substitutions).message,
+      "[Lane.Sample-001] Lanelet 12 は 34 の隣です。");
+  }
+
+  // Fall back to English if the message isn't translated
+  EXPECT_EQ(
+    render_issue_text("Lane.Sample-002", {}, *make_config("ja")), "No substitutions {here}.");
+  EXPECT_THROW(render_issue_text("Lane.Sample-003", {}, *make_config("en")), std::invalid_argument);
+}
+
+}  // namespace lanelet::autoware::validation
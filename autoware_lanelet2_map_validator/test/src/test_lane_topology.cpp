@@ -0,0 +1,219 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/lane_topology.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
+#include "map_validation_tester.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/utility/Utilities.h>
+#include <lanelet2_routing/RoutingCost.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+class TestLaneTopology : public MapValidationTester
+{
+protected:
+  static lanelet::Ids to_sorted_ids(const lanelet::ConstLanelets & lanelets)
+  {
+    lanelet::Ids ids;
+    for (const auto & lanelet : lanelets) {
+      ids.push_back(lanelet.id());
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  static lanelet::Ids to_sorted_ids(const lanelet::ConstLaneletOrAreas & primitives)
+  {
+    lanelet::Ids ids;
+    for (const auto & primitive : primitives) {
+      if (primitive.isLanelet()) {
+        ids.push_back(primitive.id());
+      }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  static lanelet::Id to_id(const lanelet::Optional<lanelet::ConstLanelet> & lanelet)
+  {
+    return lanelet ? lanelet->id() : lanelet::InvalId;
+  }
+
+  // Check that the LaneTopology has the same relations as the RoutingGraph for every lanelet
+  // If participant_height is given, both detect conflicts in 3D within it
+  void expect_same_relations_as_routing_graph(
+    const std::string & participant, const std::optional<double> & participant_height = {})
+  {
+    const auto traffic_rules =
+      lanelet::traffic_rules::TrafficRulesFactory::create("validator", participant);
+
+    lanelet::routing::RoutingGraph::Configuration config;
+    if (participant_height) {
+      config.emplace(
+        lanelet::routing::RoutingGraph::ParticipantHeight, lanelet::Attribute(*participant_height));
+    }
+    const auto routing_graph = lanelet::routing::RoutingGraph::build(
+      *map_, *traffic_rules, lanelet::routing::defaultRoutingCosts(), config);
+    const auto topology = lanelet::autoware::validation::LaneTopology::build(
+      *map_, *traffic_rules, participant_height);
+
+    for (const lanelet::ConstLanelet & lanelet : map_->laneletLayer) {
+      EXPECT_EQ(
+        to_sorted_ids(routing_graph->following(lanelet)),
+        to_sorted_ids(topology.following(lanelet)))
+        << "following of " << lanelet.id();
+      EXPECT_EQ(
+        to_sorted_ids(routing_graph->previous(lanelet)), to_sorted_ids(topology.previous(lanelet)))
+        << "previous of " << lanelet.id();
+      EXPECT_EQ(to_id(routing_graph->left(lanelet)), to_id(topology.left(lanelet)))
+        << "left of " << lanelet.id();
+      EXPECT_EQ(to_id(routing_graph->right(lanelet)), to_id(topology.right(lanelet)))
+        << "right of " << lanelet.id();
+      EXPECT_EQ(to_id(routing_graph->adjacentLeft(lanelet)), to_id(topology.adjacentLeft(lanelet)))
+        << "adjacentLeft of " << lanelet.id();
+      EXPECT_EQ(
+        to_id(routing_graph->adjacentRight(lanelet)), to_id(topology.adjacentRight(lanelet)))
+        << "adjacentRight of " << lanelet.id();
+      EXPECT_EQ(
+        to_sorted_ids(routing_graph->conflicting(lanelet)),
+        to_sorted_ids(topology.conflicting(lanelet)))
+        << "conflicting of " << lanelet.id();
+    }
+  }
+};
+
+TEST_F(TestLaneTopology, SameRelationsAsRoutingGraphForVehicle)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  expect_same_relations_as_routing_graph(lanelet::Participants::Vehicle);
+}
+
+TEST_F(TestLaneTopology, SameRelationsAsRoutingGraphForPedestrian)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  expect_same_relations_as_routing_graph(lanelet::Participants::Pedestrian);
+}
+
+TEST_F(TestLaneTopology, SameRelationsAsRoutingGraphWithParticipantHeight)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  expect_same_relations_as_routing_graph(lanelet::Participants::Vehicle, 2.0);
+}
+
+TEST_F(TestLaneTopology, SameRelationsWithAnyNumberOfThreads)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    "validator", lanelet::Participants::Vehicle);
+
+  lanelet::autoware::validation::set_parallel_jobs(1);
+  const auto serial_topology =
+    lanelet::autoware::validation::LaneTopology::build(*map_, *traffic_rules);
+  lanelet::autoware::validation::set_parallel_jobs(4);
+  const auto parallel_topology =
+    lanelet::autoware::validation::LaneTopology::build(*map_, *traffic_rules);
+  lanelet::autoware::validation::set_parallel_jobs(0);
+
+  ASSERT_EQ(serial_topology.size(), parallel_topology.size());
+  for (const lanelet::ConstLanelet & lanelet : map_->laneletLayer) {
+    EXPECT_EQ(serial_topology.following(lanelet), parallel_topology.following(lanelet));
+    EXPECT_EQ(serial_topology.previous(lanelet), parallel_topology.previous(lanelet));
+    EXPECT_EQ(serial_topology.conflicting(lanelet), parallel_topology.conflicting(lanelet));
+    EXPECT_EQ(to_id(serial_topology.left(lanelet)), to_id(parallel_topology.left(lanelet)));
+    EXPECT_EQ(to_id(serial_topology.right(lanelet)), to_id(parallel_topology.right(lanelet)));
+    EXPECT_EQ(
+      to_id(serial_topology.adjacentLeft(lanelet)), to_id(parallel_topology.adjacentLeft(lanelet)));
+    EXPECT_EQ(
+      to_id(serial_topology.adjacentRight(lanelet)),
+      to_id(parallel_topology.adjacentRight(lanelet)));
+  }
+}
+
+TEST_F(TestLaneTopology, LaneletsAtDifferentHeightsConflictOnlyIn2D)  // NOLINT for gtest
+{
+  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    "validator", lanelet::Participants::Vehicle);
+
+  // A road lanelet along the segment from -> to at the height z, whose left bound is the segment
+  // shifted by offset and whose right bound is the segment shifted by -offset
+  const auto road_lanelet = [](
+                              const lanelet::BasicPoint2d & from, const lanelet::BasicPoint2d & to,
+                              const lanelet::BasicPoint2d & offset, const double z) {
+    using lanelet::utils::getId;
+    const auto bound = [&](const lanelet::BasicPoint2d & shift) {
+      const lanelet::BasicPoint2d start = from + shift;
+      const lanelet::BasicPoint2d end = to + shift;
+      return lanelet::LineString3d(
+        getId(), {lanelet::Point3d(getId(), start.x(), start.y(), z),
+                  lanelet::Point3d(getId(), end.x(), end.y(), z)});
+    };
+    lanelet::Lanelet lanelet(getId(), bound(offset), bound(-offset));
+    lanelet.setAttribute(lanelet::AttributeName::Type, lanelet::AttributeValueString::Lanelet);
+    lanelet.setAttribute(lanelet::AttributeName::Subtype, lanelet::AttributeValueString::Road);
+    return lanelet;
+  };
+
+  for (const double height : {0.0, 10.0}) {
+    // A road along the x axis, and a road crossing it along the y axis at the height
+    const lanelet::Lanelet road = road_lanelet({0.0, 0.0}, {20.0, 0.0}, {0.0, 1.0}, 0.0);
+    const lanelet::Lanelet crossing_road =
+      road_lanelet({10.0, -10.0}, {10.0, 10.0}, {-1.0, 0.0}, height);
+    map_ = lanelet::utils::createMap({road, crossing_road});
+
+    // Without a participant height, the roads conflict whatever their heights are
+    const auto topology_2d =
+      lanelet::autoware::validation::LaneTopology::build(*map_, *traffic_rules);
+    EXPECT_EQ(topology_2d.conflicting(road).size(), 1u) << "height " << height;
+    EXPECT_EQ(topology_2d.conflicting(crossing_road).size(), 1u) << "height " << height;
+
+    const auto topology_3d =
+      lanelet::autoware::validation::LaneTopology::build(*map_, *traffic_rules, 2.0);
+    const size_t expected_conflicts = (height == 0.0) ? 1 : 0;
+    EXPECT_EQ(topology_3d.conflicting(road).size(), expected_conflicts) << "height " << height;
+    EXPECT_EQ(topology_3d.conflicting(crossing_road).size(), expected_conflicts)
+      << "height " << height;
+  }
+}
+
+TEST_F(TestLaneTopology, UnknownLanelet)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    "validator", lanelet::Participants::Vehicle);
+  const auto topology = lanelet::autoware::validation::LaneTopology::build(*map_, *traffic_rules);
+
+  const lanelet::Lanelet unknown_lanelet(
+    lanelet::utils::getId(), lanelet::LineString3d(lanelet::utils::getId()),
+    lanelet::LineString3d(lanelet::utils::getId()));
+
+  EXPECT_TRUE(topology.following(unknown_lanelet).empty());
+  EXPECT_TRUE(topology.previous(unknown_lanelet).empty());
+  EXPECT_FALSE(topology.adjacentLeft(unknown_lanelet));
+  EXPECT_FALSE(topology.adjacentRight(unknown_lanelet));
+  EXPECT_TRUE(topology.conflicting(unknown_lanelet).empty());
+  EXPECT_FALSE(topology.routingRelation(unknown_lanelet, unknown_lanelet, true));
+}
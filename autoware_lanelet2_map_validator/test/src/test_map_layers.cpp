@@ -0,0 +1,130 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/map_loader.hpp"
+#include "map_validation_tester.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <pugixml.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class MapLayersTest : public MapValidationTester
+{
+protected:
+  static lanelet::LaneletMapPtr load_sample_map(const std::optional<MapLayers> & layers)
+  {
+    const std::string map_file =
+      ament_index_cpp::get_package_share_directory("autoware_lanelet2_map_validator") +
+      "/data/map/sample_map.osm";
+    return loadAndValidateMap("mgrs", map_file, lanelet::validation::ValidationConfig(), layers)
+      .first;
+  }
+};
+
+TEST_F(MapLayersTest, OnlyDeclaredLayersAreLoaded)  // NOLINT for gtest
+{
+  const auto whole_map = load_sample_map(std::nullopt);
+  const auto lanelet_map = load_sample_map(MapLayers::from_names({"lanelets"}));
+  ASSERT_NE(whole_map, nullptr);
+  ASSERT_NE(lanelet_map, nullptr);
+
+  EXPECT_EQ(lanelet_map->laneletLayer.size(), whole_map->laneletLayer.size());
+  EXPECT_LT(lanelet_map->pointLayer.size(), whole_map->pointLayer.size());
+  EXPECT_TRUE(lanelet_map->areaLayer.empty());
+  EXPECT_TRUE(lanelet_map->polygonLayer.empty());
+
+  // The lanelets are complete, including what they refer to
+  for (const auto & lanelet : lanelet_map->laneletLayer) {
+    const auto original = whole_map->laneletLayer.get(lanelet.id());
+    EXPECT_EQ(lanelet.leftBound().size(), original.leftBound().size());
+    EXPECT_EQ(lanelet.rightBound().size(), original.rightBound().size());
+    EXPECT_EQ(lanelet.regulatoryElements().size(), original.regulatoryElements().size());
+  }
+}
+
+TEST_F(MapLayersTest, RequiredLayersAreTheUnionOfTheDeclarations)  // NOLINT for gtest
+{
+  const ValidatorConfig config(
+    YAML::Load(
+      "a:\n  layers: [lanelets]\n"
+      "b:\n  layers: [linestrings, regulatory_elements]\n"
+      "c:\n  roi_halo: 20.0\n"
+      "d:\n  layers: [lanelets, unknown]\n"
+      "e:\n  layers: [points, linestrings, polygons, lanelets, areas, regulatory_elements]\n"),
+    nlohmann::json::object(), "en");
+
+  const auto layers = required_map_layers(config, {"a", "b"});
+  ASSERT_TRUE(layers.has_value());
+  EXPECT_EQ(
+    layers->names(), (std::vector<std::string>{"linestrings", "lanelets", "regulatory_elements"}));
+
+  // Validators without a valid declaration or with every layer need the whole map
+  EXPECT_FALSE(required_map_layers(config, {"a", "c"}).has_value());
+  EXPECT_FALSE(required_map_layers(config, {"a", "d"}).has_value());
+  EXPECT_FALSE(required_map_layers(config, {"a", "missing"}).has_value());
+  EXPECT_FALSE(required_map_layers(config, {"e"}).has_value());
+}
+
+TEST(MapLayersParsingTest, UnknownLayerIsRejected)  // NOLINT for gtest
+{
+  EXPECT_TRUE(MapLayers::all().is_all());
+  EXPECT_TRUE(MapLayers::from_names({}).names().empty());
+  EXPECT_THROW(MapLayers::from_names({"lanelet"}), std::invalid_argument);
+}
+
+TEST(RemoveUnneededOsmElementsTest, ReferredElementsAreKept)  // NOLINT for gtest
+{
+  pugi::xml_document doc;
+  ASSERT_TRUE(doc.load_string(R"(<osm>
+  <node id="1"/><node id="2"/><node id="3"/><node id="4"/><node id="5"/>
+  <way id="1"><nd ref="1"/><nd ref="2"/><tag k="type" v="line_thin"/></way>
+  <way id="2"><nd ref="3"/><nd ref="4"/><tag k="type" v="traffic_light"/></way>
+  <way id="3"><nd ref="1"/><nd ref="3"/><nd ref="4"/><tag k="area" v="true"/></way>
+  <relation id="1">
+    <member type="way" ref="1" role="left"/><member type="way" ref="1" role="right"/>
+    <member type="relation" ref="2" role="regulatory_element"/><tag k="type" v="lanelet"/>
+  </relation>
+  <relation id="2">
+    <member type="way" ref="2" role="refers"/><tag k="type" v="regulatory_element"/>
+  </relation>
+  <relation id="3">
+    <member type="way" ref="3" role="outer"/><tag k="type" v="multipolygon"/>
+  </relation>
+</osm>)"));
+  const pugi::xml_node osm_node = doc.child("osm");
+
+  EXPECT_EQ(remove_unneeded_osm_elements(osm_node, MapLayers::from_names({"lanelets"})), 3u);
+
+  // The lanelet keeps its bounds and its regulatory element with the traffic light
+  std::vector<std::string> kept;
+  for (const pugi::xml_node element : osm_node.children()) {
+    kept.push_back(std::string(element.name()) + element.attribute("id").value());
+  }
+  EXPECT_EQ(
+    kept, (std::vector<std::string>{
+            "node1", "node2", "node3", "node4", "way1", "way2", "relation1", "relation2"}));
+}
+
+}  // namespace lanelet::autoware::validation
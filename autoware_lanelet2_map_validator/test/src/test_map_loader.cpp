@@ -0,0 +1,96 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/map_loader.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
+#include "map_validation_tester.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class ParallelMapLoadingTest : public MapValidationTester,
+                               public ::testing::WithParamInterface<std::string>
+{
+protected:
+  void TearDown() override { set_parallel_jobs(0); }
+
+  static std::pair<lanelet::LaneletMapPtr, std::vector<lanelet::validation::DetectedIssues>> load(
+    const size_t jobs, const std::optional<MapLayers> & layers)
+  {
+    set_parallel_jobs(jobs);
+    lanelet::validation::ValidationConfig validation_config;
+    validation_config.origin = lanelet::GPSPoint{35.9, 139.93, 0.0};
+    return loadAndValidateMap(
+      GetParam(),
+      ament_index_cpp::get_package_share_directory("autoware_lanelet2_map_validator") +
+        "/data/map/sample_map.osm",
+      validation_config, layers);
+  }
+
+  static void expect_same_map(
+    const std::pair<lanelet::LaneletMapPtr, std::vector<lanelet::validation::DetectedIssues>> &
+      serial,
+    const std::pair<lanelet::LaneletMapPtr, std::vector<lanelet::validation::DetectedIssues>> &
+      parallel)
+  {
+    ASSERT_NE(serial.first, nullptr);
+    ASSERT_NE(parallel.first, nullptr);
+
+    ASSERT_EQ(serial.second.size(), parallel.second.size());
+    for (size_t i = 0; i < serial.second.size(); i++) {
+      ASSERT_EQ(serial.second[i].issues.size(), parallel.second[i].issues.size());
+      for (size_t j = 0; j < serial.second[i].issues.size(); j++) {
+        EXPECT_EQ(serial.second[i].issues[j].message, parallel.second[i].issues[j].message);
+      }
+    }
+
+    // The projected positions are exactly the same
+    ASSERT_EQ(serial.first->pointLayer.size(), parallel.first->pointLayer.size());
+    for (const auto & point : serial.first->pointLayer) {
+      ASSERT_TRUE(parallel.first->pointLayer.exists(point.id()));
+      EXPECT_EQ(point.basicPoint(), parallel.first->pointLayer.get(point.id()).basicPoint())
+        << "point " << point.id();
+    }
+    EXPECT_EQ(serial.first->laneletLayer.size(), parallel.first->laneletLayer.size());
+    EXPECT_EQ(
+      serial.first->regulatoryElementLayer.size(), parallel.first->regulatoryElementLayer.size());
+  }
+};
+
+TEST_P(ParallelMapLoadingTest, SameMapAsSerialLoading)  // NOLINT for gtest
+{
+  expect_same_map(load(1, std::nullopt), load(4, std::nullopt));
+}
+
+TEST_P(ParallelMapLoadingTest, SameMapAsSerialLoadingOfLayers)  // NOLINT for gtest
+{
+  const MapLayers layers = MapLayers::from_names({"lanelets"});
+  expect_same_map(load(1, layers), load(4, layers));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Projectors, ParallelMapLoadingTest,
+  ::testing::Values("mgrs", "utm", "transverse_mercator"));  // NOLINT for gtest
+
+}  // namespace lanelet::autoware::validation
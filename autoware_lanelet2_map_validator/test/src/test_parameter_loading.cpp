@@ -24,6 +24,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace lanelet::autoware::validation
@@ -48,4 +49,50 @@ TEST_F(ParameterLoadingTest, CheckDefaultParamsFileHasValidValidators)
   }
 }
 
+TEST_F(ParameterLoadingTest, ConcurrentRunsUseTheirOwnSnapshots)
+{
+  const std::string validator_name = "mapping.lane.border_sharing";
+  const std::string code = issue_code(validator_name, 1);
+  const std::map<std::string, std::string> substitutions = {{"lanelet_id", "2"}};
+
+  // Two runs with different parameters and languages
+  const auto config_a = std::make_shared<const ValidatorConfig>(
+    YAML::Load(validator_name + ":\n  iou_threshold: 0.1\n"), ValidatorConfigStore::issues_info(),
+    "en");
+  const auto config_b = std::make_shared<const ValidatorConfig>(
+    YAML::Load(validator_name + ":\n  iou_threshold: 0.2\n"), ValidatorConfigStore::issues_info(),
+    "ja");
+
+  const auto run = [&](const ValidatorConfigPtr & config, double & threshold, bool & consistent) {
+    const ValidatorConfigStore::Scope scope(config);
+    const std::string expected_message = construct_issue_from_code(code, 1, substitutions).message;
+    consistent = true;
+    for (int i = 0; i < 1000; i++) {
+      threshold = ValidatorConfigStore::parameters()[validator_name]["iou_threshold"].as<double>();
+      consistent &= (construct_issue_from_code(code, 1, substitutions).message == expected_message);
+    }
+  };
+
+  double threshold_a = 0.0;
+  double threshold_b = 0.0;
+  bool consistent_a = false;
+  bool consistent_b = false;
+  std::thread thread_a(run, config_a, std::ref(threshold_a), std::ref(consistent_a));
+  std::thread thread_b(run, config_b, std::ref(threshold_b), std::ref(consistent_b));
+  thread_a.join();
+  thread_b.join();
+
+  EXPECT_DOUBLE_EQ(threshold_a, 0.1);
+  EXPECT_DOUBLE_EQ(threshold_b, 0.2);
+  EXPECT_TRUE(consistent_a);
+  EXPECT_TRUE(consistent_b);
+
+  // The languages of the runs are kept separately
+  const ValidatorConfigStore::Scope scope_a(config_a);
+  const std::string message_a = construct_issue_from_code(code, 1, substitutions).message;
+  const ValidatorConfigStore::Scope scope_b(config_b);
+  const std::string message_b = construct_issue_from_code(code, 1, substitutions).message;
+  EXPECT_NE(message_a, message_b);
+}
+
 }  // namespace lanelet::autoware::validation
@@ -0,0 +1,138 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/progress.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class ProgressTest : public ::testing::Test
+{
+protected:
+  void TearDown() override { close_progress_stream(); }
+
+  // Read all events written to the pipe until the write end is closed
+  static std::vector<nlohmann::json> read_events(const int read_fd)
+  {
+    std::string text;
+    char buffer[4096];
+    ssize_t size = 0;
+    while ((size = ::read(read_fd, buffer, sizeof(buffer))) > 0) {
+      text.append(buffer, static_cast<size_t>(size));
+    }
+    ::close(read_fd);
+
+    std::vector<nlohmann::json> events;
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line)) {
+      events.push_back(nlohmann::json::parse(line));
+    }
+    return events;
+  }
+};
+
+TEST_F(ProgressTest, EventsAreWrittenToTheFileDescriptor)  // NOLINT for gtest
+{
+  int fds[2];
+  ASSERT_EQ(::pipe(fds), 0);
+
+  open_progress_stream(std::to_string(fds[1]));
+  EXPECT_TRUE(progress_enabled());
+  report_progress("run_started", {{"map_file", "sample_map.osm"}});
+  {
+    ProgressPhase phase("load_map");
+    phase.finish({{"loaded", true}});
+  }
+  {
+    const ProgressPhase aborted_phase("validation");
+  }
+  close_progress_stream();
+  EXPECT_FALSE(progress_enabled());
+  report_progress("ignored");
+
+  const auto events = read_events(fds[0]);
+  ASSERT_EQ(events.size(), 5u);
+  EXPECT_EQ(events[0]["event"], "run_started");
+  EXPECT_EQ(events[0]["map_file"], "sample_map.osm");
+  EXPECT_TRUE(events[0].contains("time_ms"));
+  EXPECT_EQ(events[1]["event"], "phase_started");
+  EXPECT_EQ(events[1]["phase"], "load_map");
+  EXPECT_EQ(events[2]["event"], "phase_finished");
+  EXPECT_EQ(events[2]["phase"], "load_map");
+  EXPECT_TRUE(events[2]["loaded"].get<bool>());
+  EXPECT_GE(events[2]["elapsed_ms"].get<double>(), 0.0);
+  EXPECT_EQ(events[4]["event"], "phase_finished");
+  EXPECT_EQ(events[4]["phase"], "validation");
+  EXPECT_TRUE(events[4]["aborted"].get<bool>());
+}
+
+TEST_F(ProgressTest, OtherOutputLeavesTheStandardOutput)  // NOLINT for gtest
+{
+  int stdout_fds[2];
+  int stderr_fds[2];
+  ASSERT_EQ(::pipe(stdout_fds), 0);
+  ASSERT_EQ(::pipe(stderr_fds), 0);
+  std::cout.flush();
+  std::cerr.flush();
+  const int saved_stdout = ::dup(STDOUT_FILENO);
+  const int saved_stderr = ::dup(STDERR_FILENO);
+  ::dup2(stdout_fds[1], STDOUT_FILENO);
+  ::dup2(stderr_fds[1], STDERR_FILENO);
+  ::close(stdout_fds[1]);
+  ::close(stderr_fds[1]);
+
+  open_progress_stream("stdout");
+  std::cout << "Results are output to lanelet2_validation_results.json" << std::endl;
+  report_progress("run_started", {{"map_file", "sample_map.osm"}});
+  close_progress_stream();
+
+  ::dup2(saved_stdout, STDOUT_FILENO);
+  ::dup2(saved_stderr, STDERR_FILENO);
+  ::close(saved_stdout);
+  ::close(saved_stderr);
+
+  const auto events = read_events(stdout_fds[0]);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0]["event"], "run_started");
+
+  std::string text;
+  char buffer[4096];
+  ssize_t size = 0;
+  while ((size = ::read(stderr_fds[0], buffer, sizeof(buffer))) > 0) {
+    text.append(buffer, static_cast<size_t>(size));
+  }
+  ::close(stderr_fds[0]);
+  EXPECT_EQ(text, "Results are output to lanelet2_validation_results.json\n");
+}
+
+TEST_F(ProgressTest, InvalidTargetIsRejected)  // NOLINT for gtest
+{
+  EXPECT_THROW(open_progress_stream("stderr"), std::invalid_argument);
+  EXPECT_THROW(open_progress_stream("3x"), std::invalid_argument);
+  EXPECT_FALSE(progress_enabled());
+}
+
+}  // namespace lanelet::autoware::validation
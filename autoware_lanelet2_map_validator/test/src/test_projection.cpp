@@ -0,0 +1,161 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/projection.hpp"
+
+#include <autoware_lanelet2_extension/projection/mgrs_projector.hpp>
+#include <autoware_lanelet2_extension/projection/transverse_mercator_projector.hpp>
+#include <lanelet2_projection/UTM.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+// The accuracy required from BatchProjector against the scalar projectors
+constexpr double tolerance = 1e-6;
+
+class BatchProjectionTest
+: public ::testing::TestWithParam<std::tuple<std::string, lanelet::GPSPoint>>
+{
+protected:
+  static std::unique_ptr<lanelet::Projector> scalar_projector()
+  {
+    const auto & [projector_type, origin] = GetParam();
+    if (projector_type == "mgrs") {
+      return std::make_unique<lanelet::projection::MGRSProjector>();
+    }
+    if (projector_type == "transverse_mercator") {
+      return std::make_unique<lanelet::projection::TransverseMercatorProjector>(
+        lanelet::Origin{origin});
+    }
+    return std::make_unique<lanelet::projection::UtmProjector>(lanelet::Origin{origin});
+  }
+};
+
+TEST_P(BatchProjectionTest, SameAsScalarProjection)  // NOLINT for gtest
+{
+  const auto & [projector_type, origin] = GetParam();
+  const auto batch_projector = BatchProjector::create(projector_type, origin);
+  ASSERT_NE(batch_projector, nullptr);
+  const auto projector = scalar_projector();
+
+  // A grid of 3 x 3 degrees around the origin
+  std::vector<double> lat;
+  std::vector<double> lon;
+  std::vector<double> ele;
+  for (int i = -150; i <= 150; i += 5) {
+    for (int j = -150; j <= 150; j += 5) {
+      lat.push_back(origin.lat + i * 0.01 + 1e-7 * j);
+      lon.push_back(origin.lon + j * 0.01 + 1e-7 * i);
+      ele.push_back(0.5 * j);
+    }
+  }
+  const size_t count = lat.size();
+  std::vector<double> x(count);
+  std::vector<double> y(count);
+  std::vector<double> z(count);
+  const size_t projected_count = batch_projector->forward(
+    count, lat.data(), lon.data(), ele.data(), x.data(), y.data(), z.data());
+  EXPECT_GT(projected_count, count * 9 / 10);
+
+  size_t nan_count = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (std::isnan(x[i])) {
+      EXPECT_TRUE(std::isnan(y[i]));
+      EXPECT_TRUE(std::isnan(z[i]));
+      nan_count++;
+      continue;
+    }
+    const lanelet::BasicPoint3d expected =
+      projector->forward(lanelet::GPSPoint{lat[i], lon[i], ele[i]});
+    EXPECT_NEAR(x[i], expected.x(), tolerance) << "lat " << lat[i] << ", lon " << lon[i];
+    EXPECT_NEAR(y[i], expected.y(), tolerance) << "lat " << lat[i] << ", lon " << lon[i];
+    EXPECT_EQ(z[i], expected.z());
+  }
+  EXPECT_EQ(nan_count + projected_count, count);
+}
+
+TEST_P(BatchProjectionTest, PointsOutOfRangeAreLeftToTheScalarProjector)  // NOLINT for gtest
+{
+  const auto & [projector_type, origin] = GetParam();
+  const auto batch_projector = BatchProjector::create(projector_type, origin);
+  ASSERT_NE(batch_projector, nullptr);
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const std::vector<double> lat{origin.lat, 86.0, -85.0, origin.lat, nan};
+  const std::vector<double> lon{origin.lon, origin.lon, origin.lon, origin.lon + 90.0, origin.lon};
+  const std::vector<double> ele(lat.size(), 0.0);
+  std::vector<double> x(lat.size());
+  std::vector<double> y(lat.size());
+  std::vector<double> z(lat.size());
+  if (projector_type != "mgrs") {
+    EXPECT_EQ(
+      batch_projector->forward(
+        lat.size(), lat.data(), lon.data(), ele.data(), x.data(), y.data(), z.data()),
+      1u);
+    EXPECT_NEAR(x[0], 0.0, tolerance);
+    EXPECT_NEAR(y[0], 0.0, tolerance);
+  } else {
+    // The MGRS projector projects each point in its own zone
+    EXPECT_EQ(
+      batch_projector->forward(
+        lat.size(), lat.data(), lon.data(), ele.data(), x.data(), y.data(), z.data()),
+      2u);
+  }
+  for (size_t i = 1; i < lat.size(); i++) {
+    if (projector_type == "mgrs" && i == 3) {
+      continue;
+    }
+    EXPECT_TRUE(std::isnan(x[i])) << "point " << i;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Projectors, BatchProjectionTest,
+  ::testing::Combine(
+    ::testing::Values("mgrs", "utm", "transverse_mercator"),
+    ::testing::Values(
+      lanelet::GPSPoint{35.9, 139.93, 0.0}, lanelet::GPSPoint{-33.87, 151.21, 10.0},
+      lanelet::GPSPoint{40.71, -74.01, -5.0},
+      lanelet::GPSPoint{59.91, 10.75, 0.0})));  // NOLINT for gtest
+
+TEST(BatchProjectionZoneTest, StandardZone)  // NOLINT for gtest
+{
+  EXPECT_EQ(utm_standard_zone(35.9, 139.93), 54);
+  EXPECT_EQ(utm_standard_zone(-33.87, 151.21), 56);
+  EXPECT_EQ(utm_standard_zone(40.71, -74.01), 18);
+  EXPECT_EQ(utm_standard_zone(0.0, 180.0), 1);
+  EXPECT_EQ(utm_standard_zone(0.0, -180.0), 1);
+  // Norway and Svalbard
+  EXPECT_EQ(utm_standard_zone(60.2, 5.3), 32);
+  EXPECT_EQ(utm_standard_zone(78.0, 10.0), 33);
+  // UPS
+  EXPECT_EQ(utm_standard_zone(84.0, 0.0), 0);
+  EXPECT_EQ(utm_standard_zone(-80.5, 0.0), 0);
+}
+
+TEST(BatchProjectionZoneTest, UnknownProjectorType)  // NOLINT for gtest
+{
+  EXPECT_EQ(BatchProjector::create("lambert", lanelet::GPSPoint{35.9, 139.93, 0.0}), nullptr);
+}
+
+}  // namespace lanelet::autoware::validation
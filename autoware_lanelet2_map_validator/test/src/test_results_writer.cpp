@@ -0,0 +1,181 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/results_writer.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class ResultsWriterTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    output_directory_ = std::filesystem::temp_directory_path() /
+                        ("results_writer_test_" + std::to_string(::getpid()) + "_" +
+                         ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    std::filesystem::create_directories(output_directory_);
+
+    // Skeleton of the results after validation (validator1 has issues streamed)
+    json_data_ = nlohmann::json::parse(R"({
+      "version": "0.1.0",
+      "requirements": [
+        {
+          "id": "requirement1",
+          "passed": false,
+          "validators": [
+            {"name": "validator1", "passed": false},
+            {"name": "validator2", "passed": true, "prerequisites": [{"name": "validator1"}]}
+          ]
+        },
+        {"id": "requirement2", "passed": true, "validators": []}
+      ],
+      "validation_info": {"target_map": "sample/map.osm"}
+    })");
+
+    for (int i = 0; i < 100; i++) {
+      issues_.emplace_back(
+        lanelet::validation::Severity::Error, lanelet::validation::Primitive::Lanelet, i,
+        "[Lane.Sample-001] Lanelet " + std::to_string(i) + " is \"broken\".");
+    }
+    issues_.emplace_back(
+      lanelet::validation::Severity::Warning, lanelet::validation::Primitive::Primitive,
+      lanelet::InvalId, "[General.Sample-001] A message without substitutions");
+  }
+
+  void TearDown() override { std::filesystem::remove_all(output_directory_); }
+
+  void write_results(const ResultsFormat format, std::filesystem::path & output_file)
+  {
+    ResultsWriter writer(output_directory_, format);
+    writer.add_validator_issues(json_data_["requirements"][0]["validators"][0], issues_);
+    writer.add_validator_issues(json_data_["requirements"][0]["validators"][1], {});
+    writer.finish(json_data_);
+    output_file = writer.output_file();
+  }
+
+  static std::string read_file(const std::filesystem::path & path)
+  {
+    std::ifstream file(path);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+  }
+
+  std::filesystem::path output_directory_;
+  nlohmann::json json_data_;
+  lanelet::validation::Issues issues_;
+};
+
+TEST_F(ResultsWriterTest, PrettyJsonIsSameAsInMemoryExport)  // NOLINT for gtest
+{
+  std::filesystem::path output_file;
+  write_results(ResultsFormat::JSON, output_file);
+  EXPECT_EQ(output_file.filename(), "lanelet2_validation_results.json");
+
+  nlohmann::json expected = json_data_;
+  for (const auto & issue : issues_) {
+    expected["requirements"][0]["validators"][0]["issues"].push_back(issue_to_json(issue));
+  }
+  std::stringstream expected_text;
+  expected_text << std::setw(4) << expected;
+
+  EXPECT_EQ(read_file(output_file), expected_text.str());
+
+  // The spool file is removed after writing
+  const std::filesystem::directory_iterator files(output_directory_);
+  EXPECT_EQ(std::distance(begin(files), end(files)), 1);
+}
+
+TEST_F(ResultsWriterTest, NdjsonHasOneRecordPerLine)  // NOLINT for gtest
+{
+  std::filesystem::path output_file;
+  write_results(ResultsFormat::NDJSON, output_file);
+  EXPECT_EQ(output_file.filename(), "lanelet2_validation_results.ndjson");
+
+  std::ifstream file(output_file);
+  std::map<std::string, std::vector<nlohmann::json>> records;
+  std::string line;
+  while (std::getline(file, line)) {
+    const nlohmann::json record = nlohmann::json::parse(line);
+    records[record["type"]].push_back(record);
+  }
+
+  ASSERT_EQ(records["issue"].size(), issues_.size());
+  EXPECT_EQ(records["issue"][3]["validator"], "validator1");
+  EXPECT_EQ(records["issue"][3]["issue_code"], "Lane.Sample-001");
+  EXPECT_EQ(records["issue"][3]["message"], "Lanelet 3 is \"broken\".");
+  EXPECT_EQ(records["issue"].back()["issue_code"], "General.Sample-001");
+  EXPECT_EQ(records["issue"].back()["message"], "A message without substitutions");
+
+  ASSERT_EQ(records["validator"].size(), 2u);
+  EXPECT_EQ(records["validator"][0]["name"], "validator1");
+  EXPECT_FALSE(records["validator"][0].contains("issues"));
+  EXPECT_EQ(records["validator"][1]["prerequisites"].size(), 1u);
+
+  ASSERT_EQ(records["requirement"].size(), 2u);
+  EXPECT_EQ(records["requirement"][0]["id"], "requirement1");
+  EXPECT_FALSE(records["requirement"][0]["passed"]);
+
+  ASSERT_EQ(records["validation_info"].size(), 1u);
+  EXPECT_EQ(records["validation_info"][0]["target_map"], "sample/map.osm");
+}
+
+TEST_F(ResultsWriterTest, PreviousResultsAreReplacedWhenFinished)  // NOLINT for gtest
+{
+  const std::filesystem::path output_file = output_directory_ / "lanelet2_validation_results.json";
+  std::ofstream(output_file) << "previous results";
+
+  {
+    ResultsWriter writer(output_directory_, ResultsFormat::JSON);
+    writer.add_validator_issues(json_data_["requirements"][0]["validators"][0], issues_);
+    EXPECT_EQ(read_file(output_file), "previous results");
+
+    // Only the numbers of the issues are kept
+    EXPECT_EQ(writer.issue_counts().errors, 100u);
+    EXPECT_EQ(writer.issue_counts().warnings, 1u);
+  }
+  // A writer destroyed before finish() leaves the previous results and no temporary files
+  EXPECT_EQ(read_file(output_file), "previous results");
+  const std::filesystem::directory_iterator files(output_directory_);
+  EXPECT_EQ(std::distance(begin(files), end(files)), 1);
+
+  std::filesystem::path finished_file;
+  write_results(ResultsFormat::JSON, finished_file);
+  EXPECT_EQ(finished_file, output_file);
+  EXPECT_NE(read_file(output_file), "previous results");
+}
+
+TEST_F(ResultsWriterTest, InvalidFormatIsRejected)  // NOLINT for gtest
+{
+  EXPECT_EQ(parse_results_format("json"), ResultsFormat::JSON);
+  EXPECT_EQ(parse_results_format("ndjson"), ResultsFormat::NDJSON);
+  EXPECT_THROW(parse_results_format("yaml"), std::invalid_argument);
+}
+
+}  // namespace lanelet::autoware::validation
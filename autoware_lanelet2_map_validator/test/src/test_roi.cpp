@@ -0,0 +1,209 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+#include "lanelet2_map_validator/validators/lane/speed_limit_validity.hpp"
+#include "map_validation_tester.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class TestRegionOfInterest : public MapValidationTester
+{
+protected:
+  std::vector<lanelet::validation::DetectedIssues> validate_speed_limits(
+    const std::shared_ptr<const RegionOfInterest> & region_of_interest)
+  {
+    auto context = std::make_shared<ValidationContext>();
+    context->region_of_interest = region_of_interest;
+    lanelet::validation::ValidationConfig validation_config;
+    validation_config.checksFilter = SpeedLimitValidityValidator::name();
+    return apply_validation(*map_, validation_config, ValidatorConfigStore::current(), context);
+  }
+
+  static size_t count_issues(const std::vector<lanelet::validation::DetectedIssues> & issues)
+  {
+    size_t count = 0;
+    for (const auto & detected_issues : issues) {
+      count += detected_issues.issues.size();
+    }
+    return count;
+  }
+};
+
+TEST_F(TestRegionOfInterest, SearchFindsPrimitivesAroundTheRegion)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  const lanelet::ConstLanelet target = *map_->laneletLayer.begin();
+  const auto region_of_interest = RegionOfInterest::create(*map_, std::nullopt, {target.id()});
+
+  const auto lanelets = region_of_interest->search(map_->laneletLayer, 0.0);
+  ASSERT_FALSE(lanelets.empty());
+  EXPECT_LT(lanelets.size(), map_->laneletLayer.size());
+  EXPECT_TRUE(std::is_sorted(
+    lanelets.begin(), lanelets.end(),
+    [](const auto & a, const auto & b) { return a.id() < b.id(); }));
+  EXPECT_TRUE(std::any_of(lanelets.begin(), lanelets.end(), [&](const auto & lanelet) {
+    return lanelet.id() == target.id();
+  }));
+
+  const lanelet::BoundingBox2d target_box = lanelet::geometry::boundingBox2d(target);
+  for (const auto & lanelet : lanelets) {
+    EXPECT_TRUE(lanelet::geometry::boundingBox2d(lanelet).intersects(target_box))
+      << "lanelet " << lanelet.id() << " is outside the region";
+  }
+
+  // A larger halo never finds fewer primitives
+  EXPECT_GE(region_of_interest->search(map_->laneletLayer, 50.0).size(), lanelets.size());
+}
+
+TEST_F(TestRegionOfInterest, PrimitivesInRoiFollowTheContext)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  const std::string validator_name = SpeedLimitValidityValidator::name();
+  EXPECT_EQ(
+    primitives_in_roi(map_->laneletLayer, validator_name).size(), map_->laneletLayer.size());
+
+  const lanelet::ConstLanelet target = *map_->laneletLayer.begin();
+  auto context = std::make_shared<ValidationContext>();
+  context->region_of_interest = RegionOfInterest::create(*map_, std::nullopt, {target.id()});
+  const ValidationContext::Scope scope(context);
+
+  const auto lanelets = primitives_in_roi(map_->laneletLayer, validator_name);
+  EXPECT_EQ(
+    lanelets.size(),
+    context->region_of_interest->search(map_->laneletLayer, default_roi_halo).size());
+}
+
+TEST_F(TestRegionOfInterest, IssuesOutsideTheRegionAreNotReported)  // NOLINT for gtest
+{
+  load_target_map("lane/speed_limit_with_negative_value.osm");
+
+  const auto all_issues = validate_speed_limits(nullptr);
+  ASSERT_EQ(count_issues(all_issues), 1u);
+  const lanelet::Id issue_lanelet_id = all_issues[0].issues[0].id;
+
+  // The region contains the lanelet with the issue
+  const auto inside_issues =
+    validate_speed_limits(RegionOfInterest::create(*map_, std::nullopt, {issue_lanelet_id}));
+  ASSERT_EQ(count_issues(inside_issues), 1u);
+  EXPECT_EQ(inside_issues[0].issues[0].id, issue_lanelet_id);
+
+  // The region is far away from the map
+  const lanelet::BoundingBox2d lanelet_box =
+    lanelet::geometry::boundingBox2d(map_->laneletLayer.get(issue_lanelet_id));
+  const lanelet::BasicPoint2d offset(10000.0, 10000.0);
+  const auto outside_issues = validate_speed_limits(RegionOfInterest::create(
+    *map_, lanelet::BoundingBox2d(lanelet_box.min() + offset, lanelet_box.max() + offset), {}));
+  EXPECT_EQ(count_issues(outside_issues), 0u);
+}
+
+TEST_F(TestRegionOfInterest, UnknownIdIsRejected)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  EXPECT_THROW(RegionOfInterest::create(*map_, std::nullopt, {}), std::invalid_argument);
+  EXPECT_THROW(
+    RegionOfInterest::create(*map_, std::nullopt, {lanelet::utils::getId()}),
+    std::invalid_argument);
+}
+
+TEST_F(TestRegionOfInterest, IssueBoundingBoxIsFoundByPrimitiveType)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  const lanelet::ConstLanelet target = *map_->laneletLayer.begin();
+  const auto box = issue_bounding_box(
+    *map_, lanelet::validation::Issue(
+             lanelet::validation::Severity::Error, lanelet::validation::Primitive::Lanelet,
+             target.id(), "message"));
+  ASSERT_TRUE(box.has_value());
+  EXPECT_TRUE(box->isApprox(lanelet::geometry::boundingBox2d(target)));
+
+  // The ID of the lanelet is not a point, and issues of the whole map have no primitive
+  EXPECT_FALSE(issue_bounding_box(
+                 *map_, lanelet::validation::Issue(
+                          lanelet::validation::Severity::Error,
+                          lanelet::validation::Primitive::Point, target.id(), "message"))
+                 .has_value());
+  EXPECT_FALSE(issue_bounding_box(
+                 *map_, lanelet::validation::Issue(
+                          lanelet::validation::Severity::Error,
+                          lanelet::validation::Primitive::Primitive, lanelet::InvalId, "message"))
+                 .has_value());
+}
+
+TEST_F(TestRegionOfInterest, OwnedIdsAreMatchedByElementType)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  const lanelet::ConstLanelet target = *map_->laneletLayer.begin();
+  const lanelet::validation::Issue lanelet_issue(
+    lanelet::validation::Severity::Error, lanelet::validation::Primitive::Lanelet, target.id(),
+    "message");
+  const lanelet::validation::Issue bound_issue(
+    lanelet::validation::Severity::Error, lanelet::validation::Primitive::LineString,
+    target.leftBound().id(), "message");
+
+  // A node or a way with the ID of the lanelet relation does not own the lanelet
+  const auto owned_by_node = RegionOfInterest::create_owned(*map_, {target.id()}, {}, {});
+  EXPECT_FALSE(owned_by_node->contains(lanelet_issue));
+  const auto owned_by_way =
+    RegionOfInterest::create_owned(*map_, {}, {target.id(), target.leftBound().id()}, {});
+  EXPECT_FALSE(owned_by_way->contains(lanelet_issue));
+  EXPECT_TRUE(owned_by_way->contains(bound_issue));
+
+  const auto owned_by_relation = RegionOfInterest::create_owned(*map_, {}, {}, {target.id()});
+  EXPECT_TRUE(owned_by_relation->contains(lanelet_issue));
+  EXPECT_FALSE(owned_by_relation->contains(bound_issue));
+}
+
+TEST(TestRegionOfInterestParsing, BoundingBox)  // NOLINT for gtest
+{
+  const lanelet::BoundingBox2d box = parse_roi_bounding_box("-1.5,2,3.25, 4");
+  EXPECT_DOUBLE_EQ(box.min().x(), -1.5);
+  EXPECT_DOUBLE_EQ(box.min().y(), 2.0);
+  EXPECT_DOUBLE_EQ(box.max().x(), 3.25);
+  EXPECT_DOUBLE_EQ(box.max().y(), 4.0);
+
+  EXPECT_THROW(parse_roi_bounding_box("1,2,3"), std::invalid_argument);
+  EXPECT_THROW(parse_roi_bounding_box("1,2,3,4,5"), std::invalid_argument);
+  EXPECT_THROW(parse_roi_bounding_box("1,2,3,x"), std::invalid_argument);
+  EXPECT_THROW(parse_roi_bounding_box("3,2,1,4"), std::invalid_argument);
+}
+
+TEST(TestRegionOfInterestParsing, Ids)  // NOLINT for gtest
+{
+  EXPECT_EQ(parse_roi_ids("10,20, 30"), (std::vector<lanelet::Id>{10, 20, 30}));
+  EXPECT_TRUE(parse_roi_ids("").empty());
+  EXPECT_THROW(parse_roi_ids("10,abc"), std::invalid_argument);
+  EXPECT_THROW(parse_roi_ids("10,,20"), std::invalid_argument);
+}
+
+}  // namespace lanelet::autoware::validation
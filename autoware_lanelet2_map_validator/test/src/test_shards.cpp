@@ -0,0 +1,219 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/shards.hpp"
+#include "map_validation_tester.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class TestShards : public MapValidationTester
+{
+};
+
+TEST_F(TestShards, EachPrimitiveIsOwnedByOneShard)  // NOLINT for gtest
+{
+  using lanelet::validation::Primitive;
+  load_target_map("sample_map.osm");
+
+  constexpr size_t shard_count = 3;
+  std::vector<std::shared_ptr<const RegionOfInterest>> shards;
+  for (size_t i = 0; i < shard_count; i++) {
+    shards.push_back(RegionOfInterest::create_shard(*map_, i, shard_count));
+  }
+
+  const auto count_owners = [&shards](const Primitive primitive, const lanelet::Id id) {
+    lanelet::validation::Issue issue;
+    issue.primitive = primitive;
+    issue.id = id;
+    size_t owners = 0;
+    for (const auto & shard : shards) {
+      owners += shard->contains(issue) ? 1 : 0;
+    }
+    return owners;
+  };
+
+  for (const auto & lanelet : map_->laneletLayer) {
+    EXPECT_EQ(count_owners(Primitive::Lanelet, lanelet.id()), 1u)
+      << "lanelet " << lanelet.id();
+  }
+  for (const auto & linestring : map_->lineStringLayer) {
+    EXPECT_EQ(count_owners(Primitive::LineString, linestring.id()), 1u)
+      << "linestring " << linestring.id();
+  }
+  for (const auto & regelem : map_->regulatoryElementLayer) {
+    EXPECT_EQ(count_owners(Primitive::RegulatoryElement, regelem->id()), 1u)
+      << "regulatory element " << regelem->id();
+  }
+
+  // Issues not bound to a primitive are reported by every shard
+  EXPECT_EQ(count_owners(Primitive::Primitive, lanelet::InvalId), shard_count);
+
+  EXPECT_THROW(
+    RegionOfInterest::create_shard(*map_, shard_count, shard_count), std::invalid_argument);
+}
+
+TEST_F(TestShards, ShardIsSearchedInTheOrderOfTheLayer)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+
+  // A single shard owns the whole map, so it finds every lanelet
+  const auto shard = RegionOfInterest::create_shard(*map_, 0, 1);
+  std::vector<lanelet::Id> layer_ids;
+  for (const auto & lanelet : map_->laneletLayer) {
+    layer_ids.push_back(lanelet.id());
+  }
+  std::vector<lanelet::Id> shard_ids;
+  for (const auto & lanelet : shard->search(map_->laneletLayer, 0.0)) {
+    shard_ids.push_back(lanelet.id());
+  }
+  EXPECT_EQ(shard_ids, layer_ids);
+
+  lanelet::validation::Issue issue;
+  issue.primitive = lanelet::validation::Primitive::Lanelet;
+  issue.id = layer_ids.back();
+  EXPECT_EQ(shard->layer_position(issue), layer_ids.size() - 1);
+  issue.primitive = lanelet::validation::Primitive::Primitive;
+  issue.id = lanelet::InvalId;
+  EXPECT_FALSE(shard->layer_position(issue).has_value());
+}
+
+TEST(TestShardMerge, IssuesAreMergedInTheOrderOfTheLayers)  // NOLINT for gtest
+{
+  nlohmann::json json_data = nlohmann::json::parse(R"({
+    "requirements": [{"id": "requirement", "validators": [{"name": "a"}, {"name": "b"}]}]
+  })");
+
+  const nlohmann::json map_wide_issue = {
+    {"severity", "Error"}, {"primitive", "primitive"}, {"id", 0}, {"message", "map wide"}};
+  const nlohmann::json lanelet_issue = {
+    {"severity", "Warning"}, {"primitive", "lanelet"}, {"id", 10}, {"message", "shard 0"}};
+  const nlohmann::json other_lanelet_issue = {
+    {"severity", "Warning"}, {"primitive", "lanelet"}, {"id", 20}, {"message", "shard 1"}};
+  const nlohmann::json last_lanelet_issue = {
+    {"severity", "Warning"}, {"primitive", "lanelet"}, {"id", 5}, {"message", "shard 0"}};
+  const auto at_position = [](nlohmann::json issue, const size_t position) {
+    issue[layer_position_key] = position;
+    return issue;
+  };
+
+  nlohmann::json shard_0 = json_data;
+  shard_0["requirements"][0]["validators"][0]["passed"] = false;
+  shard_0["requirements"][0]["validators"][0]["issues"] = {
+    at_position(lanelet_issue, 0), map_wide_issue, at_position(last_lanelet_issue, 2)};
+  shard_0["requirements"][0]["validators"][1]["passed"] = true;
+
+  nlohmann::json shard_1 = json_data;
+  shard_1["requirements"][0]["validators"][0]["passed"] = false;
+  shard_1["requirements"][0]["validators"][0]["issues"] = {
+    map_wide_issue, at_position(other_lanelet_issue, 1)};
+  shard_1["requirements"][0]["validators"][1]["passed"] = true;
+
+  merge_shard_results(json_data, {shard_0, shard_1});
+
+  // The issues are neither sorted by ID nor repeated for each shard
+  const nlohmann::json & validator_a = json_data["requirements"][0]["validators"][0];
+  EXPECT_FALSE(validator_a["passed"].get<bool>());
+  ASSERT_EQ(validator_a["issues"].size(), 4u);
+  EXPECT_EQ(validator_a["issues"][0], lanelet_issue);
+  EXPECT_EQ(validator_a["issues"][1], map_wide_issue);
+  EXPECT_EQ(validator_a["issues"][2], other_lanelet_issue);
+  EXPECT_EQ(validator_a["issues"][3], last_lanelet_issue);
+
+  const nlohmann::json & validator_b = json_data["requirements"][0]["validators"][1];
+  EXPECT_TRUE(validator_b["passed"].get<bool>());
+  EXPECT_FALSE(validator_b.contains("issues"));
+}
+
+TEST(TestShardMerge, IssuesWithoutPositionsStayInTheOrderOfTheShards)  // NOLINT for gtest
+{
+  nlohmann::json json_data = nlohmann::json::parse(R"({
+    "requirements": [{"id": "requirement", "validators": [{"name": "a"}]}]
+  })");
+
+  const nlohmann::json map_wide_issue = {
+    {"severity", "Error"}, {"primitive", "primitive"}, {"id", 0}, {"message", "map wide"}};
+  const nlohmann::json other_map_wide_issue = {
+    {"severity", "Error"}, {"primitive", "primitive"}, {"id", 0}, {"message", "tile 1"}};
+  const nlohmann::json lanelet_issue = {
+    {"severity", "Warning"}, {"primitive", "lanelet"}, {"id", 20}, {"message", "tile 0"}};
+  const nlohmann::json other_lanelet_issue = {
+    {"severity", "Warning"}, {"primitive", "lanelet"}, {"id", 10}, {"message", "tile 1"}};
+
+  nlohmann::json tile_0 = json_data;
+  tile_0["requirements"][0]["validators"][0]["issues"] = {lanelet_issue, map_wide_issue};
+  nlohmann::json tile_1 = json_data;
+  tile_1["requirements"][0]["validators"][0]["issues"] = {
+    map_wide_issue, other_lanelet_issue, other_map_wide_issue};
+
+  merge_shard_results(json_data, {tile_0, tile_1});
+
+  const nlohmann::json expected_issues = {
+    lanelet_issue, map_wide_issue, other_lanelet_issue, other_map_wide_issue};
+  EXPECT_EQ(json_data["requirements"][0]["validators"][0]["issues"], expected_issues);
+}
+
+TEST(TestShardMerge, PrerequisiteFailureOfAnyShardSkipsTheValidator)  // NOLINT for gtest
+{
+  nlohmann::json json_data = nlohmann::json::parse(R"({
+    "requirements": [{"id": "requirement", "validators": [{"name": "b"}]}]
+  })");
+
+  const nlohmann::json prerequisite_issue = {
+    {"severity", "Error"},
+    {"primitive", "primitive"},
+    {"id", 0},
+    {"issue_code", "General.PrerequisitesFailure-001"},
+    {"message", "Prerequisites (a, ) didn't pass for requirement b."}};
+  const nlohmann::json info_issue = {
+    {"severity", "Info"}, {"primitive", "lanelet"}, {"id", 10}, {"message", "info"}};
+
+  nlohmann::json shard_0 = json_data;
+  shard_0["requirements"][0]["validators"][0]["passed"] = true;
+  shard_0["requirements"][0]["validators"][0]["issues"] = {info_issue};
+  nlohmann::json shard_1 = json_data;
+  shard_1["requirements"][0]["validators"][0]["passed"] = false;
+  shard_1["requirements"][0]["validators"][0]["issues"] = {prerequisite_issue};
+
+  merge_shard_results(json_data, {shard_0, shard_1});
+
+  const nlohmann::json & validator_b = json_data["requirements"][0]["validators"][0];
+  EXPECT_FALSE(validator_b["passed"].get<bool>());
+  ASSERT_EQ(validator_b["issues"].size(), 1u);
+  EXPECT_EQ(validator_b["issues"][0], prerequisite_issue);
+}
+
+TEST(TestShardMerge, MismatchedShardsAreRejected)  // NOLINT for gtest
+{
+  nlohmann::json json_data = nlohmann::json::parse(R"({
+    "requirements": [{"id": "requirement", "validators": [{"name": "a"}]}]
+  })");
+  nlohmann::json shard = json_data;
+  shard["requirements"][0]["validators"][0]["name"] = "b";
+
+  EXPECT_THROW(merge_shard_results(json_data, {shard}), std::invalid_argument);
+  EXPECT_THROW(merge_shard_results(json_data, {}), std::invalid_argument);
+}
+
+}  // namespace lanelet::autoware::validation
@@ -0,0 +1,142 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/streaming.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include <string>
+
+namespace lanelet::autoware::validation
+{
+
+class TestOsmTileIndex : public ::testing::Test
+{
+protected:
+  static std::string sample_map_file()
+  {
+    return ament_index_cpp::get_package_share_directory("autoware_lanelet2_map_validator") +
+           "/data/map/sample_map.osm";
+  }
+};
+
+TEST_F(TestOsmTileIndex, EachElementIsOwnedByOneTile)  // NOLINT for gtest
+{
+  const OsmTileIndex index(sample_map_file(), 50.0);
+  ASSERT_GT(index.tiles().size(), 1u);
+
+  std::set<OsmTileIndex::ElementKey> owned_elements;
+  for (const auto & tile : index.tiles()) {
+    for (const auto & element : index.owned_elements(tile)) {
+      EXPECT_TRUE(owned_elements.insert(element).second);
+      EXPECT_EQ(index.tile_of(element), tile);
+    }
+  }
+  EXPECT_EQ(owned_elements.size(), index.element_count());
+}
+
+TEST_F(TestOsmTileIndex, ElementsAroundIncludeTheReferencedElements)  // NOLINT for gtest
+{
+  const OsmTileIndex index(sample_map_file(), 50.0);
+  const auto tile = index.tiles().front();
+  const auto elements = index.elements_around(tile);
+  const std::set<OsmTileIndex::ElementKey> element_set(elements.begin(), elements.end());
+
+  for (const auto & element : index.owned_elements(tile)) {
+    EXPECT_EQ(element_set.count(element), 1u);
+  }
+
+  // Nodes come first, then ways and relations
+  EXPECT_TRUE(std::is_sorted(
+    elements.begin(), elements.end(),
+    [](const auto & a, const auto & b) { return a.first < b.first; }));
+
+  // The written tile map has every element once
+  OsmTileCache cache(index, 0);
+  std::ostringstream tile_map;
+  index.write_tile_map(tile, cache, tile_map);
+  const std::string text = tile_map.str();
+  EXPECT_NE(text.find("<osm"), std::string::npos);
+  EXPECT_EQ(text.substr(text.size() - 7), "</osm>\n");
+  for (const auto & element : elements) {
+    const std::string type = element.first == OsmTileIndex::ElementType::Node  ? "<node"
+                             : element.first == OsmTileIndex::ElementType::Way ? "<way"
+                                                                               : "<relation";
+    EXPECT_NE(text.find(type + " id=\"" + std::to_string(element.second) + "\""), std::string::npos)
+      << type << " " << element.second;
+  }
+}
+
+TEST_F(TestOsmTileIndex, CacheKeepsItsCapacity)  // NOLINT for gtest
+{
+  const OsmTileIndex index(sample_map_file(), 50.0);
+
+  const auto tile_bytes = [&index](const OsmTileIndex::TileKey & tile) {
+    size_t bytes = 0;
+    for (const auto & [element, text] : index.read_owned_elements(tile)) {
+      bytes += text.size();
+    }
+    return bytes;
+  };
+
+  // Only the tile read last is kept without capacity
+  OsmTileCache small_cache(index, 0);
+  for (const auto & tile : index.tiles()) {
+    EXPECT_FALSE(small_cache.element_text(index.owned_elements(tile).front()).empty());
+    EXPECT_EQ(small_cache.size_bytes(), tile_bytes(tile));
+  }
+
+  // Every tile is kept with enough capacity
+  OsmTileCache large_cache(index, 1 << 30);
+  size_t total_bytes = 0;
+  for (const auto & tile : index.tiles()) {
+    large_cache.element_text(index.owned_elements(tile).front());
+    total_bytes += tile_bytes(tile);
+    EXPECT_EQ(large_cache.size_bytes(), total_bytes);
+  }
+}
+
+TEST(TestStreaming, GlobalContextValidatorsAreMarked)  // NOLINT for gtest
+{
+  const YAML::Node parameters =
+    YAML::Load("{validator_a: {global_context: true}, validator_b: {global_context: false}}");
+  const ValidatorConfig config(parameters, nlohmann::json::object(), "en");
+
+  nlohmann::json json_data = nlohmann::json::parse(R"({
+    "requirements": [{"id": "requirement", "validators": [
+      {"name": "validator_a", "passed": true},
+      {"name": "validator_b", "passed": true},
+      {"name": "validator_c", "passed": true}
+    ]}]
+  })");
+  mark_global_context_validators(json_data, config);
+
+  const auto & validators = json_data["requirements"][0]["validators"];
+  ASSERT_EQ(validators[0]["issues"].size(), 1u);
+  EXPECT_EQ(validators[0]["issues"][0]["severity"], "Info");
+  EXPECT_EQ(validators[0]["issues"][0]["issue_code"], "General.StreamingGlobalContext-001");
+  EXPECT_TRUE(validators[0]["passed"].get<bool>());
+  EXPECT_FALSE(validators[1].contains("issues"));
+  EXPECT_FALSE(validators[2].contains("issues"));
+}
+
+}  // namespace lanelet::autoware::validation
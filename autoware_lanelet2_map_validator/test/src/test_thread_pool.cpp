@@ -0,0 +1,122 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_validator/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class ThreadPoolTest : public ::testing::TestWithParam<size_t>
+{
+protected:
+  void SetUp() override { set_parallel_jobs(GetParam()); }
+  void TearDown() override { set_parallel_jobs(0); }
+};
+
+TEST_P(ThreadPoolTest, ParallelForVisitsEveryIndexOnce)  // NOLINT for gtest
+{
+  std::vector<std::atomic<int>> visits(1000);
+  parallel_for(visits.size(), [&](const size_t i) { visits[i]++; });
+
+  for (const auto & count : visits) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+TEST_P(ThreadPoolTest, NestedParallelForRunsSerially)  // NOLINT for gtest
+{
+  std::vector<int> sums(16, 0);
+  parallel_for(sums.size(), [&](const size_t i) {
+    parallel_for(10, [&](const size_t j) { sums[i] += static_cast<int>(j); });
+  });
+
+  for (const int sum : sums) {
+    EXPECT_EQ(sum, 45);
+  }
+}
+
+TEST_P(ThreadPoolTest, ParallelCollectKeepsSerialOrder)  // NOLINT for gtest
+{
+  std::list<int> elements;
+  for (int i = 0; i < 1000; i++) {
+    elements.push_back(i);
+  }
+
+  const auto collected = parallel_collect<int>(
+    elements,
+    [](const int element, std::vector<int> & output) {
+      if (element % 3 == 0) {
+        output.push_back(element);
+        output.push_back(-element);
+      }
+    },
+    16);
+
+  std::vector<int> expected;
+  for (const int element : elements) {
+    if (element % 3 == 0) {
+      expected.push_back(element);
+      expected.push_back(-element);
+    }
+  }
+  EXPECT_EQ(collected, expected);
+}
+
+TEST_P(ThreadPoolTest, ExceptionIsRethrown)  // NOLINT for gtest
+{
+  EXPECT_THROW(
+    parallel_for(
+      100,
+      [](const size_t i) {
+        if (i == 77) {
+          throw std::runtime_error("failure in a task");
+        }
+      }),
+    std::runtime_error);
+}
+
+TEST(SharedThreadPoolTest, HeldPoolOutlivesResizing)  // NOLINT for gtest
+{
+  set_parallel_jobs(4);
+  const std::shared_ptr<ThreadPool> pool = shared_thread_pool();
+  set_parallel_jobs(2);
+  EXPECT_NE(shared_thread_pool(), pool);
+
+  std::atomic<int> count{0};
+  std::vector<std::future<void>> futures;
+  for (int i = 0; i < 10; i++) {
+    futures.push_back(pool->submit([&count]() { count++; }));
+  }
+  for (auto & future : futures) {
+    future.get();
+  }
+  EXPECT_EQ(count.load(), 10);
+  EXPECT_EQ(pool->size(), 3u);
+
+  set_parallel_jobs(0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  NumberOfJobs, ThreadPoolTest, ::testing::Values(1, 2, 4, 8));  // NOLINT for gtest
+
+}  // namespace lanelet::autoware::validation
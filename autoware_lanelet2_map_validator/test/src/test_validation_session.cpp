@@ -0,0 +1,153 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/cli.hpp"
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/roi.hpp"
+#include "lanelet2_map_validator/session.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+#include "map_validation_tester.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class ValidationSessionTest : public MapValidationTester
+{
+protected:
+  static nlohmann::json requirements()
+  {
+    return nlohmann::json::parse(R"({
+      "requirements": [
+        {
+          "id": "speed_limit",
+          "validators": [
+            {"name": "mapping.lane.speed_limit_validity"},
+            {
+              "name": "mapping.lane.lanelet_geometry",
+              "prerequisites": [{"name": "mapping.lane.speed_limit_validity"}]
+            }
+          ]
+        },
+        {
+          "id": "centerline",
+          "validators": [{"name": "mapping.lane.centerline_geometry"}]
+        }
+      ]
+    })");
+  }
+
+  static MetaConfig mgrs_meta_config()
+  {
+    MetaConfig meta_config;
+    meta_config.projector_type = "mgrs";
+    return meta_config;
+  }
+
+  static std::string map_file(const std::string & file_name)
+  {
+    return ament_index_cpp::get_package_share_directory("autoware_lanelet2_map_validator") +
+           "/data/map/" + file_name;
+  }
+};
+
+TEST_F(ValidationSessionTest, SameResultsAsValidateAllRequirements)  // NOLINT for gtest
+{
+  load_target_map("lane/speed_limit_with_negative_value.osm");
+
+  nlohmann::json json_data = requirements();
+  const nlohmann::json exclusion_list = {{"exclusion", nlohmann::json::array()}};
+  const auto issues = validate_all_requirements(
+    json_data, MetaConfig(), *map_, import_exclusion_list(exclusion_list));
+  evaluate_requirements(json_data);
+
+  ValidationSession session(map_);
+  const ValidationResults results = session.validate(requirements());
+
+  EXPECT_EQ(results.json_data, json_data);
+  EXPECT_EQ(results.issues.size(), issues.size());
+  EXPECT_GT(results.errors, 0u);
+  EXPECT_FALSE(results.passed());
+  EXPECT_FALSE(results.json_data["requirements"][0]["passed"].get<bool>());
+}
+
+TEST_F(ValidationSessionTest, RepeatedCallsKeepTheMapAndTheProfile)  // NOLINT for gtest
+{
+  ValidationSession session = ValidationSession::load(
+    map_file("lane/speed_limit_with_negative_value.osm"), ValidatorConfigStore::current(),
+    mgrs_meta_config());
+  const lanelet::LaneletMap * map = &session.map();
+
+  const ValidationResults first_results = session.validate(requirements());
+  EXPECT_TRUE(
+    session.timing_profile().elapsed_ms("mapping.lane.speed_limit_validity").has_value());
+  EXPECT_FALSE(session.timing_profile().elapsed_ms("mapping.lane.lanelet_geometry").has_value());
+
+  const ValidationResults second_results = session.validate(requirements());
+  EXPECT_EQ(&session.map(), map);
+  EXPECT_EQ(second_results.json_data, first_results.json_data);
+  EXPECT_EQ(second_results.errors, first_results.errors);
+}
+
+TEST_F(ValidationSessionTest, ExclusionMapIsKeptBetweenCalls)  // NOLINT for gtest
+{
+  load_target_map("lane/speed_limit_with_negative_value.osm");
+  ValidationSession session(map_);
+
+  const ValidationResults all_issues = session.validate(requirements());
+  const auto & error = all_issues.json_data["requirements"][0]["validators"][0]["issues"][0];
+
+  nlohmann::json exclusion_list = {{"exclusion", nlohmann::json::array()}};
+  exclusion_list["exclusion"].push_back({{"primitive", error["primitive"]}, {"id", error["id"]}});
+  session.set_exclusion_map(import_exclusion_list(exclusion_list));
+
+  for (size_t i = 0; i < 2; i++) {
+    const ValidationResults results = session.validate(requirements());
+    EXPECT_TRUE(results.json_data["requirements"][0]["passed"].get<bool>());
+  }
+}
+
+TEST_F(ValidationSessionTest, RegionOfInterestIsReported)  // NOLINT for gtest
+{
+  load_target_map("sample_map.osm");
+  ValidationSession session(map_);
+
+  const auto region_of_interest =
+    RegionOfInterest::create(session.map(), parse_roi_bounding_box("0,0,100,100"), {});
+  const ValidationResults results = session.validate(requirements(), region_of_interest);
+
+  EXPECT_TRUE(results.passed());
+  EXPECT_EQ(
+    results.json_data["validation_info"]["region_of_interest"], region_of_interest->to_json());
+}
+
+TEST_F(ValidationSessionTest, InvalidMapsAreRejected)  // NOLINT for gtest
+{
+  EXPECT_THROW(ValidationSession(nullptr), std::invalid_argument);
+  EXPECT_THROW(
+    ValidationSession::load(
+      map_file("no_such_map.osm"), ValidatorConfigStore::current(), mgrs_meta_config()),
+    std::invalid_argument);
+}
+
+}  // namespace lanelet::autoware::validation
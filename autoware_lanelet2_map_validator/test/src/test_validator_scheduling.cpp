@@ -0,0 +1,259 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_validator/cli.hpp"
+#include "lanelet2_map_validator/config_store.hpp"
+#include "lanelet2_map_validator/thread_pool.hpp"
+#include "lanelet2_map_validator/timing_profile.hpp"
+#include "lanelet2_map_validator/validation.hpp"
+#include "map_validation_tester.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+
+#include <filesystem>
+#include <fstream>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lanelet::autoware::validation
+{
+
+class ValidatorSchedulingTest : public MapValidationTester
+{
+protected:
+  static std::vector<ValidatorName> queue_order(
+    const Validators & validators, const ValidatorCosts & costs)
+  {
+    auto [queue, remaining] = create_validation_queue(validators, costs);
+    std::vector<ValidatorName> order;
+    for (; !queue.empty(); queue.pop()) {
+      order.push_back(queue.front());
+    }
+    return order;
+  }
+
+  static nlohmann::json requirements()
+  {
+    return nlohmann::json::parse(R"({
+      "requirements": [{
+        "id": "requirement",
+        "validators": [
+          {"name": "mapping.lane.speed_limit_validity"},
+          {
+            "name": "mapping.lane.lanelet_geometry",
+            "prerequisites": [{"name": "mapping.lane.speed_limit_validity"}]
+          },
+          {"name": "mapping.lane.centerline_geometry"},
+          {
+            "name": "mapping.lane.road_shoulder",
+            "prerequisites": [{"name": "mapping.lane.centerline_geometry"}]
+          },
+          {"name": "mapping.lane.border_sharing"},
+          {"name": "mapping.intersection.right_of_way_without_traffic_lights"},
+          {"name": "mapping.intersection.right_of_way_with_traffic_lights"},
+          {"name": "mapping.intersection.right_of_way_for_virtual_traffic_lights"},
+          {"name": "mapping.intersection.turn_signal_distance_overlap"},
+          {"name": "mapping.intersection.virtual_traffic_light_line_order"},
+          {"name": "mapping.intersection.virtual_traffic_light_section_overlap"},
+          {"name": "mapping.crosswalk.safety_attributes"}
+        ]
+      }]
+    })");
+  }
+
+  nlohmann::json validate(const MetaConfig & meta_config, TimingProfile * timing_profile = nullptr)
+  {
+    nlohmann::json json_data = requirements();
+    const nlohmann::json exclusion_list = {{"exclusion", nlohmann::json::array()}};
+    validate_all_requirements(
+      json_data, meta_config, *map_, import_exclusion_list(exclusion_list),
+      ValidatorConfigStore::current(), ValidationContext::current(), nullptr, timing_profile);
+    return json_data;
+  }
+
+  // Validate a freshly loaded map with meta_config first, and then the map loaded again without
+  // any option, so that the lazily computed caches of the map (e.g. the centerlines) are not
+  // filled yet when validators run at the same time
+  std::pair<nlohmann::json, nlohmann::json> validate_with_serial_run(
+    const std::string & map_file, const MetaConfig & meta_config,
+    TimingProfile * timing_profile = nullptr, TimingProfile * serial_timing_profile = nullptr)
+  {
+    load_target_map(map_file);
+    const nlohmann::json results = validate(meta_config, timing_profile);
+    load_target_map(map_file);
+    const nlohmann::json serial_results = validate(MetaConfig(), serial_timing_profile);
+    return {results, serial_results};
+  }
+
+  static std::filesystem::path temporary_file(const std::string & name)
+  {
+    const std::filesystem::path file = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(file);
+    return file;
+  }
+};
+
+TEST_F(ValidatorSchedulingTest, ExpensiveValidatorsComeFirst)  // NOLINT for gtest
+{
+  Validators validators = {
+    {"a", {{}, ValidatorInfo::Severity::NONE}},
+    {"b", {{}, ValidatorInfo::Severity::NONE}},
+    {"c", {{}, ValidatorInfo::Severity::NONE}},
+    {"d", {{}, ValidatorInfo::Severity::NONE}}};
+
+  EXPECT_EQ(
+    queue_order(validators, {{"a", 10.0}, {"b", 30.0}, {"c", 20.0}, {"d", 20.0}}),
+    (std::vector<ValidatorName>{"b", "c", "d", "a"}));
+
+  // Without costs the order is given by the names
+  EXPECT_EQ(queue_order(validators, {}), (std::vector<ValidatorName>{"a", "b", "c", "d"}));
+}
+
+TEST_F(ValidatorSchedulingTest, LongChainsComeFirst)  // NOLINT for gtest
+{
+  // "a" is cheap but "b" depending on it is the most expensive validator
+  Validators validators = {
+    {"a", {{}, ValidatorInfo::Severity::NONE}},
+    {"b", {{{"a", false}}, ValidatorInfo::Severity::NONE}},
+    {"c", {{}, ValidatorInfo::Severity::NONE}},
+    {"d", {{{"b", false}, {"c", false}}, ValidatorInfo::Severity::NONE}}};
+
+  EXPECT_EQ(
+    queue_order(validators, {{"a", 1.0}, {"b", 100.0}, {"c", 50.0}, {"d", 1.0}}),
+    (std::vector<ValidatorName>{"a", "b", "c", "d"}));
+  EXPECT_EQ(
+    queue_order(validators, {{"a", 1.0}, {"b", 10.0}, {"c", 50.0}, {"d", 1.0}}),
+    (std::vector<ValidatorName>{"c", "a", "b", "d"}));
+}
+
+TEST_F(ValidatorSchedulingTest, CostsComeFromTheProfileThenTheParameters)  // NOLINT for gtest
+{
+  const ValidatorConfig config(
+    YAML::Load(
+      "a:\n  estimated_cost_ms: 500.0\n"
+      "b:\n  estimated_cost_ms: 500.0\n"
+      "c:\n  layers: [lanelets]\n"),
+    nlohmann::json::object(), "en");
+  const Validators validators = {
+    {"a", {{}, ValidatorInfo::Severity::NONE}},
+    {"b", {{}, ValidatorInfo::Severity::NONE}},
+    {"c", {{}, ValidatorInfo::Severity::NONE}}};
+
+  TimingProfile timing_profile;
+  timing_profile.record("b", 20.0);
+
+  const ValidatorCosts costs = estimate_validator_costs(validators, config, &timing_profile);
+  EXPECT_DOUBLE_EQ(costs.at("a"), 500.0);
+  EXPECT_DOUBLE_EQ(costs.at("b"), 20.0);
+  EXPECT_DOUBLE_EQ(costs.at("c"), default_validator_cost_ms);
+  EXPECT_DOUBLE_EQ(estimate_validator_costs(validators, config).at("b"), 500.0);
+}
+
+TEST_F(ValidatorSchedulingTest, ProfileIsSavedAndLoaded)  // NOLINT for gtest
+{
+  const std::filesystem::path file = temporary_file("validator_scheduling_profile.json");
+  EXPECT_TRUE(TimingProfile::load(file).empty());
+
+  TimingProfile timing_profile;
+  timing_profile.record("a", 12.5);
+  timing_profile.record("b", 3.0);
+  timing_profile.record("a", 15.0);
+  timing_profile.save(file);
+
+  const TimingProfile loaded = TimingProfile::load(file);
+  EXPECT_DOUBLE_EQ(loaded.elapsed_ms("a").value_or(0.0), 15.0);
+  EXPECT_DOUBLE_EQ(loaded.elapsed_ms("b").value_or(0.0), 3.0);
+  EXPECT_FALSE(loaded.elapsed_ms("c").has_value());
+
+  std::ofstream(file) << R"({"validators": {"a": 12.5}})";
+  EXPECT_THROW(TimingProfile::load(file), std::runtime_error);
+  std::filesystem::remove(file);
+}
+
+TEST_F(ValidatorSchedulingTest, ConcurrentValidatorsGiveTheSameResults)  // NOLINT for gtest
+{
+  set_parallel_jobs(4);
+
+  MetaConfig meta_config;
+  meta_config.validator_jobs = 4;
+  TimingProfile timing_profile;
+  const auto [concurrent_results, serial_results] =
+    validate_with_serial_run("sample_map.osm", meta_config, nullptr, &timing_profile);
+  set_parallel_jobs(0);
+
+  EXPECT_EQ(concurrent_results, serial_results);
+
+  // Every validator without prerequisites ran and is in the profile
+  for (const auto & validator : serial_results["requirements"][0]["validators"]) {
+    if (!validator.contains("prerequisites")) {
+      EXPECT_TRUE(timing_profile.elapsed_ms(validator["name"]).has_value()) << validator["name"];
+    }
+  }
+}
+
+TEST_F(ValidatorSchedulingTest, SkippedValidatorsAreNotProfiled)  // NOLINT for gtest
+{
+  load_target_map("lane/speed_limit_with_negative_value.osm");
+
+  MetaConfig meta_config;
+  meta_config.validator_jobs = 2;
+  TimingProfile timing_profile;
+  validate(meta_config, &timing_profile);
+
+  EXPECT_TRUE(timing_profile.elapsed_ms("mapping.lane.speed_limit_validity").has_value());
+  EXPECT_FALSE(timing_profile.elapsed_ms("mapping.lane.lanelet_geometry").has_value());
+}
+
+TEST_F(ValidatorSchedulingTest, SpeculativeValidatorsGiveTheSameResults)  // NOLINT for gtest
+{
+  // speed_limit_validity fails, so a speculative lanelet_geometry is discarded
+  set_parallel_jobs(4);
+
+  MetaConfig meta_config;
+  meta_config.validator_jobs = 4;
+  meta_config.speculative = true;
+  TimingProfile timing_profile;
+  const auto [speculative_results, serial_results] = validate_with_serial_run(
+    "lane/speed_limit_with_negative_value.osm", meta_config, &timing_profile);
+  set_parallel_jobs(0);
+
+  EXPECT_EQ(speculative_results, serial_results);
+
+  // Skipped validators are not in the profile even if they ran speculatively
+  EXPECT_TRUE(timing_profile.elapsed_ms("mapping.lane.speed_limit_validity").has_value());
+  EXPECT_FALSE(timing_profile.elapsed_ms("mapping.lane.lanelet_geometry").has_value());
+}
+
+TEST_F(ValidatorSchedulingTest, SpeculationDoesNotChangePassingResults)  // NOLINT for gtest
+{
+  set_parallel_jobs(4);
+
+  MetaConfig meta_config;
+  meta_config.validator_jobs = 4;
+  meta_config.speculative = true;
+  const auto [speculative_results, serial_results] =
+    validate_with_serial_run("sample_map.osm", meta_config);
+  set_parallel_jobs(0);
+
+  EXPECT_EQ(speculative_results, serial_results);
+}
+
+}  // namespace lanelet::autoware::validation
@@ -21,6 +21,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <regex>
 #include <set>
 #include <string>
@@ -130,4 +131,62 @@ TEST_F(VersionControlTest, ModifyValidationInfo)  // NOLINT for gtest
     << "Failed to remove temporary file " << info_osm_file_name;
 }
 
+TEST_F(VersionControlTest, StreamValidationInfo)  // NOLINT for gtest
+{
+  const std::string package_share_directory =
+    ament_index_cpp::get_package_share_directory("autoware_lanelet2_map_validator");
+
+  const std::string info_osm_file_name = package_share_directory + "/data/temp_stream_info.osm";
+  const std::string map_text = R"(<?xml version="1.0"?>
+<!-- <validation requirements="in a comment"/> -->
+<osm version="0.6">
+  <node id="1" lat="35.0" lon='139.0'/>
+  <validation note="kept" requirements="old.json" requirements_version="1.1.1"><tag k="a" v="b"/></validation>
+</osm>
+)";
+  std::ofstream(info_osm_file_name) << map_text;
+
+  ASSERT_NO_THROW(
+    { stream_validator_info_to_map(info_osm_file_name, "new_requirement_set.json", "1.2.3"); });
+
+  std::ifstream info_osm_file(info_osm_file_name);
+  const std::string stamped_text(
+    (std::istreambuf_iterator<char>(info_osm_file)), std::istreambuf_iterator<char>());
+  info_osm_file.close();
+
+  // Only the start tag of the <validation> element is rewritten
+  const std::string old_tag =
+    R"(<validation note="kept" requirements="old.json" requirements_version="1.1.1">)";
+  const size_t old_tag_begin = map_text.find(old_tag);
+  EXPECT_EQ(stamped_text.substr(0, old_tag_begin), map_text.substr(0, old_tag_begin));
+  const std::string rest = map_text.substr(old_tag_begin + old_tag.size());
+  EXPECT_EQ(stamped_text.substr(stamped_text.size() - rest.size()), rest);
+
+  pugi::xml_document doc;
+  ASSERT_TRUE(doc.load_file(info_osm_file_name.c_str()));
+  pugi::xml_node validation_node = doc.child("osm").child("validation");
+  ASSERT_TRUE(validation_node);
+  ASSERT_FALSE(has_duplicate_attributes(validation_node));
+  EXPECT_STREQ(validation_node.attribute("note").value(), "kept");
+  EXPECT_STREQ(validation_node.attribute("name").value(), "autoware_lanelet2_map_validator");
+  EXPECT_TRUE(std::regex_match(
+    validation_node.attribute("validator_version").value(), version_format_regex_));
+  EXPECT_STREQ(validation_node.attribute("requirements").value(), "new_requirement_set.json");
+  EXPECT_STREQ(validation_node.attribute("requirements_version").value(), "1.2.3");
+  EXPECT_TRUE(validation_node.child("tag"));
+
+  // A map without the element gets it as the first child of <osm>
+  std::ofstream(info_osm_file_name) << "<osm>\n  <node id=\"1\"/>\n</osm>\n";
+  ASSERT_NO_THROW(
+    { stream_validator_info_to_map(info_osm_file_name, "new_requirement_set.json", "1.2.3"); });
+  ASSERT_TRUE(doc.load_file(info_osm_file_name.c_str()));
+  EXPECT_STREQ(doc.child("osm").first_child().name(), "validation");
+  EXPECT_STREQ(
+    doc.child("osm").child("validation").attribute("requirements").value(),
+    "new_requirement_set.json");
+
+  EXPECT_TRUE(std::filesystem::remove(info_osm_file_name))
+    << "Failed to remove temporary file " << info_osm_file_name;
+}
+
 }  // namespace lanelet::autoware::validation